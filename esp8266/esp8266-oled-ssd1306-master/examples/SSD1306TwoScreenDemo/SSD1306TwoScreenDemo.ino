@@ -31,27 +31,31 @@
 // For a connection via I2C using Wire include
 #include <Wire.h>  // Only needed for Arduino 1.6.5 and earlier
 #include "SSD1306Wire.h" // legacy include: `#include "SSD1306.h"`
+#include "OLEDDisplayGroup.h"
 #include "images.h"
 
 // Initialize the OLED display using Wire library
 SSD1306Wire  display(0x3c, D3, D5);
 SSD1306Wire  display2(0x3c, D1, D2);
 
+// Both displays draw into the same buffer, only the selected one at a time
+OLEDDisplayGroup displays;
+
 void setup() {
   Serial.begin(115200);
   Serial.println();
   Serial.println();
 
-
-  // Initialising the UI will init the display too.
-  display.init();
-  display2.init();
-
   // This will make sure that multiple instances of a display driver
   // running on different ports will work together transparently
   display.setI2cAutoInit(true);
   display2.setI2cAutoInit(true);
 
+  // Initialising the group will init the displays too.
+  displays.add(&display);
+  displays.add(&display2);
+  displays.init();
+
   display.flipScreenVertically();
   display.setFont(ArialMT_Plain_10);
   display.setTextAlignment(TEXT_ALIGN_LEFT);
@@ -63,13 +67,20 @@ void setup() {
 }
 
 void loop() {
+  displays.select(&display);
   display.clear();
   display.drawString(0, 0, "Hello world: " + String(millis()));
-  display.display();
 
+  // Starts sending the first display
+  displays.select(&display2);
   display2.clear();
   display2.drawString(0, 0, "Hello world: " + String(millis()));
-  display2.display();
+
+  // Send the rest of both, a page of each in turn
+  displays.beginFlush();
+  while (!displays.flushStep(1000)) {
+    // You can do some work here
+  }
 
   delay(10);
 }
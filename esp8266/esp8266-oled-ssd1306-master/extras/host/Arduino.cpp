@@ -0,0 +1,98 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+#include <Arduino.h>
+
+#include <chrono>
+#include <thread>
+
+static const std::chrono::steady_clock::time_point hostStart = std::chrono::steady_clock::now();
+
+// Microseconds of the stopped clock, negative while it runs
+static long long hostTime = -1;
+
+unsigned long millis() {
+  if (hostTime >= 0) return hostTime / 1000;
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - hostStart).count();
+}
+
+unsigned long micros() {
+  if (hostTime >= 0) return hostTime;
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - hostStart).count();
+}
+
+HardwareSerial Serial;
+
+static uint8_t hostPins[32];
+uint32_t hostPinWrites = 0;
+
+static void (*hostPinInterrupt[sizeof(hostPins)])(void);
+static int hostPinInterruptMode[sizeof(hostPins)];
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  hostPinWrites++;
+  if (pin >= sizeof(hostPins)) return;
+  bool changed = hostPins[pin] != value;
+  hostPins[pin] = value;
+
+  int mode = hostPinInterruptMode[pin];
+  if (changed && hostPinInterrupt[pin] && (mode == CHANGE || mode == (value ? RISING : FALLING))) {
+    hostPinInterrupt[pin]();
+  }
+}
+
+int digitalRead(uint8_t pin) {
+  return pin < sizeof(hostPins) ? hostPins[pin] : LOW;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode) {
+  if (pin >= sizeof(hostPins)) return;
+  hostPinInterrupt[pin]     = isr;
+  hostPinInterruptMode[pin] = mode;
+}
+
+void detachInterrupt(uint8_t pin) {
+  if (pin < sizeof(hostPins)) hostPinInterrupt[pin] = NULL;
+}
+
+void (*hostOnDelay)(void) = NULL;
+
+void delay(unsigned long ms) {
+  if (hostOnDelay) hostOnDelay();
+  if (hostTime >= 0) {
+    hostTime += ms * 1000LL;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void hostSetMillis(unsigned long ms) {
+  hostTime = ms * 1000LL;
+}
@@ -0,0 +1,192 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Minimal host (Linux) stand-in for the parts of the Arduino core the
+// display library and its examples use. Only meant for the benchmarks
+// and the examples runner in this folder, and the host tests of the
+// deauther's DisplayUI.
+
+#ifndef HOST_ARDUINO_h
+#define HOST_ARDUINO_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+#include "binary.h"
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define PGM_P const char *
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define memcpy_P(dest, src, n) memcpy((dest), (src), (n))
+#define strlen_P strlen
+
+class __FlashStringHelper;
+#define FPSTR(pstr_pointer) (reinterpret_cast<const __FlashStringHelper *>(pstr_pointer))
+#define F(string_literal) (FPSTR(string_literal))
+
+#define HIGH 1
+#define LOW  0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define RISING  1
+#define FALLING 2
+#define CHANGE  3
+
+#define ICACHE_RAM_ATTR
+
+// NodeMCU pin names of the ESP8266 core
+#define D0 16
+#define D1 5
+#define D2 4
+#define D3 0
+#define D4 2
+#define D5 14
+#define D6 12
+#define D7 13
+#define D8 15
+
+#define _min(a, b) ((a) < (b) ? (a) : (b))
+#define _max(a, b) ((a) > (b) ? (a) : (b))
+
+template<typename T, typename U> static inline T min(T a, U b) { return (b < a) ? b : a; }
+template<typename T, typename U> static inline T max(T a, U b) { return (a < b) ? b : a; }
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+// Stops the clock for repeatable runs: from then on millis() and micros()
+// return the time set last, advanced only by delay()
+void hostSetMillis(unsigned long ms);
+
+// Called on every delay(), the points where a sketch waits for the next frame
+extern void (*hostOnDelay)(void);
+static inline void yield() {}
+
+static inline void pinMode(uint8_t, uint8_t) {}
+
+// Pins keep the level written last, LOW at first, and digitalRead() reads
+// it back. hostPinWrites counts the writes, for the bus benchmarks.
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+extern uint32_t hostPinWrites;
+
+// An interrupt attached to a pin runs in the digitalWrite() that changes
+// the pin to a level its mode reacts to
+#define digitalPinToInterrupt(pin) (pin)
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t pin);
+static inline void noInterrupts() {}
+static inline void interrupts() {}
+
+class String {
+  public:
+    String() {}
+    String(const char *s) : s(s ? s : "") {}
+    String(const __FlashStringHelper *s) : String(reinterpret_cast<const char *>(s)) {}
+    String(const std::string &s) : s(s) {}
+    String(char c) : s(1, c) {}
+    String(int v) : s(std::to_string(v)) {}
+    String(unsigned int v) : s(std::to_string(v)) {}
+    String(long v) : s(std::to_string(v)) {}
+    String(unsigned long v) : s(std::to_string(v)) {}
+
+    unsigned int length() const { return s.length(); }
+    const char *c_str() const { return s.c_str(); }
+    char charAt(unsigned int i) const { return i < s.length() ? s[i] : 0; }
+    char operator[](unsigned int i) const { return charAt(i); }
+
+    void toCharArray(char *buf, unsigned int bufsize) const {
+      if (!bufsize || !buf) return;
+      unsigned int n = s.length() < bufsize - 1 ? s.length() : bufsize - 1;
+      memcpy(buf, s.c_str(), n);
+      buf[n] = 0;
+    }
+
+    String substring(unsigned int from) const { return from < s.length() ? String(s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+      if (from >= s.length() || to <= from) return String();
+      return String(s.substr(from, to - from));
+    }
+
+    String &operator+=(const String &o) { s += o.s; return *this; }
+    String &operator+=(const char *o) { s += o; return *this; }
+    String &operator+=(char c) { s += c; return *this; }
+
+    friend String operator+(const String &a, const String &b) { return String(a.s + b.s); }
+    friend String operator+(const String &a, const char *b) { return String(a.s + b); }
+    friend String operator+(const char *a, const String &b) { return String(a + b.s); }
+    friend String operator+(const String &a, char b) { return String(a.s + b); }
+    friend String operator+(char a, const String &b) { return String(std::string(1, a) + b.s); }
+
+    bool operator==(const String &o) const { return s == o.s; }
+    bool operator!=(const String &o) const { return s != o.s; }
+
+  private:
+    std::string s;
+};
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    size_t write(const char *str) {
+      if (str == NULL) return 0;
+      size_t n = 0;
+      while (*str) n += write((uint8_t) *str++);
+      return n;
+    }
+    size_t print(const char *str) { return write(str); }
+    size_t print(const String &s) { return write(s.c_str()); }
+    size_t println(void) { return write((uint8_t) '\n'); }
+    size_t println(const char *str) { return print(str) + write((uint8_t) '\n'); }
+    size_t println(const String &s) { return println(s.c_str()); }
+};
+
+// Serial output goes nowhere
+class HardwareSerial : public Print {
+  public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t) { return 1; }
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif
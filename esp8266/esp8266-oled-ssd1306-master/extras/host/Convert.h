@@ -0,0 +1,118 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Helpers of the converters in this folder, which read C arrays from a
+// header and print new ones.
+
+#ifndef Convert_h
+#define Convert_h
+
+#include "Arduino.h"
+
+#include <ctype.h>
+#include <string>
+#include <vector>
+
+static const char *convertTool = "convert";
+
+static inline void fail(const char *message, const char *detail = "") {
+  fprintf(stderr, "%s: %s%s\n", convertTool, message, detail);
+  exit(1);
+}
+
+static inline bool readFile(const char *path, std::string &content) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return false;
+  char chunk[4096];
+  size_t length;
+  while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0) content.append(chunk, length);
+  fclose(file);
+  return true;
+}
+
+// The numbers between the braces of `const uint8_t name[] ... = { ... };`
+static inline bool parseArray(const std::string &source, const char *name, std::vector<uint8_t> &bytes) {
+  size_t nameLength = strlen(name);
+  size_t at = 0;
+  while ((at = source.find(name, at)) != std::string::npos) {
+    size_t end = at + nameLength;
+    bool   startsWord = at == 0 || !(isalnum((uint8_t) source[at - 1]) || source[at - 1] == '_');
+    while (end < source.size() && source[end] == ' ') end++;
+    if (startsWord && end < source.size() && source[end] == '[') break;
+    at += nameLength;
+  }
+  if (at == std::string::npos) return false;
+
+  size_t i = source.find('{', at);
+  if (i == std::string::npos) return false;
+  for (i++; i < source.size() && source[i] != '}'; i++) {
+    if (source.compare(i, 2, "//") == 0) {
+      i = source.find('\n', i);
+      if (i == std::string::npos) return false;
+    } else if (source.compare(i, 2, "/*") == 0) {
+      i = source.find("*/", i);
+      if (i == std::string::npos) return false;
+      i++;
+    } else if (isdigit((uint8_t) source[i])) {
+      char *numberEnd;
+      long  value = strtol(source.c_str() + i, &numberEnd, 0);
+      if (value < 0 || value > 255) fail("value out of range in ", name);
+      bytes.push_back((uint8_t) value);
+      i = numberEnd - source.c_str() - 1;
+    }
+  }
+  return i < source.size();
+}
+
+// The value of `#define name value`
+static inline bool parseDefine(const std::string &source, const std::string &name, int &value) {
+  std::string directive = "#define " + name;
+  size_t at = 0;
+  while ((at = source.find(directive, at)) != std::string::npos) {
+    at += directive.size();
+    if (at < source.size() && (source[at] == ' ' || source[at] == '\t')) {
+      value = strtol(source.c_str() + at, NULL, 0);
+      return true;
+    }
+  }
+  return false;
+}
+
+// One line of `bytes` in the style of the font tool, `comment` may be NULL
+static inline void printBytes(const uint8_t *bytes, size_t length, bool last, const char *comment) {
+  printf("  ");
+  for (size_t i = 0; i < length; i++) {
+    printf("0x%02X%s", bytes[i], i + 1 < length || !last ? "," : "");
+  }
+  if (comment) printf(" // %s", comment);
+  printf("\n");
+}
+
+#endif
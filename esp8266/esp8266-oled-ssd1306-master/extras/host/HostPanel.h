@@ -0,0 +1,206 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// A SSD1306 or SH1106 as far as the library drives it: the display RAM,
+// the ways of addressing it and the commands that change what the glass
+// shows. It is fed the writes a driver sends, control byte first, and
+// tells what a real panel would show after them.
+
+#ifndef HostPanel_h
+#define HostPanel_h
+
+#include "OLEDDisplayI2C.h"
+
+class HostPanel {
+  public:
+    // Rows of the RAM, and columns of the glass
+    static const uint8_t ramRows = 64;
+    static const uint8_t width   = 128;
+
+    HostPanel(OLEDDISPLAY_CONTROLLER controller = CONTROLLER_SSD1306) : controller(controller) {
+      columns = controller == CONTROLLER_SH1106 ? 132 : 128;
+      memset(ram, 0, sizeof(ram));
+    }
+
+    // Rows of the glass, as set by SETMULTIPLEX
+    uint8_t height(void) const {
+      return multiplex + 1;
+    }
+
+    // Set by anything that may have changed the glass, for the caller to clear
+    bool changed = false;
+
+    // One I2C write: a control byte, then commands or display data
+    void receive(const uint8_t *data, size_t length) {
+      if (length == 0) return;
+      uint8_t control = data[0];
+      for (size_t i = 1; i < length; i++) {
+        if (control & I2C_CONTROL_DATA) {
+          write(data[i]);
+        } else {
+          command(data[i]);
+        }
+        // Continuation bit: only one byte after this control byte, then the next control byte
+        if ((control & I2C_CONTROL_COMMAND) && i + 1 < length) {
+          control = data[++i];
+        }
+      }
+    }
+
+    // SPI and the like, which tell data from commands by the D/C pin
+    void command(uint8_t byte) {
+      if (argsLeft > 0) {
+        args[argsTaken++] = byte;
+        if (--argsLeft == 0) apply();
+        return;
+      }
+      pending   = byte;
+      argsTaken = 0;
+      argsLeft  = argumentCount(byte);
+      if (argsLeft == 0) apply();
+    }
+
+    void write(uint8_t byte) {
+      if (column < columns && page < ramRows / 8) ram[page][column] = byte;
+      changed = true;
+      if (controller == CONTROLLER_SSD1306 && memoryMode == 0) {
+        // Horizontal addressing wraps around the window
+        if (column >= columnEnd) {
+          column = columnStart;
+          page   = page >= pageEnd ? pageStart : page + 1;
+        } else {
+          column++;
+        }
+      } else if (controller == CONTROLLER_SSD1306 && column >= columnEnd) {
+        column = columnStart;
+      } else if (column < columns - 1) {
+        // The SH1106 column stops at the last one
+        column++;
+      }
+    }
+
+    // Pixel `x`, `y` of the glass
+    bool pixel(uint8_t x, uint8_t y) const {
+      if (!on || x >= width || y >= height()) return false;
+      uint8_t com = comScanDec ? multiplex - y : y;
+      uint8_t row = (com + startLine + displayOffset) % ramRows;
+      uint8_t segment = x + (columns - width) / 2;
+      uint8_t col = segmentRemap ? columns - 1 - segment : segment;
+      return ((ram[row / 8][col] >> (row & 7)) & 1) != inverted;
+    }
+
+    // The glass in the page layout of OLEDDisplay::buffer, width * height() / 8 bytes
+    void screen(uint8_t *frame) const {
+      memset(frame, 0, width * height() / 8);
+      for (uint8_t y = 0; y < height(); y++) {
+        for (uint8_t x = 0; x < width; x++) {
+          if (pixel(x, y)) frame[x + (y / 8) * width] |= 1 << (y & 7);
+        }
+      }
+    }
+
+  private:
+    OLEDDISPLAY_CONTROLLER controller;
+    uint8_t  columns;
+    uint8_t  ram[ramRows / 8][132];
+
+    // Reset state of the controllers
+    bool     on            = false;
+    bool     inverted      = false;
+    bool     segmentRemap  = false;
+    bool     comScanDec    = false;
+    uint8_t  multiplex     = 63;
+    uint8_t  startLine     = 0;
+    uint8_t  displayOffset = 0;
+    uint8_t  memoryMode    = 2;  // SSD1306 page addressing
+    uint8_t  column        = 0;
+    uint8_t  page          = 0;
+    uint8_t  columnStart   = 0;
+    uint8_t  columnEnd     = 127;
+    uint8_t  pageStart     = 0;
+    uint8_t  pageEnd       = 7;
+
+    // The command waiting for its arguments
+    uint8_t  pending   = 0;
+    uint8_t  args[6];
+    uint8_t  argsTaken = 0;
+    uint8_t  argsLeft  = 0;
+
+    uint8_t argumentCount(uint8_t command) const {
+      switch (command) {
+        case 0x26: case 0x27:                      // Continuous horizontal scroll
+          return 6;
+        case 0x29: case 0x2A:                      // Continuous diagonal scroll
+          return 5;
+        case COLUMNADDR: case PAGEADDR: case 0xA3: // 0xA3: vertical scroll area
+          return controller == CONTROLLER_SSD1306 ? 2 : 0;
+        case MEMORYMODE:
+          return controller == CONTROLLER_SSD1306 ? 1 : 0;
+        case SETCONTRAST: case SETMULTIPLEX: case SETDISPLAYOFFSET: case SETCOMPINS:
+        case SETDISPLAYCLOCKDIV: case SETPRECHARGE: case SETVCOMDETECT: case CHARGEPUMP:
+        case 0xAD:                                 // SH1106 DC-DC control
+          return 1;
+      }
+      return 0;
+    }
+
+    void apply(void) {
+      uint8_t c = pending;
+      changed = true;
+      if (c < 0x10) {
+        // Page addressing: low nibble of the column
+        column = (column & 0xF0) | c;
+      } else if (c < 0x20) {
+        column = (column & 0x0F) | (c & 0x0F) << 4;
+      } else if (c >= 0x40 && c < 0x80) {
+        startLine = c & 0x3F;
+      } else if (c >= 0xB0 && c < 0xB8) {
+        page = c & 0x07;
+      } else {
+        switch (c) {
+          case MEMORYMODE:       memoryMode = args[0] & 3; break;
+          case COLUMNADDR:       columnStart = column = args[0] & 0x7F; columnEnd = args[1] & 0x7F; break;
+          case PAGEADDR:         pageStart = page = args[0] & 7; pageEnd = args[1] & 7; break;
+          case SEGREMAP:         segmentRemap = false; break;
+          case SETSEGMENTREMAP:  segmentRemap = true; break;
+          case COMSCANINC:       comScanDec = false; break;
+          case COMSCANDEC:       comScanDec = true; break;
+          case SETMULTIPLEX:     multiplex = _min(args[0] & 0x3F, ramRows - 1); break;
+          case SETDISPLAYOFFSET: displayOffset = args[0] & 0x3F; break;
+          case NORMALDISPLAY:    inverted = false; break;
+          case INVERTDISPLAY:    inverted = true; break;
+          case DISPLAYOFF:       on = false; break;
+          case DISPLAYON:        on = true; break;
+        }
+      }
+    }
+};
+
+#endif
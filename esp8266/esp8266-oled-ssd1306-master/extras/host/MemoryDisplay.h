@@ -0,0 +1,146 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+#ifndef MemoryDisplay_h
+#define MemoryDisplay_h
+
+#include "OLEDDisplay.h"
+#include <vector>
+
+// An OLEDDisplay that never touches a bus. display() works out the same
+// window SSD1306Wire would send and records the command and data bytes
+// instead, so rendering and flush cost can be measured on the host.
+class MemoryDisplay : public OLEDDisplay {
+  public:
+    // Bytes the last display() would have put on the wire
+    std::vector<uint8_t> sent;
+
+    // Totals since construction
+    uint32_t            commandBytes    = 0;
+    uint32_t            dataBytes       = 0;
+    uint32_t            flushes         = 0;
+
+    MemoryDisplay(OLEDDISPLAY_GEOMETRY g = GEOMETRY_128_64) {
+      setGeometry(g);
+    }
+
+    bool connect() {
+      return true;
+    }
+
+    void display(void) {
+      sent.clear();
+      flushes++;
+      const int x_offset = (128 - this->width()) / 2;
+      #ifdef OLEDDISPLAY_PARTIAL_UPDATE
+        OLEDDisplaySpan   changed[OLEDDISPLAY_MAX_PAGES];
+        OLEDDisplayWindow windows[OLEDDISPLAY_MAX_PAGES];
+        uint8_t x, y;
+
+        // Only the parts drawn to since the last display() are compared
+        if (!updateBackBuffer(changed)) return;
+
+        uint8_t windowCount = planWindows(changed, windows);
+
+        for (uint8_t w = 0; w < windowCount; w++) {
+          uint8_t minBoundX = windows[w].fromX;
+          uint8_t maxBoundX = windows[w].toX;
+          uint8_t minBoundY = windows[w].fromPage;
+          uint8_t maxBoundY = windows[w].toPage;
+
+          sendCommand(COLUMNADDR);
+          sendCommand(x_offset + minBoundX);
+          sendCommand(x_offset + maxBoundX);
+
+          sendCommand(PAGEADDR);
+          sendCommand(minBoundY);
+          sendCommand(maxBoundY);
+
+          for (y = minBoundY; y <= maxBoundY; y++) {
+            for (x = minBoundX; x <= maxBoundX; x++) {
+              sendData(buffer[x + y * this->width()]);
+            }
+          }
+        }
+      #else
+        sendCommand(COLUMNADDR);
+        sendCommand(x_offset);
+        sendCommand(x_offset + (this->width() - 1));
+
+        sendCommand(PAGEADDR);
+        sendCommand(0x0);
+        sendCommand((this->height() / 8) - 1);
+
+        for (uint16_t i = 0; i < displayBufferSize; i++) {
+          sendData(buffer[i]);
+        }
+      #endif
+    }
+
+  protected:
+    // Same costs as SSD1306Wire
+    uint8_t planWindows(const OLEDDisplaySpan *changed, OLEDDisplayWindow *windows) {
+      return planFlush(changed, displayHeight / 8, 12, 0, windows);
+    }
+
+    bool canFlushIncrementally(void) {
+      return true;
+    }
+
+    // Pages of an incremental flush are appended to `sent`
+    void sendWindowPage(const OLEDDisplayWindow &window, uint8_t page, const uint8_t *row) {
+      if (page == window.fromPage) {
+        const int x_offset = (128 - this->width()) / 2;
+        sendCommand(COLUMNADDR);
+        sendCommand(x_offset + window.fromX);
+        sendCommand(x_offset + window.toX);
+
+        sendCommand(PAGEADDR);
+        sendCommand(window.fromPage);
+        sendCommand(window.toPage);
+      }
+      for (uint8_t x = window.fromX; x <= window.toX; x++) {
+        sendData(*row++);
+      }
+    }
+
+  private:
+    void sendCommand(uint8_t com) {
+      sent.push_back(com);
+      commandBytes++;
+    }
+
+    void sendData(uint8_t data) {
+      sent.push_back(data);
+      dataBytes++;
+    }
+};
+
+#endif
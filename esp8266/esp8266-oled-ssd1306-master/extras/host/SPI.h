@@ -0,0 +1,92 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Host stand-in for the SPI library of the ESP8266 core. Nothing is sent
+// anywhere, every call is counted in hostSPI and handed to its listener,
+// which can tell commands from data by reading the DC pin.
+
+#ifndef HOST_SPI_h
+#define HOST_SPI_h
+
+#include <Arduino.h>
+
+// Clock dividers of the ESP8266 core at 80 MHz
+#define SPI_CLOCK_DIV2  0x00101001
+#define SPI_CLOCK_DIV4  0x00241001
+#define SPI_CLOCK_DIV8  0x004c1001
+#define SPI_CLOCK_DIV16 0x009c1001
+
+struct HostSPIBus {
+  // Totals since the last reset(): transfer() and writeBytes() calls, and
+  // the bytes they carried
+  uint32_t calls = 0;
+  uint32_t bytes = 0;
+
+  // Set by SPI.setClockDivider()
+  uint32_t clockDivider = 0;
+
+  // Gets every call too, see HostPanel.h
+  void (*listener)(const uint8_t *data, size_t length) = NULL;
+
+  void reset() {
+    calls = 0;
+    bytes = 0;
+  }
+
+  void transmit(const uint8_t *data, size_t length) {
+    calls++;
+    bytes += length;
+    if (listener) listener(data, length);
+  }
+};
+
+extern HostSPIBus hostSPI;
+
+class SPIClass {
+  public:
+    void begin() {}
+    void setClockDivider(uint32_t clockDivider) {
+      hostSPI.clockDivider = clockDivider;
+    }
+
+    uint8_t transfer(uint8_t data) {
+      hostSPI.transmit(&data, 1);
+      return 0;
+    }
+
+    // Non-const like the cores before 2.5
+    void writeBytes(uint8_t *data, uint32_t size) {
+      hostSPI.transmit(data, size);
+    }
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,52 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Host stand-in for the parts of the Time library the examples use. The
+// time is kept in 32 bits like on the ESP8266 and counts from millis().
+
+#ifndef HOST_TIMELIB_h
+#define HOST_TIMELIB_h
+
+#include <Arduino.h>
+
+#define SECS_PER_MIN  60UL
+#define SECS_PER_HOUR 3600UL
+#define SECS_PER_DAY  86400UL
+
+extern uint32_t hostTimeOffset;
+
+static inline uint32_t now() { return hostTimeOffset + millis() / 1000; }
+static inline void setTime(uint32_t t) { hostTimeOffset = t - millis() / 1000; }
+
+static inline int hour()   { return now() % SECS_PER_DAY / SECS_PER_HOUR; }
+static inline int minute() { return now() % SECS_PER_HOUR / SECS_PER_MIN; }
+static inline int second() { return now() % SECS_PER_MIN; }
+
+#endif
@@ -0,0 +1,123 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Host stand-ins for the Wire and brzo_i2c bus libraries. Nothing is
+// sent anywhere, every transmission is counted in hostI2C and, while
+// logging is on, kept so tests can replay what a display would receive.
+
+#ifndef HOST_WIRE_h
+#define HOST_WIRE_h
+
+#include <Arduino.h>
+#include <vector>
+
+// Same transmit buffer size as the ESP8266 core
+#define BUFFER_LENGTH 128
+
+struct HostI2CBus {
+  // Totals since the last reset(). Bytes include the address byte of
+  // every transmission, dropped are bytes that did not fit the buffer.
+  uint32_t transactions = 0;
+  uint32_t bytes        = 0;
+  uint32_t dropped      = 0;
+
+  // One entry per transmission: the control byte and its payload
+  bool                              logging = false;
+  std::vector<std::vector<uint8_t>> log;
+
+  // Where the next transmission goes: the pins of the last Wire.begin()
+  // or brzo_i2c_setup(), sda << 8 | scl, and the address
+  uint16_t pins    = 0;
+  uint8_t  address = 0;
+
+  // Gets every transmission too, see HostPanel.h
+  void (*listener)(uint16_t pins, uint8_t address, const uint8_t *data, size_t length) = NULL;
+
+  void reset() {
+    transactions = 0;
+    bytes        = 0;
+    dropped      = 0;
+    log.clear();
+  }
+
+  void transmit(const uint8_t *data, size_t length) {
+    transactions++;
+    bytes += length + 1;
+    if (logging) log.push_back(std::vector<uint8_t>(data, data + length));
+    if (listener) listener(pins, address, data, length);
+  }
+};
+
+extern HostI2CBus hostI2C;
+
+class TwoWire {
+  public:
+    void begin(int sda, int scl) {
+      hostI2C.pins = sda << 8 | scl;
+    }
+    void begin() {}
+    void setClock(uint32_t) {}
+
+    void beginTransmission(uint8_t address) {
+      this->address = address;
+      length = 0;
+    }
+
+    size_t write(uint8_t data) {
+      if (length >= BUFFER_LENGTH) {
+        hostI2C.dropped++;
+        return 0;
+      }
+      buffer[length++] = data;
+      return 1;
+    }
+
+    size_t write(const uint8_t *data, size_t count) {
+      for (size_t i = 0; i < count; i++) {
+        if (!write(data[i])) return i;
+      }
+      return count;
+    }
+
+    uint8_t endTransmission() {
+      hostI2C.address = address;
+      hostI2C.transmit(buffer, length);
+      return 0;
+    }
+
+  private:
+    uint8_t buffer[BUFFER_LENGTH];
+    size_t  length  = 0;
+    uint8_t address = 0;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,646 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Host benchmarks for the OLEDDisplay rendering core.
+//
+// Every benchmark prints the sustained rate of the operation, the number
+// of bytes a display() of its result sends after a cleared frame, and a
+// CRC of the resulting frame buffer so a faster implementation can be
+// checked for pixel-exact output against the previous one.
+
+#include "MemoryDisplay.h"
+#include "OLEDDisplayT.h"
+#include "OLEDDisplayUi.h"
+#include "OLEDDisplayGroup.h"
+#include "SSD1306Wire.h"
+#include "SH1106Wire.h"
+#include "SSD1306Brzo.h"
+#include "SH1106Brzo.h"
+#include "SSD1306Spi.h"
+#include "SH1106Spi.h"
+#include "../../examples/SSD1306SimpleDemo/images.h"
+
+// spriteconvert output for the images below, made by the Makefile
+#include "build/BenchSprites.h"
+
+// The packed fonts next to the raw ones OLEDDisplay.h includes
+namespace Packed {
+#include "OLEDDisplayPackedFonts.h"
+}
+
+#include <chrono>
+#include <functional>
+
+static double minSeconds = 0.25;
+static const char *filter = NULL;
+
+static uint32_t crc32(const uint8_t *data, uint16_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  while (length--) {
+    crc ^= *data++;
+    for (uint8_t k = 0; k < 8; k++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+static double now() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Find an iteration count that runs for at least minSeconds, then report
+// the best ops/sec of a few rounds to keep scheduler noise out.
+static double measure(std::function<void(uint32_t)> op) {
+  uint32_t iterations = 16;
+  double best = 0;
+  for (uint8_t round = 0; round < 5; ) {
+    double start = now();
+    for (uint32_t i = 0; i < iterations; i++) {
+      op(i);
+    }
+    double elapsed = now() - start;
+    if (elapsed < minSeconds) {
+      iterations *= (elapsed > minSeconds / 8) ? 2 : 8;
+      continue;
+    }
+    best = _max(best, iterations / elapsed);
+    round++;
+  }
+  return best;
+}
+
+// Only run benchmarks whose name contains `filter`, if given
+static bool selected(const char *name) {
+  return filter == NULL || strstr(name, filter) != NULL;
+}
+
+static void report(const char *name, double opsPerSec, size_t bytes, uint32_t crc) {
+  printf("%-28s %14.0f %10u   %08x\n", name, opsPerSec, (unsigned) bytes, crc);
+}
+
+// Draw benchmark: `op` is timed on its own, the flush size and the CRC
+// come from running it once on a cleared, already flushed frame.
+static void benchDraw(MemoryDisplay &display, const char *name, std::function<void(uint32_t)> op) {
+  if (!selected(name)) return;
+  display.setColor(WHITE);
+  display.setTextAlignment(TEXT_ALIGN_LEFT);
+  display.setFont(ArialMT_Plain_10);
+  display.clear();
+  display.display();
+
+  op(0);
+  uint32_t crc = crc32(display.buffer, display.getWidth() * display.getHeight() / 8);
+  display.display();
+  size_t bytes = display.sent.size();
+
+  double rate = measure(op);
+  report(name, rate, bytes, crc);
+}
+
+// Flush benchmark: times display() for a frame that alternates between
+// `a` and `b`, so the double-buffer diff always has the same work to do.
+static void benchFlush(MemoryDisplay &display, const char *name, const uint8_t *a, const uint8_t *b) {
+  if (!selected(name)) return;
+  uint16_t size = display.getWidth() * display.getHeight() / 8;
+  memcpy(display.buffer, a, size);
+  display.markDirty();
+  display.display();
+  memcpy(display.buffer, b, size);
+  display.markDirty();
+  display.display();
+  size_t bytes = display.sent.size();
+
+  double rate = measure([&](uint32_t i) {
+    memcpy(display.buffer, (i & 1) ? b : a, size);
+    display.markDirty();
+    display.display();
+  });
+  report(name, rate, bytes, crc32(b, size));
+}
+
+// Flush through beginFlush() and single page flushStep() calls
+static uint32_t flushIncrementally(OLEDDisplay &display) {
+  uint32_t steps = 1;
+  display.beginFlush();
+  while (!display.flushStep(0)) steps++;
+  return steps;
+}
+
+// Bus benchmark: like benchFlush, but through a real driver on the host
+// Wire/brzo mock, reporting what one flush puts on the I2C bus. With
+// `incremental` the flush is sent a page per flushStep().
+static void benchBus(OLEDDisplay &display, const char *driver, const char *frame, const uint8_t *a, const uint8_t *b, bool incremental = false) {
+  char name[64];
+  snprintf(name, sizeof(name), "%s %s%s", driver, incremental ? "async " : "", frame);
+  if (!selected(name)) return;
+  uint16_t size = display.getWidth() * display.getHeight() / 8;
+  memcpy(display.buffer, a, size);
+  display.markDirty();
+  display.display();
+  memcpy(display.buffer, b, size);
+  display.markDirty();
+  hostI2C.reset();
+  uint32_t steps = incremental ? flushIncrementally(display) : (display.display(), 1);
+  uint32_t bytes = hostI2C.bytes;
+  uint32_t transactions = hostI2C.transactions;
+  uint32_t dropped = hostI2C.dropped;
+
+  double rate = measure([&](uint32_t i) {
+    memcpy(display.buffer, (i & 1) ? b : a, size);
+    display.markDirty();
+    if (incremental) flushIncrementally(display);
+    else display.display();
+  });
+  printf("%-34s %8.0f %8u %8u", name, rate, (unsigned) bytes, (unsigned) transactions);
+  if (incremental) printf("   %u steps", (unsigned) steps);
+  if (dropped) printf("   %u dropped", (unsigned) dropped);
+  printf("\n");
+}
+
+// SPI benchmark: benchBus for the SPI drivers on the host SPI mock, with
+// the SPI calls and pin writes of one flush
+static void benchSpi(OLEDDisplay &display, const char *driver, const char *frame, const uint8_t *a, const uint8_t *b, bool incremental = false) {
+  char name[64];
+  snprintf(name, sizeof(name), "%s %s%s", driver, incremental ? "async " : "", frame);
+  if (!selected(name)) return;
+  uint16_t size = display.getWidth() * display.getHeight() / 8;
+  memcpy(display.buffer, a, size);
+  display.markDirty();
+  display.display();
+  memcpy(display.buffer, b, size);
+  display.markDirty();
+  hostSPI.reset();
+  hostPinWrites = 0;
+  uint32_t steps = incremental ? flushIncrementally(display) : (display.display(), 1);
+  uint32_t bytes = hostSPI.bytes;
+  uint32_t calls = hostSPI.calls;
+  uint32_t pinWrites = hostPinWrites;
+
+  double rate = measure([&](uint32_t i) {
+    memcpy(display.buffer, (i & 1) ? b : a, size);
+    display.markDirty();
+    if (incremental) flushIncrementally(display);
+    else display.display();
+  });
+  printf("%-34s %8.0f %8u %8u %8u", name, rate, (unsigned) bytes, (unsigned) calls, (unsigned) pinWrites);
+  if (incremental) printf("   %u steps", (unsigned) steps);
+  printf("\n");
+}
+
+// Two SSD1306Wire on their own pins in an OLEDDisplayGroup, both changing
+// from frame `a` to `b` and flushed a page of each in turn. Bytes and
+// writes are of both flushes, memory is what the group allocated.
+static void benchGroup(const char *name, bool shareBuffer, const uint8_t *a, const uint8_t *b) {
+  if (!selected(name)) return;
+  SSD1306Wire first(0x3c, 4, 5), second(0x3c, 12, 14);
+  first.setI2cAutoInit(true);
+  second.setI2cAutoInit(true);
+  OLEDDisplayGroup group(shareBuffer);
+  group.add(&first);
+  group.add(&second);
+  group.init();
+
+  uint16_t size = first.getWidth() * first.getHeight() / 8;
+  auto frame = [&](const uint8_t *data) {
+    for (OLEDDisplay *display : { (OLEDDisplay *) &first, (OLEDDisplay *) &second }) {
+      group.select(display);
+      memcpy(display->buffer, data, size);
+      display->markDirty();
+    }
+    group.display();
+  };
+  frame(a);
+  hostI2C.reset();
+  frame(b);
+  uint32_t bytes = hostI2C.bytes;
+  uint32_t transactions = hostI2C.transactions;
+
+  double rate = measure([&](uint32_t i) {
+    frame((i & 1) ? a : b);
+  });
+  printf("%-34s %8.0f %8u %8u   %u bytes of buffers\n", name, rate, (unsigned) bytes, (unsigned) transactions, (unsigned) group.getMemorySize());
+}
+
+// The primitives OLEDDisplayT compiles for a fixed geometry, run on
+// `display` as its static type sees them. Same rows, same CRCs for the
+// runtime geometry and the template.
+template<class Display>
+static void benchPrimitives(Display &display, const char *geometry) {
+  char name[40];
+  uint16_t width = display.getWidth(), height = display.getHeight();
+
+  snprintf(name, sizeof(name), "setPixel %s", geometry);
+  benchDraw(display, name, [&](uint32_t i) {
+    display.setPixel(i & 127, (i >> 7) & 63);
+  });
+  snprintf(name, sizeof(name), "fillRect small %s", geometry);
+  benchDraw(display, name, [&](uint32_t) {
+    display.fillRect(10, 5, 20, 9);
+  });
+  snprintf(name, sizeof(name), "drawRect %s", geometry);
+  benchDraw(display, name, [&](uint32_t) {
+    display.drawRect(2, 2, width - 4, height - 4);
+  });
+  snprintf(name, sizeof(name), "drawHorizontalLine %s", geometry);
+  benchDraw(display, name, [&](uint32_t i) {
+    display.drawHorizontalLine((i & 31) - 8, (i >> 5) & 15, 40);
+  });
+  snprintf(name, sizeof(name), "clear %s", geometry);
+  benchDraw(display, name, [&](uint32_t) {
+    display.clear();
+  });
+}
+
+// Runtime geometry against OLEDDisplayT for a W x H display
+template<uint16_t W, uint16_t H>
+static void benchGeometry(const char *runtimeName, const char *templateName) {
+  MemoryDisplay runtime(OLEDDisplayGeometry<W, H>::value);
+  OLEDDisplayT<W, H, MemoryDisplay> fixed;
+  runtime.init();
+  fixed.init();
+  benchPrimitives(runtime, runtimeName);
+  benchPrimitives(fixed, templateName);
+}
+
+// Frames and an overlay like the ones of examples/SSD1306UiDemo
+static void logoFrame(OLEDDisplay *display, OLEDDisplayUiState *, int16_t x, int16_t y) {
+  display->drawXbm(x + 34, y + 14, WiFi_Logo_width, WiFi_Logo_height, WiFi_Logo_bits);
+}
+
+static void textFrame(OLEDDisplay *display, OLEDDisplayUiState *, int16_t x, int16_t y) {
+  display->setTextAlignment(TEXT_ALIGN_LEFT);
+  display->setFont(ArialMT_Plain_10);
+  display->drawString(0 + x, 10 + y, "Arial 10");
+  display->setFont(ArialMT_Plain_16);
+  display->drawString(0 + x, 20 + y, "Arial 16");
+  display->setFont(ArialMT_Plain_24);
+  display->drawString(0 + x, 34 + y, "Arial 24");
+}
+
+static void shapesFrame(OLEDDisplay *display, OLEDDisplayUiState *, int16_t x, int16_t y) {
+  display->drawRect(x + 4, y + 4, 50, 30);
+  display->fillCircle(x + 90, y + 24, 18);
+  display->drawProgressBar(x + 4, y + 44, 120, 10, 40);
+}
+
+static void clockOverlay(OLEDDisplay *display, OLEDDisplayUiState *) {
+  display->setTextAlignment(TEXT_ALIGN_RIGHT);
+  display->setFont(ArialMT_Plain_10);
+  display->drawString(128, 0, "12:34");
+}
+
+static FrameCallback   uiFrames[]   = { logoFrame, textFrame, shapesFrame };
+static OverlayCallback uiOverlays[] = { clockOverlay };
+
+// UI benchmark: an OLEDDisplayUi on `display` doing nothing but transitions,
+// unless `setup` turns them off, one tick per op on a stopped host clock.
+// Bytes and crc32 are of the tick halfway through the first transition.
+static void benchUi(MemoryDisplay &display, const char *name, std::function<bool(OLEDDisplayUi &)> setup) {
+  if (!selected(name)) return;
+  OLEDDisplayUi ui(&display);
+  ui.setTargetFPS(30);
+  ui.setTimePerFrame(30);
+  ui.setFrames(uiFrames, 3);
+  ui.setOverlays(uiOverlays, 1);
+  if (!setup(ui)) return;
+
+  unsigned long time = 1000;
+  hostSetMillis(time);
+  auto tick = [&]() {
+    time += 33;
+    hostSetMillis(time);
+    display.sent.clear();
+    ui.update();
+  };
+  // The fixed frame, then into the transition
+  for (uint8_t i = 0; i < 9; i++) tick();
+  uint32_t crc = crc32(display.buffer, display.getWidth() * display.getHeight() / 8);
+  size_t bytes = display.sent.size();
+
+  double rate = measure([&](uint32_t) { tick(); });
+  report(name, rate, bytes, crc);
+}
+
+static const char *loremIpsum = "Lorem ipsum\n dolor sit amet, consetetur sadipscing elitr, sed diam nonumy eirmod tempor invidunt ut labore.";
+
+int main(int argc, char **argv) {
+  if (argc > 1) minSeconds = atof(argv[1]);
+  if (argc > 2) filter = argv[2];
+
+  MemoryDisplay display;
+  display.init();
+
+  printf("%-28s %14s %10s   %s\n", "benchmark", "ops/sec", "bytes", "crc32");
+
+  benchDraw(display, "drawString", [&](uint32_t) {
+    display.drawString(0, 10, "Hello world");
+  });
+  benchDraw(display, "drawString packed", [&](uint32_t) {
+    display.setFont(Packed::ArialMT_Plain_10);
+    display.drawString(0, 10, "Hello world");
+  });
+  benchDraw(display, "drawString ArialMT_Plain_24", [&](uint32_t) {
+    display.setFont(ArialMT_Plain_24);
+    display.drawString(3, 20, "Hello world");
+  });
+  benchDraw(display, "drawString Plain_24 packed", [&](uint32_t) {
+    display.setFont(Packed::ArialMT_Plain_24);
+    display.drawString(3, 20, "Hello world");
+  });
+  benchDraw(display, "drawString clipped", [&](uint32_t) {
+    display.setFont(ArialMT_Plain_16);
+    display.setColor(INVERSE);
+    display.drawString(-5, -7, "Clipped text");
+    display.drawString(70, 53, "Clipped text");
+  });
+  benchDraw(display, "drawString clipped packed", [&](uint32_t) {
+    display.setFont(Packed::ArialMT_Plain_16);
+    display.setColor(INVERSE);
+    display.drawString(-5, -7, "Clipped text");
+    display.drawString(70, 53, "Clipped text");
+  });
+  benchDraw(display, "drawString center unaligned", [&](uint32_t) {
+    display.setTextAlignment(TEXT_ALIGN_CENTER);
+    display.drawString(64, 13, "Hello world");
+  });
+  benchDraw(display, "drawStringMaxWidth", [&](uint32_t) {
+    display.drawStringMaxWidth(0, 0, 128, loremIpsum);
+  });
+  benchDraw(display, "drawStringMaxWidth packed", [&](uint32_t) {
+    display.setFont(Packed::ArialMT_Plain_10);
+    display.drawStringMaxWidth(0, 0, 128, loremIpsum);
+  });
+  benchDraw(display, "getStringWidth", [&](uint32_t) {
+    display.getStringWidth(loremIpsum);
+  });
+  benchDraw(display, "drawLine", [&](uint32_t i) {
+    display.drawLine(0, 0, 127, 63);
+    display.drawLine(127, (i & 31), 0, 63 - (i & 31));
+  });
+  benchDraw(display, "drawLine vertical", [&](uint32_t i) {
+    display.drawLine(i & 127, 63, i & 127, 10);
+  });
+  benchDraw(display, "drawLine clipped", [&](uint32_t i) {
+    display.drawLine(-200, -100 + (i & 31), 300, 150);
+  });
+  // DisplayUI's packet monitor: a bar per column, starting below the screen
+  benchDraw(display, "drawLine packet monitor", [&](uint32_t i) {
+    for (int16_t x = 0; x < 128; x++) {
+      display.drawLine(x, 64, x, 64 - ((x * 7 + i) & 63));
+    }
+  });
+  benchDraw(display, "setPixel", [&](uint32_t i) {
+    display.setPixel(i & 127, (i >> 7) & 63);
+  });
+  benchDraw(display, "fillRect small", [&](uint32_t) {
+    display.fillRect(10, 10, 20, 12);
+  });
+  benchDraw(display, "fillRect full", [&](uint32_t) {
+    display.fillRect(0, 0, 128, 64);
+  });
+  benchDraw(display, "fillRect inverse bar", [&](uint32_t) {
+    display.setColor(INVERSE);
+    display.fillRect(0, 13, 128, 12);
+  });
+  benchDraw(display, "drawRect", [&](uint32_t) {
+    display.drawRect(12, 12, 40, 30);
+  });
+  benchDraw(display, "drawCircle", [&](uint32_t) {
+    display.drawCircle(64, 32, 20);
+  });
+  benchDraw(display, "fillCircle", [&](uint32_t) {
+    display.fillCircle(64, 32, 20);
+  });
+  benchDraw(display, "fillCircle small", [&](uint32_t) {
+    display.fillCircle(20, 20, 5);
+  });
+  benchDraw(display, "fillRoundRect", [&](uint32_t) {
+    display.fillRoundRect(10, 10, 100, 40, 8);
+  });
+  // A 240 degree gauge, 8 pixels thick
+  benchDraw(display, "fillArc gauge", [&](uint32_t) {
+    display.fillArc(64, 40, 30, 22, -120, 120);
+  });
+  benchDraw(display, "drawProgressBar", [&](uint32_t) {
+    display.drawProgressBar(0, 32, 120, 10, 60);
+  });
+  benchDraw(display, "drawXbm", [&](uint32_t) {
+    display.drawXbm(34, 14, WiFi_Logo_width, WiFi_Logo_height, WiFi_Logo_bits);
+  });
+  benchDraw(display, "drawSprite", [&](uint32_t) {
+    display.drawSprite(34, 14, WiFi_Logo_sprite);
+  });
+  benchDraw(display, "drawXbm aligned", [&](uint32_t) {
+    display.drawXbm(34, 16, WiFi_Logo_width, WiFi_Logo_height, WiFi_Logo_bits);
+  });
+  benchDraw(display, "drawSprite aligned", [&](uint32_t) {
+    display.drawSprite(34, 16, WiFi_Logo_sprite);
+  });
+  benchDraw(display, "drawXbm opaque", [&](uint32_t) {
+    display.setColor(BLACK);
+    display.fillRect(34, 14, WiFi_Logo_width, WiFi_Logo_height);
+    display.setColor(WHITE);
+    display.drawXbm(34, 14, WiFi_Logo_width, WiFi_Logo_height, WiFi_Logo_bits);
+  });
+  benchDraw(display, "drawSprite opaque", [&](uint32_t) {
+    display.drawSprite(34, 14, WiFi_Logo_opaque);
+  });
+  benchDraw(display, "drawSprite opaque aligned", [&](uint32_t) {
+    display.drawSprite(34, 16, WiFi_Logo_opaque);
+  });
+  benchDraw(display, "drawFastImage", [&](uint32_t) {
+    display.drawFastImage(10, 13, 8, 8, ANIMATION_activeSymbol);
+  });
+  benchDraw(display, "drawSprite 8x8", [&](uint32_t) {
+    display.drawSprite(10, 13, ANIMATION_activeSymbol_sprite);
+  });
+  benchDraw(display, "drawFastImage masked", [&](uint32_t) {
+    display.setColor(BLACK);
+    display.drawFastImage(10, 13, 8, 8, ANIMATION_activeSymbol);
+    display.setColor(WHITE);
+    display.drawFastImage(10, 13, 8, 8, ANIMATION_inactiveSymbol);
+  });
+  benchDraw(display, "drawSprite masked", [&](uint32_t) {
+    display.drawSprite(10, 13, ANIMATION_masked);
+  });
+  benchDraw(display, "clear", [&](uint32_t) {
+    display.clear();
+  });
+
+  display.setLogBuffer(5, 30);
+  for (uint8_t i = 0; i < 10; i++) {
+    display.print("Log line ");
+    display.println(String(i));
+  }
+  benchDraw(display, "drawLogBuffer", [&](uint32_t) {
+    display.drawLogBuffer(0, 0);
+  });
+  benchDraw(display, "write (log scroll)", [&](uint32_t) {
+    display.println("Hello log");
+  });
+
+  // A bigger buffer kept full, every write drops the oldest line
+  display.setLogBuffer(16, 64);
+  for (uint8_t i = 0; i < 40; i++) {
+    display.println("A long line that keeps the log buffer full at all times");
+  }
+  benchDraw(display, "write (full log)", [&](uint32_t i) {
+    display.print((char) ('a' + i % 26));
+    if (i % 60 == 59) display.write(10);
+  });
+
+  display.setLogBuffer(5, 30, LOG_CELLS);
+  for (uint8_t i = 0; i < 10; i++) {
+    display.print("Log line ");
+    display.println(String(i));
+  }
+  benchDraw(display, "drawLogBuffer cells", [&](uint32_t) {
+    display.drawLogBuffer(0, 0);
+  });
+  benchDraw(display, "write (cells scroll)", [&](uint32_t) {
+    display.println("Hello log");
+  });
+  display.setLogBuffer(0, 0);
+
+  uint16_t size = display.getWidth() * display.getHeight() / 8;
+  uint8_t *blank = (uint8_t *) calloc(size, 1);
+  uint8_t *pixel = (uint8_t *) calloc(size, 1);
+  uint8_t *corners = (uint8_t *) calloc(size, 1);
+  uint8_t *full = (uint8_t *) malloc(size);
+  uint8_t *headerA = (uint8_t *) calloc(size, 1);
+  uint8_t *headerB = (uint8_t *) calloc(size, 1);
+  pixel[5 * display.getWidth() + 40] = 0x10;
+  corners[0] = 0x01;
+  corners[size - 1] = 0x80;
+  for (uint16_t i = 0; i < size; i++) full[i] = (uint8_t) (i * 7);
+  // A counter in the top right corner and a new sample at the right end of a graph
+  for (uint16_t x = 100; x < 120; x++) headerB[x] = (uint8_t) x;
+  for (uint16_t page = 4; page < 8; page++) headerB[page * display.getWidth() + 127] = 0xFF;
+
+  benchFlush(display, "display unchanged", blank, blank);
+  benchFlush(display, "display one pixel", blank, pixel);
+  benchFlush(display, "display two corners", blank, corners);
+  benchFlush(display, "display full frame", blank, full);
+  benchFlush(display, "display header and graph", headerA, headerB);
+
+  // Nothing drawn at all, and the usual clear() and redraw of the same text
+  display.clear();
+  display.display();
+  if (selected("display untouched")) {
+    double rate = measure([&](uint32_t) { display.display(); });
+    report("display untouched", rate, display.sent.size(), crc32(display.buffer, size));
+  }
+  if (selected("display redrawn text")) {
+    double rate = measure([&](uint32_t) {
+      display.clear();
+      display.drawString(0, 10, "Hello world");
+      display.display();
+    });
+    report("display redrawn text", rate, display.sent.size(), crc32(display.buffer, size));
+  }
+
+  printf("\n");
+  benchGeometry<128, 64>("128x64", "<128,64>");
+  benchGeometry<128, 32>("128x32", "<128,32>");
+  benchGeometry<64, 48>("64x48", "<64,48>");
+  benchGeometry<96, 16>("96x16", "<96,16>");
+
+  SSD1306Wire  ssd1306Wire(0x3c, 4, 5);
+  SH1106Wire   sh1106Wire(0x3c, 4, 5);
+  SSD1306Brzo  ssd1306Brzo(0x3c, 4, 5);
+  SH1106Brzo   sh1106Brzo(0x3c, 4, 5);
+  struct { OLEDDisplay *display; const char *name; } drivers[] = {
+    { &ssd1306Wire, "SSD1306Wire" }, { &sh1106Wire, "SH1106Wire" },
+    { &ssd1306Brzo, "SSD1306Brzo" }, { &sh1106Brzo, "SH1106Brzo" }
+  };
+
+  printf("\n%-34s %8s %8s %8s\n", "bus", "ops/sec", "bytes", "writes");
+  for (auto &driver : drivers) {
+    driver.display->init();
+    benchBus(*driver.display, driver.name, "full frame", blank, full);
+    benchBus(*driver.display, driver.name, "one pixel", blank, pixel);
+    benchBus(*driver.display, driver.name, "header and graph", headerA, headerB);
+    benchBus(*driver.display, driver.name, "full frame", blank, full, true);
+    benchBus(*driver.display, driver.name, "header and graph", headerA, headerB, true);
+  }
+  benchGroup("group of 2 header and graph", false, headerA, headerB);
+  benchGroup("group of 2 shared header and graph", true, headerA, headerB);
+
+  SSD1306Spi ssd1306Spi(16, 4, 15);
+  SH1106Spi  sh1106Spi(16, 4, 15);
+  struct { OLEDDisplay *display; const char *name; } spiDrivers[] = {
+    { &ssd1306Spi, "SSD1306Spi" }, { &sh1106Spi, "SH1106Spi" }
+  };
+
+  printf("\n%-34s %8s %8s %8s %8s\n", "spi", "ops/sec", "bytes", "calls", "pins");
+  for (auto &driver : spiDrivers) {
+    driver.display->init();
+    benchSpi(*driver.display, driver.name, "full frame", blank, full);
+    benchSpi(*driver.display, driver.name, "one pixel", blank, pixel);
+    benchSpi(*driver.display, driver.name, "header and graph", headerA, headerB);
+    benchSpi(*driver.display, driver.name, "full frame", blank, full, true);
+    benchSpi(*driver.display, driver.name, "header and graph", headerA, headerB, true);
+  }
+
+  // Last, they stop the host clock
+  printf("\n");
+  MemoryDisplay uiDisplay;
+  uiDisplay.init();
+  auto slide = [](AnimationDirection animation, bool cached, bool decorated) {
+    return [=](OLEDDisplayUi &ui) {
+      ui.setFrameAnimation(animation);
+      if (!decorated) {
+        ui.setOverlays(NULL, 0);
+        ui.disableAllIndicators();
+      }
+      return !cached || ui.enableFrameCache();
+    };
+  };
+  benchUi(uiDisplay, "ui slide left", slide(SLIDE_LEFT, false, true));
+  benchUi(uiDisplay, "ui slide left cached", slide(SLIDE_LEFT, true, true));
+  benchUi(uiDisplay, "ui slide up", slide(SLIDE_UP, false, true));
+  benchUi(uiDisplay, "ui slide up cached", slide(SLIDE_UP, true, true));
+  benchUi(uiDisplay, "ui slide up bare", slide(SLIDE_UP, false, false));
+  benchUi(uiDisplay, "ui slide up bare cached", slide(SLIDE_UP, true, false));
+  // Always the same frame, drawn every tick but sent once
+  benchUi(uiDisplay, "ui fixed frame", [](OLEDDisplayUi &ui) {
+    ui.disableAutoTransition();
+    return true;
+  });
+
+  free(headerA);
+  free(headerB);
+  free(blank);
+  free(pixel);
+  free(corners);
+  free(full);
+  return 0;
+}
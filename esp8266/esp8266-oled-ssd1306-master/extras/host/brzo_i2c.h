@@ -0,0 +1,50 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Host stand-in for brzo_i2c, see Wire.h. Every brzo_i2c_write() is
+// counted as one transmission on hostI2C.
+
+#ifndef HOST_BRZO_I2C_h
+#define HOST_BRZO_I2C_h
+
+#include "Wire.h"
+
+static inline void brzo_i2c_setup(uint8_t sda, uint8_t scl, uint32_t) {
+  hostI2C.pins = sda << 8 | scl;
+}
+static inline void brzo_i2c_start_transaction(uint8_t address, uint16_t) {
+  hostI2C.address = address;
+}
+static inline void brzo_i2c_write(uint8_t *data, uint32_t length, bool) {
+  hostI2C.transmit(data, length);
+}
+static inline uint8_t brzo_i2c_end_transaction() { return 0; }
+
+#endif
@@ -0,0 +1,261 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Runs the example sketches on the host against emulated panels and
+// reports how many distinct frames each one showed, how fast the host
+// rendered them and how many bus bytes each frame cost.
+//
+//   examples [-t seconds] [-o dir] [-g dir] [name]
+//
+// Every sketch runs from a stopped clock for `seconds` of its own time
+// (30 by default), see hostSetMillis() in Arduino.h. Every transmission
+// goes to the HostPanel of its pins and address, and whenever the sketch
+// waits in delay() or returns from loop(), each panel whose glass changed
+// is a new frame. -o writes every frame as dir/<sketch>/<panel>-<n>.pbm,
+// -g compares them with such files instead and fails on any difference.
+// Only sketches whose name contains `name` run.
+
+#include <Wire.h>
+#include <TimeLib.h>
+#include "HostPanel.h"
+#include "HostSketch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+
+HostSketch *HostSketch::first = NULL;
+uint32_t    hostTimeOffset    = 0;
+
+static const char *outDir    = NULL;
+static const char *goldenDir = NULL;
+
+struct Panel {
+  HostPanel            panel;
+  std::vector<uint8_t> shown;
+  uint32_t             frames = 0;
+};
+
+// Keyed by pins << 8 | address, the way HostI2CBus tells the buses apart
+static std::map<uint32_t, Panel> panels;
+
+static const char *sketchName;
+static uint32_t    frames;
+static uint32_t    crc;
+static uint32_t    mismatches;
+static double      snapshotSeconds;
+
+static uint32_t crc32(uint32_t crc, const uint8_t *data, size_t length) {
+  crc = ~crc;
+  while (length--) {
+    crc ^= *data++;
+    for (uint8_t k = 0; k < 8; k++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+static double wallClock() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void receive(uint16_t pins, uint8_t address, const uint8_t *data, size_t length) {
+  panels[(uint32_t) pins << 8 | address].panel.receive(data, length);
+}
+
+// dir/<sketch>/<address>-<sda>-<scl>-<n>.pbm
+static std::string framePath(const char *dir, uint32_t key, uint32_t frame) {
+  char name[48];
+  snprintf(name, sizeof(name), "/%02x-%u-%u-%04u.pbm", key & 0xFF, key >> 16, key >> 8 & 0xFF, frame);
+  return std::string(dir) + "/" + sketchName + name;
+}
+
+// A plain PBM, with the lit pixels white
+static std::string toPbm(const HostPanel &panel) {
+  char header[32];
+  snprintf(header, sizeof(header), "P4\n%u %u\n", panel.width, panel.height());
+  std::string pbm(header);
+  for (uint8_t y = 0; y < panel.height(); y++) {
+    for (uint8_t x = 0; x < panel.width; x += 8) {
+      uint8_t bits = 0;
+      for (uint8_t b = 0; b < 8; b++) {
+        if (!panel.pixel(x + b, y)) bits |= 0x80 >> b;
+      }
+      pbm += (char) bits;
+    }
+  }
+  return pbm;
+}
+
+static bool readFile(const std::string &path, std::string &contents) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  char   chunk[4096];
+  size_t n;
+  contents.clear();
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) contents.append(chunk, n);
+  fclose(f);
+  return true;
+}
+
+static void mismatch(const std::string &path, const char *what) {
+  if (mismatches++ < 10) fprintf(stderr, "%s: %s\n", path.c_str(), what);
+}
+
+static void checkFrame(uint32_t key, Panel &p) {
+  if (!outDir && !goldenDir) return;
+  std::string pbm = toPbm(p.panel);
+  if (outDir) {
+    std::string path = framePath(outDir, key, p.frames);
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f || fwrite(pbm.data(), 1, pbm.size(), f) != pbm.size()) {
+      fprintf(stderr, "examples: can't write %s\n", path.c_str());
+      exit(2);
+    }
+    fclose(f);
+  }
+  if (goldenDir) {
+    std::string path = framePath(goldenDir, key, p.frames);
+    std::string golden;
+    if (!readFile(path, golden)) {
+      mismatch(path, "missing");
+    } else if (golden != pbm) {
+      mismatch(path, "differs");
+    }
+  }
+}
+
+// Takes a frame of every panel that shows something new
+static void snapshot(void) {
+  double start = wallClock();
+  for (auto &entry : panels) {
+    Panel &p = entry.second;
+    if (!p.panel.changed) continue;
+    p.panel.changed = false;
+
+    std::vector<uint8_t> screen(p.panel.width * p.panel.height() / 8);
+    p.panel.screen(&screen[0]);
+    if (screen == p.shown) continue;
+    p.shown = screen;
+    p.frames++;
+    frames++;
+    crc = crc32(crc, &screen[0], screen.size());
+    checkFrame(entry.first, p);
+  }
+  snapshotSeconds += wallClock() - start;
+}
+
+static void run(const HostSketch &sketch, double seconds) {
+  sketchName = sketch.name;
+  frames = crc = 0;
+  snapshotSeconds = 0;
+  panels.clear();
+  hostI2C.reset();
+  hostI2C.listener = receive;
+  hostOnDelay = snapshot;
+  hostTimeOffset = 0;
+  hostSetMillis(0);
+
+  if (outDir) {
+    std::string dir = std::string(outDir) + "/" + sketch.name;
+    mkdir(outDir, 0777);
+    mkdir(dir.c_str(), 0777);
+  }
+
+  double start = wallClock();
+  sketch.setup();
+  snapshot();
+  while (millis() < seconds * 1000) {
+    unsigned long before = millis();
+    sketch.loop();
+    snapshot();
+    // A loop() that doesn't wait would never get to the end
+    if (millis() == before) hostSetMillis(before + 1);
+  }
+  double elapsed = wallClock() - start - snapshotSeconds;
+
+  if (goldenDir) {
+    // Frames the golden run had past the last one of this run
+    for (auto &entry : panels) {
+      std::string path = framePath(goldenDir, entry.first, entry.second.frames + 1);
+      std::string golden;
+      if (readFile(path, golden)) mismatch(path, "not shown");
+    }
+  }
+
+  hostOnDelay = NULL;
+  hostI2C.listener = NULL;
+  printf("%-28s %8u %12.0f %12.0f   %08x\n", sketch.name, (unsigned) frames,
+         elapsed > 0 ? frames / elapsed : 0, frames ? (double) hostI2C.bytes / frames : 0, crc);
+}
+
+int main(int argc, char **argv) {
+  double      seconds = 30;
+  const char *filter  = NULL;
+
+  int i = 1;
+  for (; i + 1 < argc && argv[i][0] == '-'; i += 2) {
+    if (strcmp(argv[i], "-t") == 0) {
+      seconds = atof(argv[i + 1]);
+    } else if (strcmp(argv[i], "-o") == 0) {
+      outDir = argv[i + 1];
+    } else if (strcmp(argv[i], "-g") == 0) {
+      goldenDir = argv[i + 1];
+    } else {
+      break;
+    }
+  }
+  if (i < argc && argv[i][0] == '-') {
+    fprintf(stderr, "usage: examples [-t seconds] [-o dir] [-g dir] [name]\n");
+    return 2;
+  }
+  if (i < argc) filter = argv[i];
+
+  std::vector<const HostSketch *> sketches;
+  for (const HostSketch *s = HostSketch::first; s; s = s->next) {
+    if (!filter || strstr(s->name, filter)) sketches.push_back(s);
+  }
+  std::sort(sketches.begin(), sketches.end(), [](const HostSketch *a, const HostSketch *b) {
+    return strcmp(a->name, b->name) < 0;
+  });
+
+  printf("%-28s %8s %12s %12s   %s\n", "sketch", "frames", "frames/sec", "bytes/frame", "crc32");
+  for (const HostSketch *s : sketches) run(*s, seconds);
+
+  if (mismatches) {
+    fprintf(stderr, "%u frames differ from %s\n", (unsigned) mismatches, goldenDir);
+    return 1;
+  }
+  return 0;
+}
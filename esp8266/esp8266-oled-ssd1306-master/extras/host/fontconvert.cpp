@@ -0,0 +1,250 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Converts a font array made by http://oleddisplay.squix.ch to the packed
+// format described in OLEDDisplay.h, optionally keeping only some chars.
+//
+//   fontconvert [-n name] [-c chars] [-f file] [-r first-last] font.h Font > packed.h
+//
+// -c, -f and -r add to the chars to keep, all of them are kept if none is
+// given. Text from -c and -f is UTF-8 and mapped to the font table like
+// the default lookup of OLEDDisplay does. Every packed glyph is decoded
+// again and compared with the original before anything is written.
+
+#include "Convert.h"
+#include "OLEDDisplay.h"
+
+#include <vector>
+
+// Adds the font table index of every char of UTF-8 `text`
+static void keepText(const std::string &text, bool keep[256]) {
+  uint8_t last = 0;
+  for (size_t i = 0; i < text.size(); i++) {
+    uint8_t ch = text[i];
+    uint8_t code = 0;
+    if (ch < 128) {
+      code = ch;
+    } else if (last == 0xC2) {
+      code = ch;
+    } else if (last == 0xC3) {
+      code = ch | 0xC0;
+    } else if (last == 0x82 && ch == 0xAC) {
+      code = 0x80;
+    }
+    last = ch < 128 ? 0 : ch;
+    if (code >= 32) keep[code] = true;
+  }
+}
+
+// Column `column` of a raw glyph as one bit per row
+static uint64_t rawColumn(const uint8_t *data, uint16_t size, uint8_t rasterHeight, uint16_t column) {
+  uint64_t bits = 0;
+  for (uint8_t r = 0; r < rasterHeight; r++) {
+    uint16_t i = column * rasterHeight + r;
+    if (i < size) bits |= (uint64_t) data[i] << (8 * r);
+  }
+  return bits;
+}
+
+struct PackedGlyph {
+  uint8_t              width;
+  std::vector<uint8_t> data;
+};
+
+// Inked box of a raw glyph followed by its columns, see OLEDDisplay.h
+static PackedGlyph packGlyph(const uint8_t *data, uint16_t size, uint8_t width, uint8_t rasterHeight, uint8_t code) {
+  PackedGlyph packed;
+  packed.width = width;
+
+  uint16_t columns = (size + rasterHeight - 1) / rasterHeight;
+  uint64_t ink = 0;
+  int16_t  left = -1, right = -1;
+  for (uint16_t column = 0; column < columns; column++) {
+    uint64_t bits = rawColumn(data, size, rasterHeight, column);
+    if (!bits) continue;
+    if (left < 0) left = column;
+    right = column;
+    ink |= bits;
+  }
+  // A glyph without ink is as good as one without data
+  if (!ink) return packed;
+
+  uint8_t top = 0, rows = 0;
+  while (!(ink >> top & 1)) top++;
+  while (rows < 64 - top && ink >> (top + rows)) rows++;
+
+  // The margin takes two bits, blank columns past that are stored
+  if (left > 3) left = 3;
+
+  packed.data.push_back(top | left << 6);
+  packed.data.push_back(rows);
+  packed.data.push_back(right - left + 1);
+
+  uint32_t bitCount = 0;
+  for (uint16_t column = left; column <= right; column++) {
+    uint64_t bits = rawColumn(data, size, rasterHeight, column) >> top;
+    for (uint8_t row = 0; row < rows; row++, bitCount++) {
+      if (bitCount % 8 == 0) packed.data.push_back(0);
+      if (bits >> row & 1) packed.data.back() |= 1 << (bitCount % 8);
+    }
+  }
+  if (packed.data.size() > 255) {
+    char detail[32];
+    snprintf(detail, sizeof(detail), " %d", code);
+    fail("glyph data doesn't fit 255 bytes, char", detail);
+  }
+
+  // Decode it again the way drawPackedGlyph does and compare
+  bitCount = 0;
+  for (uint16_t column = 0; column < columns; column++) {
+    uint64_t bits = 0;
+    if (column >= (uint16_t) left && column <= (uint16_t) right) {
+      for (uint8_t row = 0; row < rows; row++, bitCount++) {
+        uint8_t byte = packed.data[PACKED_GLYPH_START + bitCount / 8];
+        bits |= (uint64_t) (byte >> (bitCount % 8) & 1) << (top + row);
+      }
+    }
+    if (bits != rawColumn(data, size, rasterHeight, column)) {
+      char detail[32];
+      snprintf(detail, sizeof(detail), " %d", code);
+      fail("packed glyph doesn't match the original, char", detail);
+    }
+  }
+  return packed;
+}
+
+int main(int argc, char **argv) {
+  convertTool = "fontconvert";
+  const char *outName = NULL;
+  bool        keep[256] = {false};
+  bool        subset = false;
+
+  int i = 1;
+  for (; i + 1 < argc && argv[i][0] == '-'; i += 2) {
+    if (strcmp(argv[i], "-n") == 0) {
+      outName = argv[i + 1];
+    } else if (strcmp(argv[i], "-c") == 0) {
+      keepText(argv[i + 1], keep);
+      subset = true;
+    } else if (strcmp(argv[i], "-f") == 0) {
+      std::string text;
+      if (!readFile(argv[i + 1], text)) fail("can't read ", argv[i + 1]);
+      keepText(text, keep);
+      subset = true;
+    } else if (strcmp(argv[i], "-r") == 0) {
+      int first, last;
+      if (sscanf(argv[i + 1], "%i-%i", &first, &last) != 2 || first < 0 || last > 255 || first > last) {
+        fail("bad range ", argv[i + 1]);
+      }
+      for (int code = first; code <= last; code++) keep[code] = true;
+      subset = true;
+    } else {
+      fail("unknown option ", argv[i]);
+    }
+  }
+  if (argc - i != 2) {
+    fprintf(stderr, "usage: fontconvert [-n name] [-c chars] [-f file] [-r first-last] font.h Font > packed.h\n");
+    return 2;
+  }
+  const char *path = argv[i];
+  const char *name = argv[i + 1];
+  if (!outName) outName = name;
+
+  std::string          source;
+  std::vector<uint8_t> font;
+  if (!readFile(path, source)) fail("can't read ", path);
+  if (!parseArray(source, name, font)) fail("no font array named ", name);
+  if (font.size() < JUMPTABLE_START) fail("truncated font ", name);
+
+  uint8_t width     = font[WIDTH_POS];
+  uint8_t height    = font[HEIGHT_POS];
+  uint8_t firstChar = font[FIRST_CHAR_POS];
+  uint8_t charNum   = font[CHAR_NUM_POS];
+  uint8_t rasterHeight = (height + 7) / 8;
+
+  if (width & FONT_PACKED) fail(name, " is packed already or too wide");
+  if (height == 0 || height > 64) fail(name, " is taller than 64 pixels");
+  if (font.size() < (size_t) JUMPTABLE_START + charNum * JUMPTABLE_BYTES) fail("truncated font ", name);
+
+  const uint8_t *jumpTable = &font[JUMPTABLE_START];
+  const uint8_t *data      = jumpTable + charNum * JUMPTABLE_BYTES;
+  size_t         dataSize  = font.size() - JUMPTABLE_START - charNum * JUMPTABLE_BYTES;
+
+  std::vector<PackedGlyph> glyphs(charNum);
+  int16_t first = -1, last = -1;
+  for (uint16_t c = 0; c < charNum; c++, jumpTable += JUMPTABLE_BYTES) {
+    uint8_t code = firstChar + c;
+    if (subset && !keep[code]) continue;
+
+    uint16_t offset = jumpTable[0] << 8 | jumpTable[JUMPTABLE_LSB];
+    uint8_t  size   = jumpTable[JUMPTABLE_SIZE];
+    glyphs[c].width = jumpTable[JUMPTABLE_WIDTH];
+    if (offset != 0xFFFF) {
+      if (offset + size > dataSize) fail("glyph data past the end of ", name);
+      glyphs[c] = packGlyph(data + offset, size, glyphs[c].width, rasterHeight, code);
+    }
+    if (first < 0) first = c;
+    last = c;
+  }
+  if (first < 0) fail("none of the chars to keep are in ", name);
+
+  size_t packedSize = JUMPTABLE_START + (last - first + 1) * PACKED_TABLE_BYTES;
+  for (int16_t c = first; c <= last; c++) packedSize += glyphs[c].data.size();
+
+  const char *fileName = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+  printf("// %s from %s packed by extras/host/fontconvert, see OLEDDisplay.h for the format\n", name, fileName);
+  printf("const uint8_t %s[] PROGMEM = {\n", outName);
+  printf("  0x%02X, // Width: %d, packed\n", width | FONT_PACKED, width);
+  printf("  0x%02X, // Height: %d\n", height, height);
+  printf("  0x%02X, // First Char: %d\n", firstChar + first, firstChar + first);
+  printf("  0x%02X, // Numbers of Chars: %d\n", last - first + 1, last - first + 1);
+  printf("\n  // Glyph Table:\n");
+  bool hasData = false;
+  for (int16_t c = first; c <= last; c++) {
+    uint8_t entry[PACKED_TABLE_BYTES] = { glyphs[c].width, (uint8_t) glyphs[c].data.size() };
+    char    comment[8];
+    snprintf(comment, sizeof(comment), "%d", firstChar + c);
+    hasData |= !glyphs[c].data.empty();
+    printBytes(entry, PACKED_TABLE_BYTES, c == last && !hasData, comment);
+  }
+  printf("\n  // Font Data:\n");
+  int16_t lastWithData = last;
+  while (lastWithData >= first && glyphs[lastWithData].data.empty()) lastWithData--;
+  for (int16_t c = first; c <= lastWithData; c++) {
+    if (glyphs[c].data.empty()) continue;
+    char comment[8];
+    snprintf(comment, sizeof(comment), "%d", firstChar + c);
+    printBytes(&glyphs[c].data[0], glyphs[c].data.size(), c == lastWithData, comment);
+  }
+  printf("};\n");
+
+  fprintf(stderr, "%s: %u -> %u bytes\n", name, (unsigned) font.size(), (unsigned) packedSize);
+  return 0;
+}
@@ -0,0 +1,52 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Builds one example sketch for the host. The Makefile compiles this file
+// once per sketch with SKETCH_NAME set to its name and SKETCH_FILE to the
+// path of its .ino, which is wrapped in a namespace so that all of them
+// fit into one program.
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <TimeLib.h>
+#include "SSD1306Wire.h"
+#include "SH1106Wire.h"
+#include "OLEDDisplayUi.h"
+#include "OLEDDisplayGroup.h"
+#include "HostSketch.h"
+
+#define HOST_STRING(x) #x
+#define HOST_NAME(x) HOST_STRING(x)
+
+namespace SKETCH_NAME {
+#include SKETCH_FILE
+}
+
+static HostSketch sketch(HOST_NAME(SKETCH_NAME), SKETCH_NAME::setup, SKETCH_NAME::loop);
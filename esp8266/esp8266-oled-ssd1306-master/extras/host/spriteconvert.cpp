@@ -0,0 +1,161 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Converts an image to the sprite format described in OLEDDisplay.h, the
+// page layout of the display buffer drawSprite() copies from.
+//
+//   spriteconvert [-n name] [-w width -h height] [-m mask] [-o] [-c] image.h image > sprite.h
+//
+// The image is a XBM array unless -c reads the column format of
+// drawFastImage(). Width and height come from the `image_width` and
+// `image_height` defines of a XBM named `image_bits` if not given. -m
+// names an array of the same size and format whose set pixels are the
+// ones to draw, -o makes the sprite draw every pixel of its box.
+
+#include "Convert.h"
+#include "OLEDDisplay.h"
+
+#include <vector>
+
+typedef std::vector<std::vector<bool> > Pixels;
+
+// Pixels of `bytes` in XBM rows or in drawFastImage() columns
+static Pixels readPixels(const std::vector<uint8_t> &bytes, int width, int height, bool columns, const char *name) {
+  int    rowBytes = (width + 7) / 8;
+  int    rasterHeight = (height + 7) / 8;
+  size_t needed = columns ? (size_t) width * rasterHeight : (size_t) rowBytes * height;
+  if (bytes.size() < needed) fail("not enough data in ", name);
+
+  Pixels pixels(height, std::vector<bool>(width));
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      uint8_t byte = columns ? bytes[x * rasterHeight + y / 8] : bytes[y * rowBytes + x / 8];
+      pixels[y][x] = byte >> (columns ? y & 7 : x & 7) & 1;
+    }
+  }
+  return pixels;
+}
+
+// Byte of page `page`, column `x`, rows past the bottom are 0
+static uint8_t pageByte(const Pixels &pixels, int page, int x) {
+  uint8_t byte = 0;
+  for (int bit = 0; bit < 8 && page * 8 + bit < (int) pixels.size(); bit++) {
+    if (pixels[page * 8 + bit][x]) byte |= 1 << bit;
+  }
+  return byte;
+}
+
+static std::vector<uint8_t> loadArray(const std::string &source, const char *name) {
+  std::vector<uint8_t> bytes;
+  if (!parseArray(source, name, bytes)) fail("no array named ", name);
+  return bytes;
+}
+
+int main(int argc, char **argv) {
+  convertTool = "spriteconvert";
+  const char *outName = NULL;
+  const char *maskName = NULL;
+  int         width = -1, height = -1;
+  bool        opaque = false, columns = false;
+
+  int i = 1;
+  for (; i < argc && argv[i][0] == '-'; i++) {
+    bool hasValue = i + 1 < argc;
+    if (strcmp(argv[i], "-o") == 0) {
+      opaque = true;
+    } else if (strcmp(argv[i], "-c") == 0) {
+      columns = true;
+    } else if (strcmp(argv[i], "-n") == 0 && hasValue) {
+      outName = argv[++i];
+    } else if (strcmp(argv[i], "-m") == 0 && hasValue) {
+      maskName = argv[++i];
+    } else if (strcmp(argv[i], "-w") == 0 && hasValue) {
+      width = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-h") == 0 && hasValue) {
+      height = atoi(argv[++i]);
+    } else {
+      fail("unknown option ", argv[i]);
+    }
+  }
+  if (argc - i != 2) {
+    fprintf(stderr, "usage: spriteconvert [-n name] [-w width -h height] [-m mask] [-o] [-c] image.h image > sprite.h\n");
+    return 2;
+  }
+  const char *path = argv[i];
+  const char *name = argv[i + 1];
+  if (opaque && maskName) fail("a sprite is either masked or opaque");
+
+  std::string source;
+  if (!readFile(path, source)) fail("can't read ", path);
+
+  // XBM names: image_width, image_height and image_bits
+  std::string base = name;
+  if (base.size() > 5 && base.compare(base.size() - 5, 5, "_bits") == 0) base.resize(base.size() - 5);
+  if (width < 0 && !parseDefine(source, base + "_width", width)) fail("no width given for ", name);
+  if (height < 0 && !parseDefine(source, base + "_height", height)) fail("no height given for ", name);
+  if (width <= 0 || width > 255 || height <= 0 || height > 255) fail("sprites are 1 to 255 pixels wide and tall: ", name);
+
+  std::string outBase = outName ? outName : base + "_sprite";
+  Pixels image = readPixels(loadArray(source, name), width, height, columns, name);
+  Pixels mask;
+  if (maskName) mask = readPixels(loadArray(source, maskName), width, height, columns, maskName);
+
+  uint8_t flags = maskName ? SPRITE_MASKED : opaque ? SPRITE_OPAQUE : 0;
+  int     pages = (height + 7) / 8;
+
+  printf("// %s packed by extras/host/spriteconvert, see OLEDDisplay.h for the format\n", name);
+  printf("const uint8_t %s[] PROGMEM = {\n", outBase.c_str());
+  printf("  0x%02X, // Width: %d\n", width, width);
+  printf("  0x%02X, // Height: %d\n", height, height);
+  printf("  0x%02X, // Flags:%s%s\n", flags, flags & SPRITE_MASKED ? " SPRITE_MASKED" : flags & SPRITE_OPAQUE ? " SPRITE_OPAQUE" : "", flags ? "" : " 0");
+
+  for (int page = 0; page < pages; page++) {
+    std::vector<uint8_t> row;
+    for (int x = 0; x < width; x++) {
+      uint8_t byte = pageByte(image, page, x);
+      if (maskName) {
+        uint8_t maskByte = pageByte(mask, page, x);
+        row.push_back(byte & maskByte);
+        row.push_back(maskByte);
+      } else {
+        row.push_back(byte);
+      }
+    }
+    printf("\n  // Page %d\n", page);
+    for (size_t at = 0; at < row.size(); at += 16) {
+      size_t length = row.size() - at < 16 ? row.size() - at : 16;
+      printBytes(&row[at], length, page == pages - 1 && at + length == row.size(), NULL);
+    }
+  }
+  printf("};\n");
+
+  fprintf(stderr, "%s: %d bytes\n", outBase.c_str(), (int) (SPRITE_DATA_START + pages * width * (maskName ? 2 : 1)));
+  return 0;
+}
@@ -0,0 +1,196 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+// Host tests of OLEDDisplay behaviour the benchmarks and the example
+// sketches don't pin down, mostly text with multi-byte UTF-8 chars.
+//
+//   tests [name]
+//
+// Prints a line for every failed check and exits with 1 if there was one.
+// Only tests whose name contains `name` run.
+
+#include "MemoryDisplay.h"
+
+static const char *filter = NULL;
+static int failures = 0;
+
+#define CHECK(condition) check((condition), #condition, __FILE__, __LINE__)
+
+static void check(bool passed, const char *condition, const char *file, int line) {
+  if (passed) return;
+  printf("%s:%d: failed: %s\n", file, line, condition);
+  failures++;
+}
+
+static void run(const char *name, void (*test)(void)) {
+  if (filter != NULL && strstr(name, filter) == NULL) return;
+  int failed = failures;
+  test();
+  printf("%-40s %s\n", name, failures == failed ? "ok" : "FAILED");
+}
+
+static bool sameBuffer(MemoryDisplay &a, MemoryDisplay &b) {
+  return memcmp(a.buffer, b.buffer, a.getWidth() * a.getHeight() / 8) == 0;
+}
+
+// Font table indexes of ArialMT_Plain_10 are Latin-1
+static uint8_t latin1(const uint8_t ch) {
+  return ch;
+}
+
+// Draws `lines`, given as font table indexes, one below the other
+static void drawLines(MemoryDisplay &display, const char **lines, uint8_t count) {
+  display.setFontTableLookupFunction(latin1);
+  for (uint8_t line = 0; line < count; line++) {
+    display.drawString(0, line * 13, lines[line]);
+  }
+}
+
+static void testUtf8String(void) {
+  MemoryDisplay utf8, expected;
+  utf8.init();
+  expected.init();
+
+  utf8.drawString(0, 0, "\xc3\xa4\xc3\xb6\xc3\xbc \xe2\x82\xac 5");
+  const char *line[] = { "\xe4\xf6\xfc \x80 5" };
+  drawLines(expected, line, 1);
+  CHECK(sameBuffer(utf8, expected));
+  CHECK(utf8.getStringWidth("\xc3\xa4\xc3\xb6\xc3\xbc") == expected.getStringWidth("\xe4\xf6\xfc"));
+}
+
+static void testUtf8MaxWidth(void) {
+  struct {
+    uint16_t    maxWidth;
+    const char *text;
+    uint8_t     count;
+    const char *lines[4];
+  } cases[] = {
+    // No space to break on, the char that doesn't fit starts the next line
+    { 13, "\xc3\xa4\xc3\xb6\xc3\xbc\xc3\xa4\xc3\xb6", 3, { "\xe4\xf6", "\xfc\xe4", "\xf6" } },
+    { 19, "\xc3\xa4\xc3\xb6\xc3\xbc\xc3\xa4\xc3\xb6", 2, { "\xe4\xf6\xfc", "\xe4\xf6" } },
+    { 40, "Gr\xc3\xbc\xc3\x9f" "e aus K\xc3\xb6ln", 3, { "Gr\xfc\xdf" "e", "aus", "K\xf6ln" } },
+    { 30, "\xe2\x82\xac 12 f\xc3\xbcr \xe2\x82\xac 5", 3, { "\x80 12", "f\xfcr \x80", "5" } },
+  };
+
+  for (uint8_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+    MemoryDisplay utf8, flash, expected;
+    utf8.init();
+    flash.init();
+    expected.init();
+
+    utf8.drawStringMaxWidth(0, 0, cases[c].maxWidth, cases[c].text);
+    drawLines(expected, cases[c].lines, cases[c].count);
+    CHECK(sameBuffer(utf8, expected));
+
+    // Again, from the layout cache
+    utf8.clear();
+    utf8.drawStringMaxWidth(0, 0, cases[c].maxWidth, cases[c].text);
+    CHECK(sameBuffer(utf8, expected));
+
+    flash.drawStringMaxWidth(0, 0, cases[c].maxWidth, F(cases[c].text));
+    CHECK(sameBuffer(flash, expected));
+  }
+}
+
+static void testMaxWidthLookupFunction(void) {
+  MemoryDisplay display, utf8, latin;
+  display.init();
+  utf8.init();
+  latin.init();
+
+  // Each byte of the UTF-8 text is a glyph of its own with latin1, so the
+  // line breaks cached for the first call don't fit the second one
+  const char *text = "\xc3\xa4\xc3\xb6\xc3\xbc\xc3\xa4\xc3\xb6";
+  display.drawStringMaxWidth(0, 0, 19, text);
+  utf8.drawStringMaxWidth(0, 0, 19, text);
+  CHECK(sameBuffer(display, utf8));
+
+  display.clear();
+  display.setFontTableLookupFunction(latin1);
+  display.drawStringMaxWidth(0, 0, 19, text);
+  latin.setFontTableLookupFunction(latin1);
+  latin.drawStringMaxWidth(0, 0, 19, text);
+  CHECK(sameBuffer(display, latin));
+  CHECK(!sameBuffer(display, utf8));
+}
+
+static void testUtf8AfterDanglingLeadByte(void) {
+  MemoryDisplay display, expected;
+  display.init();
+  expected.init();
+
+  // Text ending in the lead byte of a char must not change the next one
+  const char *line[] = { "\xe4x" };
+  drawLines(expected, line, 1);
+  display.getStringWidth("abc\xc3");
+  CHECK(display.getStringWidth("\xc3\xa4x") == expected.getStringWidth(line[0]));
+  display.getStringWidth("abc\xc3");
+  display.drawString(0, 0, "\xc3\xa4x");
+  CHECK(sameBuffer(display, expected));
+}
+
+static void testUtf8LogBuffer(void) {
+  MemoryDisplay display, expected;
+  display.init();
+  expected.init();
+  display.setLogBuffer(2, 20);
+  expected.setLogBuffer(2, 20);
+
+  // Drawing text between the bytes of a char must not change it
+  const char *text = "\xc3\xa4 \xe2\x82\xac";
+  for (const char *ch = text; *ch; ch++) {
+    display.write((uint8_t) *ch);
+    display.drawString(0, 40, "\xc3\x9f\xc3");
+  }
+  display.clear();
+  display.drawLogBuffer(0, 0);
+
+  expected.print(text);
+  expected.drawLogBuffer(0, 0);
+  CHECK(sameBuffer(display, expected));
+
+  const char *line[] = { "\xe4 \x80" };
+  MemoryDisplay latin;
+  latin.init();
+  drawLines(latin, line, 1);
+  CHECK(sameBuffer(expected, latin));
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1) filter = argv[1];
+
+  run("utf8 drawString", testUtf8String);
+  run("utf8 drawStringMaxWidth", testUtf8MaxWidth);
+  run("drawStringMaxWidth lookup function", testMaxWidthLookupFunction);
+  run("utf8 after a dangling lead byte", testUtf8AfterDanglingLeadByte);
+  run("utf8 log buffer", testUtf8LogBuffer);
+
+  return failures ? 1 : 0;
+}
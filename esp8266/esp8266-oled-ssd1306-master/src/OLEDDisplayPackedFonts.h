@@ -0,0 +1,1279 @@
+#ifndef OLEDDISPLAYPACKEDFONTS_h
+#define OLEDDISPLAYPACKEDFONTS_h
+
+// ArialMT_Plain_10 from OLEDDisplayFonts.h packed by extras/host/fontconvert, see OLEDDisplay.h for the format
+const uint8_t ArialMT_Plain_10[] PROGMEM = {
+  0x8A, // Width: 10, packed
+  0x0D, // Height: 13
+  0x20, // First Char: 32
+  0xE0, // Numbers of Chars: 224
+
+  // Glyph Table:
+  0x03,0x00, // 32
+  0x03,0x04, // 33
+  0x04,0x05, // 34
+  0x06,0x08, // 35
+  0x06,0x08, // 36
+  0x09,0x0A, // 37
+  0x07,0x0A, // 38
+  0x02,0x04, // 39
+  0x03,0x07, // 40
+  0x03,0x07, // 41
+  0x04,0x05, // 42
+  0x06,0x07, // 43
+  0x03,0x04, // 44
+  0x03,0x04, // 45
+  0x03,0x04, // 46
+  0x03,0x06, // 47
+  0x06,0x08, // 48
+  0x06,0x06, // 49
+  0x06,0x08, // 50
+  0x06,0x08, // 51
+  0x06,0x09, // 52
+  0x06,0x08, // 53
+  0x06,0x08, // 54
+  0x06,0x08, // 55
+  0x06,0x08, // 56
+  0x06,0x08, // 57
+  0x03,0x04, // 58
+  0x03,0x04, // 59
+  0x06,0x06, // 60
+  0x06,0x05, // 61
+  0x06,0x06, // 62
+  0x06,0x09, // 63
+  0x0A,0x0E, // 64
+  0x07,0x0A, // 65
+  0x07,0x08, // 66
+  0x07,0x08, // 67
+  0x07,0x08, // 68
+  0x07,0x08, // 69
+  0x06,0x07, // 70
+  0x08,0x09, // 71
+  0x07,0x08, // 72
+  0x03,0x04, // 73
+  0x05,0x07, // 74
+  0x07,0x09, // 75
+  0x06,0x08, // 76
+  0x08,0x0A, // 77
+  0x07,0x08, // 78
+  0x08,0x09, // 79
+  0x07,0x08, // 80
+  0x08,0x09, // 81
+  0x07,0x08, // 82
+  0x07,0x08, // 83
+  0x06,0x08, // 84
+  0x07,0x08, // 85
+  0x07,0x0A, // 86
+  0x09,0x0B, // 87
+  0x07,0x0A, // 88
+  0x07,0x0A, // 89
+  0x06,0x09, // 90
+  0x03,0x06, // 91
+  0x03,0x06, // 92
+  0x03,0x06, // 93
+  0x05,0x06, // 94
+  0x06,0x04, // 95
+  0x03,0x04, // 96
+  0x06,0x06, // 97
+  0x06,0x07, // 98
+  0x05,0x06, // 99
+  0x06,0x07, // 100
+  0x06,0x06, // 101
+  0x03,0x06, // 102
+  0x06,0x07, // 103
+  0x06,0x07, // 104
+  0x02,0x04, // 105
+  0x02,0x06, // 106
+  0x05,0x07, // 107
+  0x02,0x04, // 108
+  0x08,0x08, // 109
+  0x06,0x06, // 110
+  0x06,0x06, // 111
+  0x06,0x07, // 112
+  0x06,0x07, // 113
+  0x03,0x05, // 114
+  0x05,0x06, // 115
+  0x03,0x06, // 116
+  0x06,0x06, // 117
+  0x05,0x07, // 118
+  0x07,0x08, // 119
+  0x05,0x07, // 120
+  0x05,0x08, // 121
+  0x05,0x07, // 122
+  0x03,0x07, // 123
+  0x03,0x05, // 124
+  0x03,0x07, // 125
+  0x06,0x05, // 126
+  0x00,0x00, // 127
+  0x0A,0x00, // 128
+  0x0A,0x00, // 129
+  0x0A,0x00, // 130
+  0x0A,0x00, // 131
+  0x0A,0x00, // 132
+  0x0A,0x00, // 133
+  0x0A,0x00, // 134
+  0x0A,0x00, // 135
+  0x0A,0x00, // 136
+  0x0A,0x00, // 137
+  0x0A,0x00, // 138
+  0x0A,0x00, // 139
+  0x0A,0x00, // 140
+  0x0A,0x00, // 141
+  0x0A,0x00, // 142
+  0x0A,0x00, // 143
+  0x0A,0x00, // 144
+  0x0A,0x00, // 145
+  0x0A,0x00, // 146
+  0x0A,0x00, // 147
+  0x0A,0x00, // 148
+  0x0A,0x00, // 149
+  0x0A,0x00, // 150
+  0x0A,0x00, // 151
+  0x0A,0x00, // 152
+  0x0A,0x00, // 153
+  0x0A,0x00, // 154
+  0x0A,0x00, // 155
+  0x0A,0x00, // 156
+  0x0A,0x00, // 157
+  0x0A,0x00, // 158
+  0x0A,0x00, // 159
+  0x03,0x00, // 160
+  0x03,0x04, // 161
+  0x06,0x08, // 162
+  0x06,0x09, // 163
+  0x06,0x05, // 164
+  0x06,0x08, // 165
+  0x03,0x05, // 166
+  0x06,0x09, // 167
+  0x03,0x04, // 168
+  0x07,0x0A, // 169
+  0x04,0x05, // 170
+  0x06,0x05, // 171
+  0x06,0x05, // 172
+  0x03,0x04, // 173
+  0x07,0x0A, // 174
+  0x06,0x04, // 175
+  0x04,0x05, // 176
+  0x05,0x07, // 177
+  0x03,0x05, // 178
+  0x03,0x05, // 179
+  0x03,0x04, // 180
+  0x06,0x07, // 181
+  0x05,0x09, // 182
+  0x03,0x04, // 183
+  0x03,0x04, // 184
+  0x03,0x04, // 185
+  0x04,0x05, // 186
+  0x06,0x05, // 187
+  0x08,0x0A, // 188
+  0x08,0x0A, // 189
+  0x08,0x0A, // 190
+  0x06,0x07, // 191
+  0x07,0x0C, // 192
+  0x07,0x0C, // 193
+  0x07,0x0C, // 194
+  0x07,0x0C, // 195
+  0x07,0x0B, // 196
+  0x07,0x0B, // 197
+  0x0A,0x0B, // 198
+  0x07,0x0A, // 199
+  0x07,0x0A, // 200
+  0x07,0x0A, // 201
+  0x07,0x0A, // 202
+  0x07,0x09, // 203
+  0x03,0x06, // 204
+  0x03,0x06, // 205
+  0x03,0x06, // 206
+  0x03,0x07, // 207
+  0x07,0x09, // 208
+  0x07,0x0A, // 209
+  0x08,0x0B, // 210
+  0x08,0x0B, // 211
+  0x08,0x0B, // 212
+  0x08,0x0B, // 213
+  0x08,0x0A, // 214
+  0x06,0x07, // 215
+  0x08,0x09, // 216
+  0x07,0x0A, // 217
+  0x07,0x0A, // 218
+  0x07,0x0A, // 219
+  0x07,0x09, // 220
+  0x07,0x0C, // 221
+  0x07,0x08, // 222
+  0x06,0x08, // 223
+  0x06,0x07, // 224
+  0x06,0x07, // 225
+  0x06,0x07, // 226
+  0x06,0x07, // 227
+  0x06,0x07, // 228
+  0x06,0x08, // 229
+  0x09,0x08, // 230
+  0x05,0x07, // 231
+  0x06,0x07, // 232
+  0x06,0x07, // 233
+  0x06,0x07, // 234
+  0x06,0x07, // 235
+  0x03,0x05, // 236
+  0x03,0x05, // 237
+  0x03,0x06, // 238
+  0x03,0x06, // 239
+  0x06,0x07, // 240
+  0x06,0x07, // 241
+  0x06,0x07, // 242
+  0x06,0x07, // 243
+  0x06,0x07, // 244
+  0x06,0x07, // 245
+  0x06,0x07, // 246
+  0x05,0x07, // 247
+  0x06,0x06, // 248
+  0x06,0x07, // 249
+  0x06,0x07, // 250
+  0x06,0x07, // 251
+  0x06,0x07, // 252
+  0x05,0x0A, // 253
+  0x06,0x08, // 254
+  0x05,0x09, // 255
+
+  // Font Data:
+  0x43,0x07,0x01,0x5F, // 33
+  0x03,0x03,0x03,0xC7,0x01, // 34
+  0x03,0x07,0x05,0x74,0xCE,0x9D,0x73,0x01, // 35
+  0x03,0x08,0x05,0x26,0x45,0xFF,0x49,0x32, // 36
+  0x43,0x07,0x07,0x86,0x84,0x19,0x63,0x4B,0xC2,0x00, // 37
+  0x03,0x07,0x07,0x30,0x65,0xB3,0x3A,0x82,0x43,0x01, // 38
+  0x03,0x03,0x01,0x07, // 39
+  0x03,0x09,0x03,0x7C,0x04,0x05,0x04, // 40
+  0x03,0x09,0x03,0x01,0x05,0xF1,0x01, // 41
+  0x03,0x03,0x03,0x5D,0x01, // 42
+  0x04,0x05,0x05,0x84,0x7C,0x42,0x00, // 43
+  0x49,0x02,0x01,0x03, // 44
+  0x07,0x01,0x02,0x03, // 45
+  0x49,0x01,0x01,0x01, // 46
+  0x03,0x07,0x03,0x60,0xCE,0x00, // 47
+  0x03,0x07,0x05,0xBE,0x60,0x30,0xE8,0x03, // 48
+  0x43,0x07,0x03,0x04,0xC1,0x1F, // 49
+  0x03,0x07,0x05,0xC2,0x70,0x34,0x69,0x04, // 50
+  0x03,0x07,0x05,0xA2,0x60,0x32,0x69,0x03, // 51
+  0x03,0x07,0x06,0x18,0x8A,0x24,0xF2,0x87,0x00, // 52
+  0x03,0x07,0x05,0xAC,0x63,0xB1,0x98,0x03, // 53
+  0x03,0x07,0x05,0xBE,0x62,0xB1,0xA8,0x03, // 54
+  0x03,0x07,0x05,0x81,0x70,0xE6,0x10,0x00, // 55
+  0x03,0x07,0x05,0xB6,0x64,0x32,0x69,0x03, // 56
+  0x03,0x07,0x05,0xAE,0x68,0x34,0xEA,0x03, // 57
+  0x45,0x05,0x01,0x11, // 58
+  0x45,0x06,0x01,0x31, // 59
+  0x44,0x05,0x04,0x44,0xA9,0x08, // 60
+  0x05,0x03,0x05,0x6D,0x5B, // 61
+  0x44,0x05,0x04,0x51,0x29,0x02, // 62
+  0x03,0x07,0x06,0x82,0x40,0x20,0x9B,0x30,0x00, // 63
+  0x43,0x09,0x09,0x78,0x0C,0xE9,0x2C,0x5A,0x34,0x6F,0x53,0x51,0x9C,0x00, // 64
+  0x03,0x07,0x07,0x40,0x9C,0x25,0x62,0xC1,0x01,0x01, // 65
+  0x43,0x07,0x05,0xFF,0x64,0x32,0xE9,0x03, // 66
+  0x43,0x07,0x05,0xBE,0x60,0x30,0x28,0x02, // 67
+  0x43,0x07,0x05,0xFF,0x60,0x50,0xC4,0x01, // 68
+  0x43,0x07,0x05,0xFF,0x64,0x32,0x99,0x04, // 69
+  0x43,0x07,0x04,0xFF,0x44,0x22,0x00, // 70
+  0x43,0x07,0x06,0x1C,0x51,0x30,0xA9,0xC2,0x00, // 71
+  0x43,0x07,0x05,0x7F,0x04,0x02,0xF1,0x07, // 72
+  0x43,0x07,0x01,0x7F, // 73
+  0x03,0x07,0x04,0x60,0x20,0xF0,0x07, // 74
+  0x43,0x07,0x06,0x7F,0x08,0x43,0x12,0x02,0x02, // 75
+  0x43,0x07,0x05,0x7F,0x20,0x10,0x08,0x04, // 76
+  0x43,0x07,0x07,0x7F,0x03,0x0E,0x88,0x33,0xFC,0x01, // 77
+  0x43,0x07,0x05,0x7F,0x03,0x02,0xF6,0x07, // 78
+  0x43,0x07,0x06,0xBE,0x60,0x30,0x18,0xF4,0x01, // 79
+  0x43,0x07,0x05,0xFF,0x44,0x22,0x61,0x00, // 80
+  0x43,0x07,0x06,0xBE,0x60,0x30,0x1C,0xF6,0x02, // 81
+  0x43,0x07,0x05,0xFF,0x44,0x22,0x63,0x06, // 82
+  0x43,0x07,0x05,0xA6,0x64,0x32,0x29,0x03, // 83
+  0x43,0x07,0x05,0x81,0xC0,0x3F,0x10,0x00, // 84
+  0x43,0x07,0x05,0x3F,0x20,0x10,0xF8,0x03, // 85
+  0x03,0x07,0x07,0x01,0x07,0x0C,0x08,0x73,0x04,0x00, // 86
+  0x03,0x07,0x09,0x03,0x1E,0xD0,0x17,0xF0,0x01,0x79,0x03, // 87
+  0x03,0x07,0x07,0xC0,0x90,0x84,0x21,0x09,0x01,0x01, // 88
+  0x03,0x07,0x07,0x01,0x01,0x01,0x4F,0x10,0x04,0x00, // 89
+  0x03,0x07,0x06,0xE1,0x68,0xB6,0x79,0x1C,0x02, // 90
+  0x43,0x09,0x02,0xFF,0x03,0x02, // 91
+  0x03,0x07,0x03,0x03,0x0E,0x18, // 92
+  0x03,0x09,0x02,0x01,0xFF,0x03, // 93
+  0x03,0x04,0x05,0x68,0x61,0x08, // 94
+  0x0B,0x01,0x06,0x3F, // 95
+  0x03,0x02,0x02,0x09, // 96
+  0x45,0x05,0x04,0xB8,0xD6,0x0F, // 97
+  0x43,0x07,0x04,0x7F,0x22,0x11,0x07, // 98
+  0x45,0x05,0x04,0x2E,0x46,0x05, // 99
+  0x43,0x07,0x04,0x38,0x22,0xF1,0x0F, // 100
+  0x45,0x05,0x04,0xAE,0x56,0x0B, // 101
+  0x03,0x07,0x03,0x04,0x7F,0x01, // 102
+  0x45,0x07,0x04,0xAE,0x68,0xF4,0x07, // 103
+  0x43,0x07,0x04,0x7F,0x02,0x01,0x0F, // 104
+  0x43,0x07,0x01,0x7D, // 105
+  0x03,0x09,0x02,0x00,0xFB,0x01, // 106
+  0x03,0x07,0x04,0x7F,0x08,0x8E,0x08, // 107
+  0x43,0x07,0x01,0x7F, // 108
+  0x45,0x05,0x07,0x3F,0x84,0x1F,0x82,0x07, // 109
+  0x45,0x05,0x04,0x3F,0x04,0x0F, // 110
+  0x45,0x05,0x04,0x2E,0x46,0x07, // 111
+  0x45,0x07,0x04,0xFF,0x48,0xC4,0x01, // 112
+  0x45,0x07,0x04,0x8E,0x48,0xE4,0x0F, // 113
+  0x45,0x05,0x02,0x3F,0x00, // 114
+  0x05,0x05,0x04,0xB2,0xD6,0x04, // 115
+  0x03,0x07,0x03,0x84,0x3F,0x11, // 116
+  0x45,0x05,0x04,0x0F,0xC2,0x0F, // 117
+  0x05,0x05,0x05,0xC1,0x41,0x17,0x00, // 118
+  0x05,0x05,0x07,0x0F,0xBA,0xE0,0xE0,0x03, // 119
+  0x05,0x05,0x05,0x51,0x11,0x15,0x01, // 120
+  0x05,0x07,0x05,0x01,0x27,0xCC,0x11,0x00, // 121
+  0x05,0x05,0x05,0x31,0xD7,0x19,0x01, // 122
+  0x03,0x09,0x03,0x10,0xDE,0x07,0x04, // 123
+  0x43,0x09,0x01,0xFF,0x01, // 124
+  0x03,0x09,0x03,0x01,0xDF,0x43,0x00, // 125
+  0x06,0x02,0x05,0xB7,0x03, // 126
+  0x45,0x07,0x01,0x7D, // 161
+  0x43,0x09,0x04,0x38,0xE8,0x3F,0x41,0x01, // 162
+  0x03,0x07,0x06,0x48,0x77,0x36,0x19,0x14,0x02, // 163
+  0x45,0x04,0x04,0x9F,0xF9, // 164
+  0x03,0x07,0x05,0x29,0x17,0xDE,0x95,0x02, // 165
+  0x43,0x09,0x01,0xE7,0x01, // 166
+  0x03,0x09,0x05,0x9A,0x4A,0xA6,0x4C,0x2A,0x0B, // 167
+  0x03,0x01,0x03,0x05, // 168
+  0x03,0x07,0x07,0x1C,0x51,0xB2,0x5A,0x15,0x71,0x00, // 169
+  0x03,0x04,0x04,0xDD,0xFD, // 170
+  0x46,0x04,0x04,0x96,0x96, // 171
+  0x05,0x03,0x05,0x49,0x72, // 172
+  0x07,0x01,0x02,0x03, // 173
+  0x03,0x07,0x07,0x1C,0x51,0xB7,0x99,0x15,0x71,0x00, // 174
+  0x01,0x01,0x06,0x3F, // 175
+  0x43,0x03,0x03,0xEF,0x01, // 176
+  0x04,0x06,0x05,0x24,0xF9,0x93,0x24, // 177
+  0x03,0x04,0x03,0xD9,0x0B, // 178
+  0x03,0x04,0x03,0xB9,0x0D, // 179
+  0x43,0x02,0x02,0x06, // 180
+  0x45,0x07,0x04,0x7F,0x08,0xE4,0x03, // 181
+  0x03,0x09,0x05,0x0E,0xFE,0x07,0xF8,0x1F,0x00, // 182
+  0x46,0x01,0x01,0x01, // 183
+  0x4A,0x03,0x02,0x35, // 184
+  0x43,0x04,0x02,0xF2, // 185
+  0x03,0x04,0x04,0x96,0x69, // 186
+  0x46,0x04,0x04,0x69,0x69, // 187
+  0x43,0x07,0x07,0xC2,0x17,0x86,0x24,0xCB,0x83,0x00, // 188
+  0x43,0x07,0x07,0xC2,0x17,0x84,0xA1,0x4C,0x63,0x01, // 189
+  0x03,0x07,0x08,0x89,0x45,0x1B,0xC2,0x92,0xE5,0x41, // 190
+  0x45,0x07,0x04,0x30,0x64,0x13,0x04, // 191
+  0x00,0x0A,0x07,0x00,0x02,0x07,0x4B,0x22,0xB2,0x00,0x07,0x20, // 192
+  0x00,0x0A,0x07,0x00,0x02,0x07,0x8B,0x22,0xB1,0x00,0x07,0x20, // 193
+  0x00,0x0A,0x07,0x00,0x02,0x27,0x4B,0x22,0xB2,0x00,0x07,0x20, // 194
+  0x00,0x0A,0x07,0x00,0x0A,0x17,0x8B,0x22,0xB1,0x00,0x07,0x20, // 195
+  0x01,0x09,0x07,0x00,0xC1,0x65,0x21,0x92,0x05,0x1C,0x40, // 196
+  0x01,0x09,0x07,0x00,0xC1,0x7D,0x29,0xF2,0x05,0x1C,0x40, // 197
+  0x03,0x07,0x09,0x60,0x0C,0x67,0x12,0xF9,0x27,0x93,0x49, // 198
+  0x43,0x0A,0x05,0x3E,0x04,0x11,0x6C,0xD0,0x22,0x00, // 199
+  0x40,0x0A,0x05,0xF8,0x27,0xA9,0x24,0x92,0x48,0x02, // 200
+  0x40,0x0A,0x05,0xF8,0x23,0xA9,0x64,0x92,0x48,0x02, // 201
+  0x40,0x0A,0x05,0xFA,0x27,0xA9,0x24,0x92,0x48,0x02, // 202
+  0x41,0x09,0x05,0xFC,0x4B,0x92,0x2C,0x49,0x12, // 203
+  0x40,0x0A,0x02,0xF9,0x0B,0x00, // 204
+  0x00,0x0A,0x02,0x02,0xE4,0x0F, // 205
+  0x00,0x0A,0x02,0x01,0xE8,0x0F, // 206
+  0x01,0x09,0x03,0x01,0xF8,0x07,0x00, // 207
+  0x03,0x07,0x06,0x88,0x7F,0x32,0x29,0xE2,0x00, // 208
+  0x40,0x0A,0x05,0xFA,0xC7,0x20,0x44,0x60,0xF8,0x03, // 209
+  0x40,0x0A,0x06,0xF0,0x21,0x98,0xA0,0x82,0x08,0xC2,0x07, // 210
+  0x40,0x0A,0x06,0xF0,0x21,0xA8,0x60,0x82,0x08,0xC2,0x07, // 211
+  0x40,0x0A,0x06,0xF0,0x21,0xA8,0x60,0x82,0x0A,0xC2,0x07, // 212
+  0x40,0x0A,0x06,0xF0,0x29,0x98,0xA0,0x82,0x09,0xC2,0x07, // 213
+  0x41,0x09,0x06,0xF8,0x0A,0x12,0x2C,0x48,0x10,0x1F, // 214
+  0x04,0x05,0x05,0x51,0x39,0x15,0x01, // 215
+  0x43,0x07,0x06,0xDE,0x70,0xB6,0x38,0xEE,0x00, // 216
+  0x40,0x0A,0x05,0xF8,0x05,0x28,0x20,0x80,0xF8,0x01, // 217
+  0x40,0x0A,0x05,0xF8,0x09,0x18,0x20,0x80,0xF8,0x01, // 218
+  0x40,0x0A,0x05,0xF8,0x09,0x18,0xA0,0x80,0xF8,0x01, // 219
+  0x41,0x09,0x05,0xFC,0x02,0x02,0x0C,0xC8,0x0F, // 220
+  0x00,0x0A,0x07,0x08,0x40,0x00,0x82,0xF0,0x21,0x40,0x80,0x00, // 221
+  0x43,0x07,0x05,0x7F,0x91,0x48,0xC4,0x01, // 222
+  0x43,0x07,0x05,0xFE,0x50,0xD2,0x0A,0x03, // 223
+  0x42,0x08,0x04,0xC0,0xA9,0xAA,0xF8, // 224
+  0x42,0x08,0x04,0xC0,0xAA,0xA9,0xF8, // 225
+  0x42,0x08,0x04,0xC0,0xAA,0xA9,0xFA, // 226
+  0x42,0x08,0x04,0xC2,0xA9,0xAA,0xF9, // 227
+  0x43,0x07,0x04,0xE0,0x2A,0xB5,0x0F, // 228
+  0x41,0x09,0x04,0x80,0xAF,0x56,0xBD,0x0F, // 229
+  0x45,0x05,0x07,0xBA,0x56,0x57,0xAB,0x05, // 230
+  0x45,0x08,0x04,0x0E,0xB1,0xD1,0x0A, // 231
+  0x42,0x08,0x04,0x70,0xA9,0xAA,0xB0, // 232
+  0x42,0x08,0x04,0x70,0xAA,0xA9,0xB0, // 233
+  0x42,0x08,0x04,0x70,0xAA,0xA9,0xB2, // 234
+  0x43,0x07,0x04,0xB8,0x2A,0x35,0x0B, // 235
+  0x42,0x08,0x02,0xF9,0x02, // 236
+  0x02,0x08,0x02,0x02,0xF9, // 237
+  0x02,0x08,0x03,0x02,0xF9,0x02, // 238
+  0x03,0x07,0x03,0x01,0x7E,0x00, // 239
+  0x43,0x07,0x04,0xB8,0xE2,0x91,0x07, // 240
+  0x42,0x08,0x04,0xFA,0x09,0x0A,0xF1, // 241
+  0x42,0x08,0x04,0x70,0x89,0x8A,0x70, // 242
+  0x42,0x08,0x04,0x70,0x8A,0x89,0x70, // 243
+  0x42,0x08,0x04,0x70,0x8A,0x89,0x72, // 244
+  0x42,0x08,0x04,0x72,0x89,0x8A,0x71, // 245
+  0x43,0x07,0x04,0xB8,0x22,0x31,0x07, // 246
+  0x04,0x05,0x05,0x84,0x54,0x42,0x00, // 247
+  0x45,0x05,0x04,0xB6,0xCF,0x06, // 248
+  0x42,0x08,0x04,0x78,0x81,0x82,0xF8, // 249
+  0x42,0x08,0x04,0x78,0x82,0x81,0xF8, // 250
+  0x42,0x08,0x04,0x7A,0x81,0x82,0xF8, // 251
+  0x43,0x07,0x04,0xBC,0x20,0xB0,0x0F, // 252
+  0x02,0x0A,0x05,0x08,0xC0,0x29,0x58,0x1C,0x08,0x00, // 253
+  0x43,0x09,0x04,0xFF,0x89,0x10,0xC1,0x01, // 254
+  0x03,0x09,0x05,0x04,0x72,0x02,0xCB,0x41,0x00 // 255
+};
+
+// ArialMT_Plain_16 from OLEDDisplayFonts.h packed by extras/host/fontconvert, see OLEDDisplay.h for the format
+const uint8_t ArialMT_Plain_16[] PROGMEM = {
+  0x90, // Width: 16, packed
+  0x13, // Height: 19
+  0x20, // First Char: 32
+  0xE0, // Numbers of Chars: 224
+
+  // Glyph Table:
+  0x04,0x00, // 32
+  0x04,0x05, // 33
+  0x06,0x05, // 34
+  0x09,0x11, // 35
+  0x09,0x10, // 36
+  0x0E,0x15, // 37
+  0x0B,0x11, // 38
+  0x03,0x04, // 39
+  0x05,0x09, // 40
+  0x05,0x09, // 41
+  0x06,0x07, // 42
+  0x09,0x0A, // 43
+  0x04,0x04, // 44
+  0x05,0x04, // 45
+  0x04,0x04, // 46
+  0x04,0x09, // 47
+  0x09,0x0E, // 48
+  0x09,0x09, // 49
+  0x09,0x0E, // 50
+  0x09,0x0E, // 51
+  0x09,0x0F, // 52
+  0x09,0x0E, // 53
+  0x09,0x0E, // 54
+  0x09,0x0E, // 55
+  0x09,0x0E, // 56
+  0x09,0x0E, // 57
+  0x04,0x05, // 58
+  0x04,0x05, // 59
+  0x09,0x0A, // 60
+  0x09,0x08, // 61
+  0x09,0x0A, // 62
+  0x09,0x0E, // 63
+  0x10,0x20, // 64
+  0x0B,0x11, // 65
+  0x0B,0x11, // 66
+  0x0C,0x12, // 67
+  0x0C,0x12, // 68
+  0x0B,0x11, // 69
+  0x0A,0x0F, // 70
+  0x0C,0x12, // 71
+  0x0C,0x11, // 72
+  0x04,0x05, // 73
+  0x08,0x0C, // 74
+  0x0B,0x11, // 75
+  0x09,0x0E, // 76
+  0x0D,0x14, // 77
+  0x0C,0x11, // 78
+  0x0C,0x12, // 79
+  0x0B,0x11, // 80
+  0x0C,0x12, // 81
+  0x0C,0x11, // 82
+  0x0B,0x11, // 83
+  0x0A,0x11, // 84
+  0x0C,0x11, // 85
+  0x0B,0x11, // 86
+  0x0F,0x1A, // 87
+  0x0B,0x14, // 88
+  0x0B,0x11, // 89
+  0x0A,0x11, // 90
+  0x04,0x09, // 91
+  0x04,0x09, // 92
+  0x04,0x09, // 93
+  0x08,0x09, // 94
+  0x09,0x05, // 95
+  0x05,0x04, // 96
+  0x09,0x0B, // 97
+  0x09,0x0E, // 98
+  0x08,0x0A, // 99
+  0x09,0x0E, // 100
+  0x09,0x0B, // 101
+  0x04,0x09, // 102
+  0x09,0x0E, // 103
+  0x09,0x0C, // 104
+  0x04,0x05, // 105
+  0x04,0x07, // 106
+  0x08,0x0E, // 107
+  0x04,0x05, // 108
+  0x0D,0x10, // 109
+  0x09,0x0A, // 110
+  0x09,0x0B, // 111
+  0x09,0x0E, // 112
+  0x09,0x0E, // 113
+  0x05,0x08, // 114
+  0x08,0x0A, // 115
+  0x04,0x09, // 116
+  0x09,0x0A, // 117
+  0x08,0x0B, // 118
+  0x0C,0x10, // 119
+  0x08,0x0B, // 120
+  0x08,0x0E, // 121
+  0x08,0x0B, // 122
+  0x05,0x0D, // 123
+  0x04,0x05, // 124
+  0x05,0x0D, // 125
+  0x09,0x05, // 126
+  0x00,0x00, // 127
+  0x10,0x00, // 128
+  0x10,0x00, // 129
+  0x10,0x00, // 130
+  0x10,0x00, // 131
+  0x10,0x00, // 132
+  0x10,0x00, // 133
+  0x10,0x00, // 134
+  0x10,0x00, // 135
+  0x10,0x00, // 136
+  0x10,0x00, // 137
+  0x10,0x00, // 138
+  0x10,0x00, // 139
+  0x10,0x00, // 140
+  0x10,0x00, // 141
+  0x10,0x00, // 142
+  0x10,0x00, // 143
+  0x10,0x00, // 144
+  0x10,0x00, // 145
+  0x10,0x00, // 146
+  0x10,0x00, // 147
+  0x10,0x00, // 148
+  0x10,0x00, // 149
+  0x10,0x00, // 150
+  0x10,0x00, // 151
+  0x10,0x00, // 152
+  0x10,0x00, // 153
+  0x10,0x00, // 154
+  0x10,0x00, // 155
+  0x10,0x00, // 156
+  0x10,0x00, // 157
+  0x10,0x00, // 158
+  0x10,0x00, // 159
+  0x04,0x00, // 160
+  0x05,0x05, // 161
+  0x09,0x11, // 162
+  0x09,0x0F, // 163
+  0x09,0x08, // 164
+  0x09,0x11, // 165
+  0x04,0x05, // 166
+  0x09,0x12, // 167
+  0x05,0x04, // 168
+  0x0C,0x15, // 169
+  0x06,0x07, // 170
+  0x09,0x09, // 171
+  0x09,0x08, // 172
+  0x05,0x04, // 173
+  0x0C,0x15, // 174
+  0x09,0x05, // 175
+  0x06,0x05, // 176
+  0x09,0x0C, // 177
+  0x05,0x07, // 178
+  0x05,0x07, // 179
+  0x05,0x04, // 180
+  0x09,0x0E, // 181
+  0x09,0x14, // 182
+  0x05,0x04, // 183
+  0x05,0x05, // 184
+  0x05,0x06, // 185
+  0x06,0x07, // 186
+  0x09,0x09, // 187
+  0x0D,0x15, // 188
+  0x0D,0x15, // 189
+  0x0D,0x17, // 190
+  0x0A,0x0F, // 191
+  0x0B,0x14, // 192
+  0x0B,0x14, // 193
+  0x0B,0x14, // 194
+  0x0B,0x14, // 195
+  0x0B,0x13, // 196
+  0x0B,0x13, // 197
+  0x10,0x1A, // 198
+  0x0C,0x16, // 199
+  0x0B,0x14, // 200
+  0x0B,0x14, // 201
+  0x0B,0x14, // 202
+  0x0B,0x13, // 203
+  0x04,0x07, // 204
+  0x04,0x07, // 205
+  0x04,0x0B, // 206
+  0x04,0x09, // 207
+  0x0C,0x14, // 208
+  0x0C,0x14, // 209
+  0x0C,0x16, // 210
+  0x0C,0x16, // 211
+  0x0C,0x16, // 212
+  0x0C,0x16, // 213
+  0x0C,0x15, // 214
+  0x09,0x0A, // 215
+  0x0C,0x12, // 216
+  0x0C,0x14, // 217
+  0x0C,0x14, // 218
+  0x0C,0x14, // 219
+  0x0C,0x13, // 220
+  0x0B,0x14, // 221
+  0x0B,0x11, // 222
+  0x0A,0x0E, // 223
+  0x09,0x0E, // 224
+  0x09,0x0E, // 225
+  0x09,0x0E, // 226
+  0x09,0x0E, // 227
+  0x09,0x0D, // 228
+  0x09,0x0F, // 229
+  0x0E,0x12, // 230
+  0x08,0x0C, // 231
+  0x09,0x0E, // 232
+  0x09,0x0E, // 233
+  0x09,0x0E, // 234
+  0x09,0x0D, // 235
+  0x04,0x06, // 236
+  0x04,0x06, // 237
+  0x04,0x09, // 238
+  0x04,0x08, // 239
+  0x09,0x0E, // 240
+  0x09,0x0C, // 241
+  0x09,0x0E, // 242
+  0x09,0x0E, // 243
+  0x09,0x0E, // 244
+  0x09,0x0E, // 245
+  0x09,0x0D, // 246
+  0x09,0x08, // 247
+  0x0A,0x0B, // 248
+  0x09,0x0C, // 249
+  0x09,0x0C, // 250
+  0x09,0x0C, // 251
+  0x09,0x0C, // 252
+  0x08,0x11, // 253
+  0x09,0x11, // 254
+  0x08,0x10, // 255
+
+  // Font Data:
+  0x83,0x0C,0x01,0xFF,0x0B, // 33
+  0x43,0x04,0x04,0x0F,0xF0, // 34
+  0x03,0x0C,0x09,0x10,0x01,0xF1,0xF8,0x71,0x11,0x10,0x01,0xF1,0xF8,0x71,0x11,0x10,0x01, // 35
+  0x42,0x0E,0x07,0x38,0x04,0x11,0x22,0x04,0xFD,0xFF,0x82,0x10,0x21,0x82,0x70,0x00, // 36
+  0x43,0x0C,0x0C,0x1E,0x10,0x02,0x21,0x10,0xC2,0x1E,0x03,0x0C,0x38,0x60,0x78,0x41,0x08,0x84,0x40,0x08,0x78, // 37
+  0x43,0x0C,0x09,0x80,0xE3,0x44,0x31,0x18,0x86,0x91,0xE8,0x50,0x00,0x02,0x50,0x80,0x08, // 38
+  0x43,0x04,0x01,0x0F, // 39
+  0x43,0x0F,0x03,0xF0,0x07,0x07,0x5C,0x00,0x10, // 40
+  0x43,0x0F,0x03,0x01,0x40,0x07,0x1C,0xFC,0x01, // 41
+  0x03,0x05,0x05,0x42,0x1F,0x2D,0x00, // 42
+  0x46,0x07,0x07,0x08,0x04,0xE2,0x8F,0x40,0x20,0x00, // 43
+  0x8E,0x03,0x01,0x07, // 44
+  0x0B,0x01,0x04,0x0F, // 45
+  0x8E,0x01,0x01,0x01, // 46
+  0x03,0x0C,0x04,0x00,0x0C,0x3C,0x3C,0x30,0x00, // 47
+  0x43,0x0C,0x07,0xFC,0x23,0x40,0x01,0x18,0x80,0x01,0x28,0x40,0xFC,0x03, // 48
+  0x83,0x0C,0x04,0x08,0x40,0x00,0x02,0xF0,0xFF, // 49
+  0x43,0x0C,0x07,0x04,0x28,0xC0,0x01,0x1A,0x90,0x81,0x28,0x86,0x1C,0x08, // 50
+  0x43,0x0C,0x07,0x04,0x22,0x40,0x21,0x18,0x82,0x31,0xE8,0x45,0x80,0x03, // 51
+  0x03,0x0C,0x08,0x80,0x01,0x14,0x20,0x81,0x11,0x04,0x21,0x10,0xFF,0x0F,0x10, // 52
+  0x43,0x0C,0x07,0x38,0x72,0x41,0x11,0x18,0x81,0x11,0x18,0x42,0xC1,0x03, // 53
+  0x43,0x0C,0x07,0xFC,0x23,0x42,0x11,0x18,0x81,0x11,0x28,0x42,0xC4,0x03, // 54
+  0x43,0x0C,0x07,0x01,0x10,0x00,0x01,0x1F,0x0E,0x19,0x50,0x00,0x03,0x00, // 55
+  0x43,0x0C,0x07,0x8C,0x23,0x45,0x21,0x18,0x82,0x21,0x28,0x45,0x8C,0x03, // 56
+  0x43,0x0C,0x07,0x3C,0x22,0x44,0x81,0x18,0x88,0x81,0x28,0x44,0xFC,0x03, // 57
+  0x46,0x09,0x01,0x01,0x01, // 58
+  0x46,0x0B,0x01,0x01,0x07, // 59
+  0x46,0x07,0x07,0x08,0x0A,0x45,0x24,0x12,0x05,0x01, // 60
+  0x47,0x05,0x07,0x31,0xC6,0x18,0x63,0x04, // 61
+  0x46,0x07,0x07,0x41,0x91,0x48,0x44,0xA1,0x20,0x00, // 62
+  0x43,0x0C,0x07,0x0C,0x20,0x00,0x01,0x10,0xB8,0x41,0x20,0x02,0x1C,0x00, // 63
+  0x43,0x0F,0x0F,0xE0,0x07,0x0C,0x04,0x01,0x44,0x78,0x24,0x42,0x8A,0x40,0x26,0x20,0x13,0x90,0x09,0xC4,0xC8,0x67,0x1E,0x52,0x00,0x29,0x40,0x62,0x10,0xC1,0x47,0x00, // 64
+  0x43,0x0C,0x09,0x00,0x0C,0x38,0xF0,0xE0,0x08,0x81,0xE0,0x08,0xF0,0x00,0x38,0x00,0x0C, // 65
+  0x43,0x0C,0x09,0xFF,0x1F,0x82,0x21,0x18,0x82,0x21,0x18,0x82,0x21,0x28,0x45,0x8C,0x03, // 66
+  0x43,0x0C,0x0A,0xF8,0x41,0x20,0x02,0x14,0x80,0x01,0x18,0x80,0x01,0x18,0x80,0x02,0x44,0x20, // 67
+  0x43,0x0C,0x0A,0xFF,0x1F,0x80,0x01,0x18,0x80,0x01,0x18,0x80,0x01,0x28,0x40,0x04,0x82,0x1F, // 68
+  0x43,0x0C,0x09,0xFF,0x1F,0x82,0x21,0x18,0x82,0x21,0x18,0x82,0x21,0x18,0x82,0x01,0x08, // 69
+  0x43,0x0C,0x08,0xFF,0x1F,0x04,0x41,0x10,0x04,0x41,0x10,0x04,0x41,0x10,0x00, // 70
+  0x43,0x0C,0x0A,0xF8,0x41,0x20,0x02,0x14,0x80,0x01,0x18,0x84,0x41,0x28,0x44,0x44,0x02,0x1C, // 71
+  0x43,0x0C,0x09,0xFF,0x0F,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0xFF,0x0F, // 72
+  0x43,0x0C,0x01,0xFF,0x0F, // 73
+  0x43,0x0C,0x06,0x00,0x07,0x80,0x00,0x08,0x80,0x00,0xF8,0x7F, // 74
+  0x43,0x0C,0x09,0xFF,0x0F,0x08,0x40,0x00,0x02,0x70,0x80,0x08,0x04,0x23,0x40,0x01,0x08, // 75
+  0x43,0x0C,0x07,0xFF,0x0F,0x80,0x00,0x08,0x80,0x00,0x08,0x80,0x00,0x08, // 76
+  0x43,0x0C,0x0B,0xFF,0x6F,0x00,0x18,0x00,0x06,0x80,0x03,0xC0,0x80,0x03,0x06,0x18,0x60,0x00,0xFF,0x0F, // 77
+  0x43,0x0C,0x09,0xFF,0x2F,0x00,0x0C,0x00,0x01,0x60,0x00,0x08,0x00,0x03,0x40,0xFF,0x0F, // 78
+  0x43,0x0C,0x0A,0xF8,0x41,0x20,0x02,0x14,0x80,0x01,0x18,0x80,0x01,0x28,0x40,0x04,0x82,0x1F, // 79
+  0x43,0x0C,0x09,0xFF,0x1F,0x04,0x41,0x10,0x04,0x41,0x10,0x04,0x41,0x20,0x02,0x1C,0x00, // 80
+  0x43,0x0C,0x0A,0xF8,0x41,0x20,0x02,0x14,0x80,0x01,0x18,0xA0,0x01,0x2A,0x40,0x04,0x8E,0x9F, // 81
+  0x43,0x0C,0x09,0xFF,0x1F,0x04,0x41,0x10,0x04,0x41,0x10,0x0C,0x41,0x23,0x42,0x1C,0x08, // 82
+  0x43,0x0C,0x09,0x0C,0x22,0x41,0x21,0x18,0x82,0x21,0x18,0x84,0x41,0x28,0x44,0x84,0x03, // 83
+  0x03,0x0C,0x09,0x01,0x10,0x00,0x01,0x10,0x00,0xFF,0x1F,0x00,0x01,0x10,0x00,0x01,0x00, // 84
+  0x43,0x0C,0x09,0xFF,0x03,0x40,0x00,0x08,0x80,0x00,0x08,0x80,0x00,0x08,0x40,0xFF,0x03, // 85
+  0x43,0x0C,0x09,0x03,0xC0,0x01,0xE0,0x00,0x30,0x00,0x0C,0x30,0xE0,0xC0,0x01,0x03,0x00, // 86
+  0x03,0x0C,0x0F,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x80,0x03,0x07,0x0E,0x10,0x00,0x0E,0x00,0x07,0x80,0x03,0xC0,0xC0,0xC3,0x03,0x03,0x00, // 87
+  0x03,0x0C,0x0B,0x00,0x18,0x40,0x02,0xC2,0x18,0x50,0x00,0x02,0x50,0xC0,0x18,0x02,0x12,0x40,0x00,0x08, // 88
+  0x03,0x0C,0x09,0x01,0x60,0x00,0x08,0x00,0x03,0xC0,0x0F,0x03,0x08,0x60,0x00,0x01,0x00, // 89
+  0x03,0x0C,0x09,0x00,0x18,0xC0,0x01,0x1B,0x88,0x61,0x18,0x81,0x0D,0x38,0x80,0x01,0x08, // 90
+  0x43,0x0F,0x03,0xFF,0xFF,0x00,0x60,0x00,0x10, // 91
+  0x03,0x0C,0x04,0x03,0xC0,0x03,0xC0,0x03,0xC0, // 92
+  0x03,0x0F,0x03,0x01,0xC0,0x00,0xE0,0xFF,0x1F, // 93
+  0x03,0x06,0x07,0x20,0x66,0x04,0x06,0x06,0x02, // 94
+  0x11,0x01,0x09,0xFF,0x01, // 95
+  0x43,0x02,0x02,0x09, // 96
+  0x46,0x09,0x07,0xE4,0x24,0x46,0x8C,0x98,0x30,0x91,0x7F, // 97
+  0x43,0x0C,0x07,0xFF,0x0F,0x41,0x08,0x88,0x80,0x08,0x08,0x41,0xE0,0x03, // 98
+  0x46,0x09,0x06,0x7C,0x04,0x05,0x0C,0x18,0x50,0x10, // 99
+  0x43,0x0C,0x07,0xE0,0x03,0x41,0x08,0x88,0x80,0x08,0x08,0x41,0xFF,0x0F, // 100
+  0x46,0x09,0x07,0x7C,0x24,0x45,0x8C,0x18,0x51,0x12,0x17, // 101
+  0x03,0x0C,0x04,0x08,0xE0,0xFF,0x09,0x90,0x00, // 102
+  0x46,0x0C,0x07,0x7C,0x24,0x88,0x01,0x19,0x90,0x01,0x29,0x48,0xFF,0x03, // 103
+  0x43,0x0C,0x06,0xFF,0x0F,0x01,0x08,0x80,0x00,0x08,0x00,0xFF, // 104
+  0x43,0x0C,0x01,0xF9,0x0F, // 105
+  0x03,0x0F,0x02,0x00,0xC0,0xFC,0x1F, // 106
+  0x43,0x0C,0x07,0xFF,0x0F,0x10,0x80,0x00,0x0C,0x20,0x03,0x41,0x08,0x08, // 107
+  0x43,0x0C,0x01,0xFF,0x0F, // 108
+  0x46,0x09,0x0B,0xFF,0x05,0x04,0x08,0x10,0xC0,0xBF,0x80,0x00,0x01,0x02,0xF8,0x07, // 109
+  0x46,0x09,0x06,0xFF,0x05,0x04,0x08,0x10,0xC0,0x3F, // 110
+  0x46,0x09,0x07,0x7C,0x04,0x05,0x0C,0x18,0x50,0x10,0x1F, // 111
+  0x46,0x0C,0x07,0xFF,0x2F,0x08,0x01,0x11,0x10,0x01,0x21,0x08,0x7C,0x00, // 112
+  0x46,0x0C,0x07,0x7C,0x20,0x08,0x01,0x11,0x10,0x01,0x21,0x08,0xFF,0x0F, // 113
+  0x46,0x09,0x04,0xFF,0x05,0x04,0x08,0x00, // 114
+  0x46,0x09,0x06,0x8E,0x22,0x46,0x8C,0x18,0x51,0x1C, // 115
+  0x04,0x0B,0x04,0x04,0xF8,0x3F,0x01,0x09,0x08, // 116
+  0x46,0x09,0x06,0xFF,0x00,0x02,0x04,0x08,0xE8,0x3F, // 117
+  0x06,0x09,0x07,0x03,0x18,0xC0,0x01,0x0C,0x87,0xC1,0x00, // 118
+  0x06,0x09,0x0B,0x03,0xF8,0x00,0x86,0xC3,0x60,0x00,0x03,0x38,0x80,0xF9,0x0C,0x00, // 119
+  0x06,0x09,0x07,0x01,0x05,0xB1,0x81,0xC0,0x46,0x50,0x40, // 120
+  0x06,0x0C,0x07,0x07,0x80,0x81,0xE0,0x08,0x78,0xE0,0xC0,0x01,0x03,0x00, // 121
+  0x06,0x09,0x07,0x01,0x03,0x87,0x8D,0xD8,0x70,0x60,0x40, // 122
+  0x03,0x0F,0x05,0x80,0x00,0x40,0x80,0xDF,0x2F,0x00,0x18,0x00,0x04, // 123
+  0x43,0x0F,0x01,0xFF,0x7F, // 124
+  0x03,0x0F,0x05,0x01,0xC0,0x00,0xA0,0xDF,0x0F,0x10,0x00,0x08,0x00, // 125
+  0x08,0x02,0x08,0x56,0x6A, // 126
+  0x86,0x0C,0x01,0xFD,0x0F, // 161
+  0x43,0x0F,0x07,0xE0,0x03,0x08,0x32,0x82,0x07,0x39,0x81,0x83,0xB8,0x20,0x80,0x08,0x00, // 162
+  0x03,0x0C,0x08,0x20,0xC8,0x63,0xE2,0x15,0x42,0x21,0x14,0x80,0x02,0x48,0x40, // 163
+  0x46,0x06,0x06,0xAD,0x14,0x86,0x52,0x0B, // 164
+  0x03,0x0C,0x09,0x41,0x21,0x14,0x4C,0x01,0x17,0xC0,0x0F,0x17,0x4C,0x21,0x14,0x41,0x01, // 165
+  0x43,0x0F,0x01,0x3F,0x7E, // 166
+  0x03,0x0F,0x08,0xC0,0x10,0x97,0x50,0x86,0x30,0x42,0x18,0x42,0x0C,0x61,0x1A,0xE9,0x00,0x03, // 167
+  0x03,0x01,0x03,0x05, // 168
+  0x03,0x0C,0x0C,0xF8,0x41,0x20,0x02,0x94,0x8F,0x05,0x59,0x90,0x05,0x59,0x90,0x89,0x28,0x40,0x04,0x82,0x1F, // 169
+  0x03,0x06,0x05,0x5A,0x5A,0x96,0x3E, // 170
+  0x47,0x07,0x06,0x08,0x5B,0x10,0x61,0x0B,0x02, // 171
+  0x47,0x05,0x07,0x21,0x84,0x10,0xC2,0x07, // 172
+  0x0B,0x01,0x04,0x0F, // 173
+  0x03,0x0C,0x0C,0xF8,0x41,0x20,0x02,0xD4,0x9F,0x25,0x58,0x82,0x65,0x58,0x8A,0x19,0x29,0x40,0x04,0x82,0x1F, // 174
+  0x02,0x01,0x09,0xFF,0x01, // 175
+  0x43,0x04,0x04,0x96,0x69, // 176
+  0x45,0x0A,0x07,0x08,0x22,0x88,0xE0,0x9F,0x08,0x22,0x88,0x20, // 177
+  0x03,0x06,0x05,0x62,0x9C,0xA6,0x26, // 178
+  0x03,0x06,0x05,0x52,0x18,0x96,0x1B, // 179
+  0x83,0x02,0x02,0x06, // 180
+  0x46,0x0C,0x07,0xFF,0x0F,0x08,0x00,0x01,0x10,0x00,0x01,0x08,0xFF,0x01, // 181
+  0x03,0x0F,0x09,0x1E,0x80,0x0F,0xC0,0x0F,0xE0,0x07,0xF0,0xFF,0x0F,0x00,0x04,0x00,0xFE,0xFF,0x01,0x00, // 182
+  0x89,0x01,0x01,0x01, // 183
+  0x4F,0x03,0x03,0xAC,0x01, // 184
+  0x43,0x06,0x03,0x42,0xF0,0x03, // 185
+  0x03,0x06,0x05,0x5E,0x18,0x86,0x1E, // 186
+  0x87,0x07,0x06,0x41,0x1B,0x22,0x68,0x43,0x00, // 187
+  0x43,0x0C,0x0C,0x02,0x10,0x80,0x3F,0x04,0x20,0x80,0x01,0x04,0x30,0x80,0x60,0x06,0x15,0x48,0xC0,0x0F,0x40, // 188
+  0x43,0x0C,0x0C,0x02,0x10,0x80,0x3F,0x06,0x10,0x80,0x00,0x06,0x10,0xC0,0x88,0x42,0x1C,0xA4,0x40,0x0A,0x98, // 189
+  0x03,0x0C,0x0D,0x12,0x10,0x02,0x21,0x58,0x42,0x1B,0x03,0x08,0x60,0x00,0x01,0x08,0x66,0x50,0x81,0x04,0xFC,0x00,0x04, // 190
+  0x46,0x0C,0x08,0x80,0x03,0x44,0x20,0xD8,0x81,0x00,0x08,0x80,0x00,0x04,0x30, // 191
+  0x40,0x0F,0x09,0x00,0x60,0x00,0x0E,0xE0,0x21,0x8E,0xA0,0x40,0x80,0x23,0x00,0x1E,0x00,0x38,0x00,0x60, // 192
+  0x40,0x0F,0x09,0x00,0x60,0x00,0x0E,0xE0,0x01,0x8E,0xA0,0x40,0x88,0x23,0x00,0x1E,0x00,0x38,0x00,0x60, // 193
+  0x40,0x0F,0x09,0x00,0x60,0x00,0x0E,0xE0,0x41,0x8E,0x90,0x40,0x88,0x23,0x08,0x1E,0x00,0x38,0x00,0x60, // 194
+  0x40,0x0F,0x09,0x00,0x60,0x00,0x0E,0xE0,0x41,0x8E,0x90,0x40,0x90,0x23,0x04,0x1E,0x00,0x38,0x00,0x60, // 195
+  0x41,0x0E,0x09,0x00,0x30,0x80,0x03,0x3C,0xE4,0x08,0x04,0x42,0x8E,0x00,0x3C,0x00,0x38,0x00,0x30, // 196
+  0x41,0x0E,0x09,0x00,0x30,0x80,0x03,0x3C,0xFC,0x08,0x05,0xC2,0x8F,0x00,0x3C,0x00,0x38,0x00,0x30, // 197
+  0x03,0x0C,0x0F,0x00,0x0C,0x30,0xC0,0x00,0x0B,0x8C,0x30,0x08,0x81,0x10,0x08,0xFF,0x1F,0x82,0x21,0x18,0x82,0x21,0x18,0x82,0x21,0x08, // 198
+  0x43,0x0F,0x0A,0xF8,0x01,0x02,0x81,0x00,0x21,0x00,0x11,0x80,0x0C,0xC0,0x06,0xA0,0x03,0x10,0x02,0x04,0x02,0x01, // 199
+  0x40,0x0F,0x09,0xF8,0x7F,0x84,0x20,0x42,0x10,0x21,0x98,0x10,0x54,0x08,0x22,0x04,0x11,0x82,0x08,0x40, // 200
+  0x40,0x0F,0x09,0xF8,0x7F,0x84,0x20,0x42,0x10,0x21,0xA8,0x10,0x4C,0x08,0x22,0x04,0x11,0x82,0x08,0x40, // 201
+  0x40,0x0F,0x09,0xF8,0x7F,0x84,0x20,0x42,0x50,0x21,0x98,0x10,0x4C,0x08,0x2A,0x04,0x11,0x82,0x08,0x40, // 202
+  0x41,0x0E,0x09,0xFC,0x3F,0x21,0x48,0x08,0x16,0x82,0x84,0x60,0x21,0x48,0x08,0x12,0x82,0x04,0x20, // 203
+  0x00,0x0F,0x02,0x01,0x00,0xFD,0x3F, // 204
+  0x40,0x0F,0x02,0xFA,0xFF,0x00,0x00, // 205
+  0x00,0x0F,0x04,0x02,0x80,0xFC,0x7F,0x00,0x40,0x00,0x00, // 206
+  0x01,0x0E,0x03,0x01,0x00,0xFF,0x1F,0x00,0x00, // 207
+  0x03,0x0C,0x0B,0x40,0xF0,0xFF,0x41,0x18,0x84,0x41,0x18,0x84,0x01,0x18,0x80,0x02,0x44,0x20,0xF8,0x01, // 208
+  0x40,0x0F,0x09,0xF8,0x7F,0x08,0x00,0x18,0x40,0x10,0x10,0x30,0x10,0x20,0x04,0x60,0x00,0x40,0xF8,0x7F, // 209
+  0x40,0x0F,0x0A,0xC0,0x0F,0x10,0x08,0x04,0x08,0x01,0x98,0x00,0x54,0x00,0x22,0x00,0x21,0x40,0x20,0x10,0xE0,0x07, // 210
+  0x40,0x0F,0x0A,0xC0,0x0F,0x10,0x08,0x04,0x08,0x01,0xA8,0x00,0x4C,0x00,0x22,0x00,0x21,0x40,0x20,0x10,0xE0,0x07, // 211
+  0x40,0x0F,0x0A,0xC0,0x0F,0x10,0x08,0x04,0x48,0x01,0x98,0x00,0x4C,0x00,0x2A,0x00,0x21,0x40,0x20,0x10,0xE0,0x07, // 212
+  0x40,0x0F,0x0A,0xC0,0x0F,0x10,0x08,0x04,0x48,0x01,0x98,0x00,0x54,0x00,0x26,0x00,0x21,0x40,0x20,0x10,0xE0,0x07, // 213
+  0x41,0x0E,0x0A,0xE0,0x07,0x04,0x82,0x00,0x11,0x80,0x05,0x20,0x01,0x58,0x00,0x22,0x40,0x10,0x08,0xF8,0x01, // 214
+  0x46,0x07,0x07,0x41,0x11,0x85,0x43,0x11,0x05,0x01, // 215
+  0x43,0x0C,0x0A,0xF8,0x49,0x60,0x02,0x16,0x98,0x41,0x18,0x82,0x19,0x68,0x40,0x06,0x92,0x1F, // 216
+  0x40,0x0F,0x09,0xF8,0x1F,0x00,0x10,0x00,0x30,0x00,0x28,0x00,0x04,0x00,0x02,0x00,0x01,0x40,0xF8,0x1F, // 217
+  0x40,0x0F,0x09,0xF8,0x1F,0x00,0x10,0x00,0x10,0x00,0x28,0x00,0x0C,0x00,0x02,0x00,0x01,0x40,0xF8,0x1F, // 218
+  0x40,0x0F,0x09,0xF8,0x1F,0x00,0x10,0x00,0x50,0x00,0x18,0x00,0x0C,0x00,0x0A,0x00,0x01,0x40,0xF8,0x1F, // 219
+  0x41,0x0E,0x09,0xFC,0x0F,0x00,0x04,0x00,0x06,0x80,0x00,0x60,0x00,0x08,0x00,0x02,0x40,0xFC,0x0F, // 220
+  0x00,0x0F,0x09,0x08,0x00,0x18,0x00,0x10,0x00,0x30,0x20,0xE0,0x0F,0x0C,0x00,0x01,0x60,0x00,0x08,0x00, // 221
+  0x43,0x0C,0x09,0xFF,0x4F,0x20,0x04,0x42,0x20,0x04,0x42,0x20,0x04,0x82,0x10,0xF0,0x00, // 222
+  0x43,0x0C,0x07,0xFC,0x2F,0x00,0x01,0x14,0x87,0x4E,0x08,0x88,0x00,0x07, // 223
+  0x43,0x0C,0x07,0x20,0x07,0x89,0x88,0x98,0x88,0x4A,0x88,0x44,0xF0,0x0F, // 224
+  0x43,0x0C,0x07,0x20,0x07,0x89,0x88,0xA8,0x88,0x49,0x88,0x44,0xF0,0x0F, // 225
+  0x43,0x0C,0x07,0x20,0x07,0x89,0x8A,0x98,0x88,0x49,0xA8,0x44,0xF0,0x0F, // 226
+  0x43,0x0C,0x07,0x20,0x07,0x89,0x8A,0x98,0x88,0x4A,0x98,0x44,0xF0,0x0F, // 227
+  0x44,0x0B,0x07,0x90,0x43,0x62,0x11,0x89,0x58,0x42,0x12,0xE1,0x1F, // 228
+  0x42,0x0D,0x07,0x40,0x0E,0x24,0x5E,0xC4,0x8A,0x78,0x09,0x21,0x11,0xF8,0x07, // 229
+  0x46,0x09,0x0D,0xE4,0x24,0x46,0x8C,0x98,0x30,0x91,0x3F,0x49,0x11,0x23,0x46,0x94,0xC4,0x05, // 230
+  0x46,0x0C,0x06,0x7C,0x20,0x08,0x01,0x19,0xB0,0x01,0x2D,0x08, // 231
+  0x43,0x0C,0x07,0xE0,0x03,0x49,0x89,0xA8,0x88,0x88,0x08,0x49,0xE0,0x02, // 232
+  0x43,0x0C,0x07,0xE0,0x03,0x49,0x88,0xA8,0x88,0x89,0x08,0x49,0xE0,0x02, // 233
+  0x43,0x0C,0x07,0xE0,0x03,0x49,0x8A,0x98,0x88,0x89,0x28,0x49,0xE0,0x02, // 234
+  0x44,0x0B,0x07,0xF0,0x41,0x52,0x11,0x89,0x58,0x44,0x24,0xC1,0x05, // 235
+  0x03,0x0C,0x02,0x01,0xA0,0xFF, // 236
+  0x43,0x0C,0x02,0xFA,0x1F,0x00, // 237
+  0x03,0x0C,0x04,0x02,0x90,0xFF,0x01,0x20,0x00, // 238
+  0x04,0x0B,0x03,0x01,0xE0,0x7F,0x00,0x00, // 239
+  0x43,0x0C,0x07,0xE0,0x43,0x41,0x0D,0xB8,0x80,0x0E,0xD8,0x41,0xE0,0x03, // 240
+  0x43,0x0C,0x06,0xF8,0x2F,0x01,0x09,0xA0,0x00,0x09,0x00,0xFF, // 241
+  0x43,0x0C,0x07,0xE0,0x03,0x41,0x09,0xA8,0x80,0x08,0x08,0x41,0xE0,0x03, // 242
+  0x43,0x0C,0x07,0xE0,0x03,0x41,0x08,0xA8,0x80,0x09,0x08,0x41,0xE0,0x03, // 243
+  0x43,0x0C,0x07,0xE0,0x03,0x41,0x0A,0x98,0x80,0x09,0x28,0x41,0xE0,0x03, // 244
+  0x43,0x0C,0x07,0xE0,0x03,0x41,0x0A,0x98,0x80,0x0A,0x18,0x41,0xE0,0x03, // 245
+  0x44,0x0B,0x07,0xF0,0x41,0x50,0x01,0x09,0x58,0x40,0x04,0xC1,0x07, // 246
+  0x47,0x05,0x07,0x84,0x90,0x4A,0x08,0x01, // 247
+  0x46,0x09,0x07,0x7C,0x85,0x85,0x8C,0x98,0xD0,0x50,0x1F, // 248
+  0x43,0x0C,0x06,0xF8,0x07,0x80,0x01,0x28,0x80,0x00,0x84,0xFF, // 249
+  0x43,0x0C,0x06,0xF8,0x07,0x80,0x00,0x28,0x80,0x01,0x84,0xFF, // 250
+  0x43,0x0C,0x06,0xF8,0x27,0x80,0x01,0x18,0x80,0x02,0x84,0xFF, // 251
+  0x44,0x0B,0x06,0xFD,0x03,0x60,0x00,0x01,0x08,0x20,0xFE,0x03, // 252
+  0x03,0x0F,0x07,0x38,0x00,0x60,0x20,0xC0,0x51,0x80,0x17,0x70,0x00,0x07,0x60,0x00,0x00, // 253
+  0x43,0x0F,0x07,0xFF,0x7F,0x08,0x02,0x02,0x02,0x01,0x81,0x80,0x80,0x20,0x80,0x0F,0x00, // 254
+  0x04,0x0E,0x07,0x1C,0x00,0x18,0x18,0x38,0x02,0x78,0x81,0x03,0x1C,0xC0,0x00,0x00 // 255
+};
+
+// ArialMT_Plain_24 from OLEDDisplayFonts.h packed by extras/host/fontconvert, see OLEDDisplay.h for the format
+const uint8_t ArialMT_Plain_24[] PROGMEM = {
+  0x98, // Width: 24, packed
+  0x1C, // Height: 28
+  0x20, // First Char: 32
+  0xE0, // Numbers of Chars: 224
+
+  // Glyph Table:
+  0x07,0x00, // 32
+  0x07,0x08, // 33
+  0x09,0x08, // 34
+  0x0D,0x1F, // 35
+  0x0D,0x1F, // 36
+  0x15,0x2C, // 37
+  0x10,0x21, // 38
+  0x05,0x05, // 39
+  0x08,0x14, // 40
+  0x08,0x14, // 41
+  0x09,0x0A, // 42
+  0x0E,0x15, // 43
+  0x07,0x05, // 44
+  0x08,0x05, // 45
+  0x07,0x04, // 46
+  0x07,0x12, // 47
+  0x0D,0x1B, // 48
+  0x0D,0x10, // 49
+  0x0D,0x1B, // 50
+  0x0D,0x1B, // 51
+  0x0D,0x1B, // 52
+  0x0D,0x1B, // 53
+  0x0D,0x1B, // 54
+  0x0D,0x1B, // 55
+  0x0D,0x1B, // 56
+  0x0D,0x1B, // 57
+  0x07,0x07, // 58
+  0x07,0x08, // 59
+  0x0E,0x13, // 60
+  0x0E,0x0D, // 61
+  0x0E,0x13, // 62
+  0x0D,0x1B, // 63
+  0x18,0x40, // 64
+  0x10,0x23, // 65
+  0x10,0x1F, // 66
+  0x11,0x23, // 67
+  0x11,0x21, // 68
+  0x10,0x1F, // 69
+  0x0F,0x1D, // 70
+  0x13,0x25, // 71
+  0x11,0x1F, // 72
+  0x07,0x08, // 73
+  0x0C,0x17, // 74
+  0x10,0x21, // 75
+  0x0D,0x19, // 76
+  0x14,0x23, // 77
+  0x11,0x1F, // 78
+  0x13,0x28, // 79
+  0x10,0x1F, // 80
+  0x13,0x2A, // 81
+  0x11,0x21, // 82
+  0x10,0x21, // 83
+  0x0F,0x21, // 84
+  0x11,0x1F, // 85
+  0x10,0x23, // 86
+  0x17,0x34, // 87
+  0x10,0x23, // 88
+  0x10,0x25, // 89
+  0x0F,0x21, // 90
+  0x07,0x0E, // 91
+  0x07,0x12, // 92
+  0x07,0x0E, // 93
+  0x0B,0x0F, // 94
+  0x0D,0x07, // 95
+  0x08,0x05, // 96
+  0x0D,0x15, // 97
+  0x0D,0x1B, // 98
+  0x0C,0x14, // 99
+  0x0D,0x1B, // 100
+  0x0D,0x15, // 101
+  0x07,0x12, // 102
+  0x0D,0x1C, // 103
+  0x0D,0x19, // 104
+  0x05,0x08, // 105
+  0x05,0x0E, // 106
+  0x0C,0x19, // 107
+  0x05,0x08, // 108
+  0x14,0x1D, // 109
+  0x0D,0x14, // 110
+  0x0D,0x15, // 111
+  0x0D,0x1C, // 112
+  0x0D,0x1C, // 113
+  0x08,0x0D, // 114
+  0x0C,0x14, // 115
+  0x07,0x12, // 116
+  0x0D,0x14, // 117
+  0x0C,0x15, // 118
+  0x11,0x1F, // 119
+  0x0C,0x15, // 120
+  0x0C,0x1A, // 121
+  0x0C,0x14, // 122
+  0x08,0x14, // 123
+  0x06,0x09, // 124
+  0x08,0x14, // 125
+  0x0E,0x09, // 126
+  0x00,0x00, // 127
+  0x18,0x00, // 128
+  0x18,0x00, // 129
+  0x18,0x00, // 130
+  0x18,0x00, // 131
+  0x18,0x00, // 132
+  0x18,0x00, // 133
+  0x18,0x00, // 134
+  0x18,0x00, // 135
+  0x18,0x00, // 136
+  0x18,0x00, // 137
+  0x18,0x00, // 138
+  0x18,0x00, // 139
+  0x18,0x00, // 140
+  0x18,0x00, // 141
+  0x18,0x00, // 142
+  0x18,0x00, // 143
+  0x18,0x00, // 144
+  0x18,0x00, // 145
+  0x18,0x00, // 146
+  0x18,0x00, // 147
+  0x18,0x00, // 148
+  0x18,0x00, // 149
+  0x18,0x00, // 150
+  0x18,0x00, // 151
+  0x18,0x00, // 152
+  0x18,0x00, // 153
+  0x18,0x00, // 154
+  0x18,0x00, // 155
+  0x18,0x00, // 156
+  0x18,0x00, // 157
+  0x18,0x00, // 158
+  0x18,0x00, // 159
+  0x07,0x00, // 160
+  0x08,0x08, // 161
+  0x0D,0x1F, // 162
+  0x0D,0x1D, // 163
+  0x0D,0x15, // 164
+  0x0D,0x1F, // 165
+  0x06,0x09, // 166
+  0x0D,0x22, // 167
+  0x08,0x05, // 168
+  0x12,0x2A, // 169
+  0x09,0x0A, // 170
+  0x0D,0x10, // 171
+  0x0E,0x0D, // 172
+  0x08,0x05, // 173
+  0x12,0x2A, // 174
+  0x0D,0x07, // 175
+  0x0A,0x0A, // 176
+  0x0D,0x18, // 177
+  0x08,0x0B, // 178
+  0x08,0x0B, // 179
+  0x08,0x05, // 180
+  0x0E,0x1A, // 181
+  0x0D,0x27, // 182
+  0x08,0x04, // 183
+  0x08,0x06, // 184
+  0x08,0x09, // 185
+  0x09,0x0B, // 186
+  0x0D,0x10, // 187
+  0x14,0x2C, // 188
+  0x14,0x2A, // 189
+  0x14,0x2C, // 190
+  0x0F,0x1C, // 191
+  0x10,0x2B, // 192
+  0x10,0x2B, // 193
+  0x10,0x2B, // 194
+  0x10,0x2B, // 195
+  0x10,0x29, // 196
+  0x10,0x2B, // 197
+  0x18,0x34, // 198
+  0x11,0x2B, // 199
+  0x10,0x26, // 200
+  0x10,0x26, // 201
+  0x10,0x26, // 202
+  0x10,0x24, // 203
+  0x07,0x0E, // 204
+  0x07,0x0E, // 205
+  0x07,0x13, // 206
+  0x07,0x12, // 207
+  0x11,0x25, // 208
+  0x11,0x26, // 209
+  0x13,0x30, // 210
+  0x13,0x30, // 211
+  0x13,0x30, // 212
+  0x13,0x30, // 213
+  0x13,0x2E, // 214
+  0x0E,0x0E, // 215
+  0x13,0x2C, // 216
+  0x11,0x26, // 217
+  0x11,0x26, // 218
+  0x11,0x26, // 219
+  0x11,0x24, // 220
+  0x10,0x2D, // 221
+  0x10,0x1F, // 222
+  0x0F,0x1D, // 223
+  0x0D,0x1B, // 224
+  0x0D,0x1B, // 225
+  0x0D,0x1B, // 226
+  0x0D,0x1B, // 227
+  0x0D,0x19, // 228
+  0x0D,0x1E, // 229
+  0x15,0x24, // 230
+  0x0C,0x19, // 231
+  0x0D,0x1B, // 232
+  0x0D,0x1B, // 233
+  0x0D,0x1B, // 234
+  0x0D,0x19, // 235
+  0x07,0x0C, // 236
+  0x07,0x0C, // 237
+  0x07,0x10, // 238
+  0x07,0x0F, // 239
+  0x0D,0x1B, // 240
+  0x0D,0x19, // 241
+  0x0D,0x1B, // 242
+  0x0D,0x1B, // 243
+  0x0D,0x1B, // 244
+  0x0D,0x1B, // 245
+  0x0D,0x19, // 246
+  0x0D,0x0F, // 247
+  0x0F,0x18, // 248
+  0x0D,0x19, // 249
+  0x0D,0x19, // 250
+  0x0D,0x19, // 251
+  0x0D,0x17, // 252
+  0x0C,0x1F, // 253
+  0x0D,0x1F, // 254
+  0x0C,0x1E, // 255
+
+  // Font Data:
+  0xC5,0x11,0x02,0xFF,0x9F,0xFF,0x3F,0x03, // 33
+  0x45,0x06,0x06,0xFF,0x0F,0x00,0xFF,0x0F, // 34
+  0x05,0x11,0x0D,0x60,0x18,0xC0,0x30,0x83,0xE1,0x07,0xFF,0xC3,0xFF,0xE1,0x0F,0xC3,0x18,0x66,0x30,0xFC,0xE0,0x7F,0xF8,0x3F,0xFC,0x61,0x18,0xC3,0x00,0x86,0x01, // 35
+  0x44,0x14,0x0B,0x78,0x60,0xC0,0x0F,0x1E,0x8C,0xC1,0x61,0x18,0x38,0x06,0x03,0xF3,0xFF,0xFF,0x06,0x03,0x63,0x60,0x38,0x0C,0x86,0xC1,0xC1,0x1F,0x10,0x78,0x00, // 36
+  0x45,0x11,0x13,0x7C,0x00,0xFC,0x01,0x0C,0x06,0x08,0x08,0x10,0x10,0x70,0x30,0xB8,0x3F,0x3C,0x3E,0x3E,0x00,0x1E,0x00,0x0F,0x80,0x07,0xC0,0xE3,0xE3,0xE1,0xEF,0x60,0x70,0x40,0x40,0x80,0x80,0x00,0x83,0x01,0xFC,0x01,0xF0,0x01, // 37
+  0x45,0x11,0x0E,0x00,0x3C,0x00,0xFC,0x70,0x9C,0xF3,0x1D,0x7E,0x1E,0x78,0x38,0xF0,0xF0,0xE0,0xB3,0xE3,0x7E,0xDC,0x38,0xF0,0x01,0xE0,0x01,0xF0,0x07,0x60,0x1C,0x00,0x10, // 38
+  0x45,0x06,0x02,0xFF,0x0F, // 39
+  0x45,0x16,0x06,0x80,0x7F,0x00,0xFC,0xFF,0xC0,0x07,0xF8,0x38,0x00,0x70,0x03,0x00,0x70,0x00,0x00,0x08, // 40
+  0x45,0x16,0x06,0x01,0x00,0xE0,0x00,0x00,0xEC,0x00,0xC0,0xF1,0x01,0x3E,0xF0,0xFF,0x03,0xE0,0x1F,0x00, // 41
+  0x45,0x07,0x08,0x04,0x12,0xFF,0xF3,0xE1,0x93,0x08, // 42
+  0x48,0x0C,0x0C,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0xF0,0xFF,0xFF,0x0F,0x06,0x60,0x00,0x06,0x60,0x00,0x06, // 43
+  0x94,0x06,0x02,0xF3,0x07, // 44
+  0x0F,0x02,0x07,0xFF,0x3F, // 45
+  0x94,0x02,0x02,0x0F, // 46
+  0x05,0x11,0x07,0x00,0x80,0x01,0xE0,0x03,0xFC,0x01,0x7F,0xC0,0x1F,0xE0,0x03,0xC0,0x00,0x00, // 47
+  0x45,0x11,0x0B,0xF0,0x1F,0xF8,0xFF,0x38,0x80,0x3B,0x00,0x3E,0x00,0x78,0x00,0xF0,0x00,0xE0,0x03,0xE0,0x0E,0xE0,0xF8,0xFF,0xC0,0x7F,0x00, // 48
+  0xC5,0x11,0x06,0x30,0x00,0x70,0x00,0x60,0x00,0x60,0x00,0xF0,0xFF,0xFF,0xFF,0x3F, // 49
+  0x45,0x11,0x0B,0x18,0x80,0x3D,0x80,0x1B,0x80,0x1F,0x80,0x3D,0x80,0x79,0x80,0xF1,0x80,0xE1,0x81,0xC1,0x86,0x81,0xFD,0x01,0xE3,0x01,0x06, // 50
+  0x45,0x11,0x0B,0x08,0x30,0x1C,0xE0,0x18,0x80,0x1B,0x00,0x3C,0x18,0x78,0x30,0xF0,0x60,0x60,0xE3,0xC0,0x7E,0xC3,0x78,0xFC,0x00,0xF0,0x00, // 51
+  0x45,0x11,0x0B,0x00,0x1C,0x00,0x3C,0x00,0x7E,0x00,0xCF,0x00,0x87,0x81,0x07,0x83,0x03,0x86,0xFF,0xFF,0xFF,0xFF,0x01,0x30,0x00,0x60,0x00, // 52
+  0x45,0x11,0x0B,0x80,0x31,0xF8,0xE3,0xFC,0x03,0x1B,0x02,0x3C,0x06,0x78,0x0C,0xF0,0x18,0xE0,0x31,0xC0,0xC3,0xE0,0x06,0xFF,0x00,0x7C,0x00, // 53
+  0x45,0x11,0x0B,0xE0,0x1F,0xF8,0xFF,0x78,0x8C,0x33,0x0C,0x3E,0x0C,0x78,0x18,0xF0,0x30,0xE0,0x61,0xC0,0x87,0xC1,0x1C,0xFF,0x30,0xF8,0x00, // 54
+  0x45,0x11,0x0B,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x3F,0xC0,0x7F,0xE0,0xC3,0xF0,0x80,0x39,0x00,0x1B,0x00,0x1E,0x00,0x0C,0x00,0x00, // 55
+  0x45,0x11,0x0B,0x00,0x3C,0x78,0xFC,0xF9,0x0D,0x3B,0x0E,0x3C,0x18,0x78,0x30,0xF0,0x60,0xE0,0xE3,0xC0,0x7E,0xC3,0x78,0xFC,0x01,0xF0,0x00, // 56
+  0x45,0x11,0x0B,0xF8,0x60,0xF8,0xC7,0x39,0x0C,0x1F,0x30,0x3C,0x60,0x78,0xC0,0xF0,0x80,0xE1,0x81,0x61,0x8E,0xF1,0xF8,0xFF,0xC0,0x3F,0x00, // 57
+  0x89,0x0D,0x02,0x03,0x78,0x00,0x03, // 58
+  0x89,0x11,0x02,0x03,0x98,0x07,0xF0,0x01, // 59
+  0x48,0x0B,0x0B,0x20,0x80,0x03,0x14,0xB0,0x81,0x0D,0xC6,0x30,0x86,0x20,0x06,0x33,0xD8,0x80,0x01, // 60
+  0x4A,0x07,0x0B,0xE3,0xF1,0x78,0x3C,0x1E,0x8F,0xC7,0xE3,0xF1,0x18, // 61
+  0x48,0x0B,0x0B,0x03,0x36,0x98,0xC1,0x08,0xC2,0x18,0xC6,0x60,0x03,0x1B,0x50,0x80,0x03,0x08,0x00, // 62
+  0x45,0x11,0x0B,0x18,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x30,0xC0,0x79,0xC0,0xF3,0xC0,0x81,0xC1,0x00,0xC6,0x01,0xFC,0x01,0xE0,0x00,0x00, // 63
+  0x45,0x16,0x16,0x00,0x7F,0x00,0xF0,0x7F,0x00,0x0F,0x78,0xE0,0x00,0x38,0x1C,0x3E,0x8C,0xE3,0x3F,0x67,0x1C,0x8C,0x99,0x01,0x66,0x73,0x80,0xF1,0x0C,0x60,0x3C,0x03,0x0C,0xCF,0x80,0xC1,0x63,0xF0,0xF0,0xF0,0x7F,0x7C,0xFF,0x18,0xDB,0x01,0xC6,0x0E,0xC0,0x18,0x07,0x38,0x86,0x83,0xC7,0xC0,0xFF,0x30,0xC0,0x0F,0x06,0x00,0x80,0x00, // 64
+  0x05,0x11,0x0F,0x00,0x80,0x01,0xE0,0x03,0xF0,0x01,0xFC,0x00,0xFF,0x80,0x8F,0xC1,0x07,0x83,0x01,0x06,0x1F,0x0C,0xF8,0x18,0xC0,0x3F,0x00,0xFC,0x00,0xC0,0x07,0x00,0x3E,0x00,0x60, // 65
+  0x85,0x11,0x0D,0xFF,0xFF,0xFF,0xFF,0x0F,0x06,0x1E,0x0C,0x3C,0x18,0x78,0x30,0xF0,0x60,0xE0,0xC1,0xC0,0x83,0x81,0x8D,0x07,0xFB,0x1F,0xE3,0xF1,0x07,0xC0,0x03, // 66
+  0x45,0x11,0x0F,0xE0,0x0F,0xF0,0x7F,0xF0,0xE0,0x71,0x00,0x67,0x00,0x6C,0x00,0xF0,0x00,0xE0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0F,0x00,0x36,0x00,0xE6,0x00,0x8E,0x03,0x0F,0x04,0x06, // 67
+  0x85,0x11,0x0E,0xFF,0xFF,0xFF,0xFF,0x0F,0x00,0x1E,0x00,0x3C,0x00,0x78,0x00,0xF0,0x00,0xE0,0x01,0xC0,0x03,0x80,0x0F,0x80,0x39,0x80,0xE3,0x80,0x83,0xFF,0x03,0xFC,0x01, // 68
+  0x85,0x11,0x0D,0xFF,0xFF,0xFF,0xFF,0x0F,0x06,0x1E,0x0C,0x3C,0x18,0x78,0x30,0xF0,0x60,0xE0,0xC1,0xC0,0x83,0x81,0x07,0x03,0x0F,0x06,0x1E,0x0C,0x3C,0x00,0x18, // 69
+  0x85,0x11,0x0C,0xFF,0xFF,0xFF,0xFF,0x0F,0x06,0x18,0x0C,0x30,0x18,0x60,0x30,0xC0,0x60,0x80,0xC1,0x00,0x83,0x01,0x06,0x03,0x0C,0x06,0x18,0x00,0x00, // 70
+  0x45,0x11,0x10,0xE0,0x0F,0xF0,0x7F,0xF0,0xE0,0x71,0x00,0x67,0x00,0xEC,0x00,0xD8,0x00,0xE0,0x01,0xC0,0x03,0x80,0x07,0x06,0x0F,0x0C,0x3E,0x18,0x6E,0x30,0xCC,0x61,0x18,0xC7,0x1F,0x88,0x3F, // 71
+  0x85,0x11,0x0D,0xFF,0xFF,0xFF,0xFF,0x03,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03,0x00,0x06,0xF8,0xFF,0xFF,0xFF,0x1F, // 72
+  0x85,0x11,0x02,0xFF,0xFF,0xFF,0xFF,0x03, // 73
+  0x45,0x11,0x09,0x00,0x70,0x00,0xE0,0x01,0x00,0x07,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0xF0,0xFF,0x7F,0xFF,0x7F,0x00, // 74
+  0x85,0x11,0x0E,0xFF,0xFF,0xFF,0xFF,0x03,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x7C,0x00,0xFC,0x01,0x9C,0x07,0x1C,0x3C,0x1C,0xF0,0x1C,0xC0,0x1B,0x00,0x1E,0x00,0x18,0x00,0x20, // 75
+  0x85,0x11,0x0A,0xFF,0xFF,0xFF,0xFF,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03, // 76
+  0x85,0x11,0x0F,0xFF,0xFF,0xFF,0xFF,0x3F,0x00,0xF0,0x03,0x00,0x7F,0x00,0xE0,0x07,0x00,0x7E,0x00,0xC0,0x00,0xF8,0x01,0x7E,0xC0,0x1F,0xF0,0x03,0xF0,0x00,0xE0,0xFF,0xFF,0xFF,0x7F, // 77
+  0x85,0x11,0x0D,0xFF,0xFF,0xFF,0xFF,0x3B,0x00,0xE0,0x00,0x00,0x07,0x00,0x3C,0x00,0xE0,0x00,0x80,0x07,0x00,0x1C,0x00,0xF0,0x00,0x80,0xFB,0xFF,0xFF,0xFF,0x1F, // 78
+  0x45,0x11,0x11,0xE0,0x0F,0xF0,0x7F,0xF0,0xE0,0x71,0x00,0x67,0x00,0xEC,0x00,0xF8,0x00,0xE0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0F,0x00,0x3E,0x00,0x6E,0x00,0xCC,0x01,0x1C,0x0F,0x1E,0xFC,0x1F,0xE0,0x0F,0x00, // 79
+  0x85,0x11,0x0D,0xFF,0xFF,0xFF,0xFF,0x0F,0x0C,0x18,0x18,0x30,0x30,0x60,0x60,0xC0,0xC0,0x80,0x81,0x01,0x03,0x03,0x06,0x06,0x18,0x06,0xF0,0x0F,0x80,0x07,0x00, // 80
+  0x45,0x12,0x11,0xE0,0x0F,0xE0,0xFF,0xC0,0x83,0x87,0x03,0x18,0x06,0xC0,0x1C,0x00,0x33,0x00,0xD8,0x00,0x60,0x03,0x80,0x0D,0xC0,0x36,0x00,0xDB,0x01,0x78,0x06,0xE0,0x38,0x80,0xC3,0x83,0x1F,0xFE,0xEF,0xE0,0x0F,0x03, // 81
+  0x85,0x11,0x0E,0xFF,0xFF,0xFF,0xFF,0x0F,0x06,0x18,0x0C,0x30,0x18,0x60,0x30,0xC0,0xE0,0x80,0xC1,0x03,0x83,0x1F,0x06,0x7B,0x1C,0xE3,0xF3,0x07,0xCF,0x07,0x18,0x00,0x20, // 82
+  0x45,0x11,0x0E,0x00,0x18,0x70,0xF0,0xF8,0x83,0x33,0x06,0x36,0x1C,0x7C,0x30,0xF0,0x60,0xE0,0xC1,0xC0,0x83,0x81,0x07,0x07,0x1B,0x0C,0x73,0x38,0xC6,0xE1,0x07,0x83,0x07, // 83
+  0x05,0x11,0x0E,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0x00, // 84
+  0x85,0x11,0x0D,0xFF,0x1F,0xFE,0xFF,0x00,0x80,0x03,0x00,0x0E,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0x00,0x80,0x01,0x80,0x03,0x80,0xFB,0xFF,0xF3,0xFF,0x01, // 85
+  0x05,0x11,0x0F,0x01,0x00,0x1E,0x00,0xF8,0x01,0x80,0x0F,0x00,0xFC,0x00,0xC0,0x0F,0x00,0x7C,0x00,0xE0,0x00,0xF0,0x01,0xFC,0x00,0x3F,0x80,0x0F,0xE0,0x07,0xE0,0x01,0x40,0x00,0x00, // 86
+  0x05,0x11,0x17,0x03,0x00,0x7E,0x00,0xF0,0x1F,0x00,0xFE,0x03,0xC0,0x1F,0x00,0x30,0x00,0x7E,0x80,0x3F,0xE0,0x0F,0xF8,0x01,0x7C,0x00,0x18,0x00,0xF0,0x01,0x80,0x1F,0x00,0xF8,0x03,0x80,0x3F,0x00,0xF8,0x01,0x00,0x03,0xF0,0x07,0xFE,0xC3,0x7F,0xE0,0x07,0xC0,0x00,0x00, // 87
+  0x05,0x11,0x0F,0x00,0x00,0x03,0x00,0x0F,0x80,0x7F,0x80,0xE7,0xC1,0x03,0xCF,0x03,0xFC,0x03,0xE0,0x00,0xF0,0x0F,0xF0,0x3C,0x78,0xE0,0x78,0x80,0x37,0x00,0x3E,0x00,0x30,0x00,0x40, // 88
+  0x05,0x11,0x10,0x01,0x00,0x06,0x00,0x38,0x00,0xE0,0x00,0x80,0x03,0x00,0x1E,0x00,0x78,0x00,0xC0,0xFF,0x80,0xFF,0xC1,0x03,0xC0,0x03,0xC0,0x01,0xE0,0x01,0xE0,0x01,0xC0,0x00,0x80,0x00,0x00, // 89
+  0x05,0x11,0x0E,0x00,0x80,0x07,0x80,0x0F,0x80,0x1F,0xC0,0x3D,0xC0,0x79,0xC0,0xF1,0xC0,0xE1,0xE1,0xC0,0xE3,0x80,0xE7,0x00,0xEF,0x00,0x7E,0x00,0x7C,0x00,0x78,0x00,0x30, // 90
+  0x45,0x16,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0x0F,0x00,0xC0, // 91
+  0x05,0x11,0x07,0x03,0x00,0x3E,0x00,0xF0,0x07,0x00,0x7F,0x00,0xF0,0x07,0x00,0x3E,0x00,0x60, // 92
+  0x85,0x16,0x04,0x03,0x00,0xF0,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF, // 93
+  0x45,0x09,0x0A,0x00,0x81,0xE3,0xF3,0x71,0xE0,0x80,0x0F,0x7C,0xC0,0x01,0x02, // 94
+  0x19,0x02,0x0D,0xFF,0xFF,0xFF,0x03, // 95
+  0x45,0x03,0x04,0xD9,0x09, // 96
+  0x49,0x0D,0x0B,0x0C,0xC7,0xF1,0x19,0xF3,0x61,0x3C,0x8C,0xC7,0xF0,0x18,0x3B,0x33,0xFE,0x8F,0xFF,0x03,0x40, // 97
+  0x85,0x11,0x0B,0xFF,0xFF,0xFF,0xFF,0x03,0x83,0x01,0x03,0x06,0x03,0x18,0x06,0x30,0x0C,0x60,0x38,0xE0,0xE0,0xE0,0x80,0xFF,0x00,0x7C,0x00, // 98
+  0x49,0x0D,0x0A,0xF8,0x83,0xFF,0x38,0xB8,0x03,0x3E,0x80,0x07,0xF0,0x00,0x3E,0xE0,0x0E,0x8E,0xC1,0x00, // 99
+  0x45,0x11,0x0B,0x00,0x1F,0x80,0xFF,0x80,0x83,0x83,0x03,0x0E,0x03,0x18,0x06,0x30,0x0C,0x60,0x30,0x60,0xC0,0x60,0xFE,0xFF,0xFF,0xFF,0x07, // 100
+  0x49,0x0D,0x0B,0xF0,0x83,0xFF,0xB8,0xB9,0x33,0x3E,0x86,0xC7,0xF0,0x18,0x3E,0xE3,0x6E,0x8C,0xCF,0xE0,0x09, // 101
+  0x05,0x11,0x07,0x30,0x00,0x60,0x00,0xF8,0xFF,0xFF,0xFF,0x3F,0x03,0x60,0x06,0xC0,0x0C,0x00, // 102
+  0x49,0x12,0x0B,0xF0,0xC1,0xF0,0x1F,0xE7,0xE0,0xF8,0x01,0xC7,0x03,0x18,0x0F,0x60,0x3C,0x80,0xB1,0x01,0xE3,0x0C,0xC6,0xFD,0xFF,0xF3,0xFF,0x07, // 103
+  0x85,0x11,0x0A,0xFF,0xFF,0xFF,0xFF,0x03,0x03,0x00,0x03,0x00,0x03,0x00,0x06,0x00,0x0C,0x00,0x38,0x00,0xE0,0xFF,0x81,0xFF,0x03, // 104
+  0x85,0x11,0x02,0xF3,0xFF,0xE7,0xFF,0x03, // 105
+  0x05,0x16,0x04,0x00,0x00,0x30,0x00,0x00,0x3C,0xFF,0xFF,0xCF,0xFF,0x7F, // 106
+  0x85,0x11,0x0A,0xFF,0xFF,0xFF,0xFF,0x03,0x18,0x00,0x38,0x00,0xF8,0x00,0x98,0x07,0x18,0x1C,0x18,0xF0,0x10,0x80,0x01,0x00,0x02, // 107
+  0x85,0x11,0x02,0xFF,0xFF,0xFF,0xFF,0x03, // 108
+  0x89,0x0D,0x10,0xFF,0xFF,0xFF,0x1B,0x00,0x01,0x30,0x00,0x06,0xC0,0x01,0xF0,0xFF,0xFC,0xDF,0x00,0x08,0x80,0x01,0x30,0x00,0x0E,0x80,0xFF,0xE7,0xFF, // 109
+  0x89,0x0D,0x0A,0xFF,0xFF,0xFF,0x33,0x00,0x03,0x30,0x00,0x06,0xC0,0x00,0x38,0x00,0xFE,0x9F,0xFF,0x03, // 110
+  0x49,0x0D,0x0B,0xF8,0x83,0xFF,0x38,0xB8,0x03,0x3E,0x80,0x07,0xF0,0x00,0x3E,0xE0,0x0E,0x8E,0xFF,0xE0,0x0F, // 111
+  0x89,0x12,0x0B,0xFF,0xFF,0xFF,0xFF,0xCF,0x60,0x80,0x01,0x03,0x03,0x18,0x0C,0x60,0x30,0x80,0xC1,0x01,0x07,0x0E,0x0E,0xF0,0x1F,0x00,0x1F,0x00, // 112
+  0x49,0x12,0x0B,0xF0,0x01,0xF0,0x1F,0xE0,0xE0,0xC0,0x01,0x07,0x03,0x18,0x0C,0x60,0x30,0x80,0x81,0x01,0x03,0x0C,0x06,0xFC,0xFF,0xFF,0xFF,0x3F, // 113
+  0x89,0x0D,0x06,0xFF,0xFF,0xFF,0x1B,0x80,0x01,0x30,0x00,0x06,0x00, // 114
+  0x49,0x0D,0x0A,0x1C,0xC6,0xC7,0xDD,0xF1,0x31,0x3C,0x86,0xC7,0xF1,0x38,0x3E,0xE6,0xCE,0x8F,0xF1,0x00, // 115
+  0x05,0x11,0x07,0x30,0x00,0x60,0x00,0xF8,0xFF,0xFB,0xFF,0x0F,0x03,0x18,0x06,0x30,0x0C,0x60, // 116
+  0x89,0x0D,0x0A,0xFF,0xE7,0xFF,0x01,0x70,0x00,0x0C,0x80,0x01,0x30,0x00,0x03,0x30,0xFF,0xFF,0xFF,0x03, // 117
+  0x09,0x0D,0x0B,0x03,0xE0,0x03,0xF0,0x01,0xF0,0x01,0xF8,0x00,0x38,0xE0,0x03,0x1F,0x7C,0xE0,0x03,0x0C,0x00, // 118
+  0x09,0x0D,0x11,0x07,0xE0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x81,0x1F,0x7C,0xF0,0x01,0x07,0xC0,0x07,0xC0,0x07,0xE0,0x07,0xC0,0x81,0x1F,0x7E,0xF8,0x01,0x07,0x00, // 119
+  0x09,0x0D,0x0B,0x01,0x70,0x00,0x3F,0x78,0x8E,0x83,0x3F,0xC0,0x01,0xFC,0xE0,0x38,0x0E,0xFE,0x00,0x07,0x40, // 120
+  0x49,0x12,0x0A,0x07,0x00,0xFC,0x00,0x8C,0x0F,0x30,0xF0,0xE1,0x00,0xFF,0x01,0xF8,0x01,0xFE,0x00,0x7F,0x00,0x1F,0x00,0x0C,0x00,0x00, // 121
+  0x49,0x0D,0x0A,0x00,0x78,0xC0,0x0F,0xFC,0xC1,0x3D,0x9E,0xE7,0xF0,0x0E,0xFE,0xC0,0x0F,0x78,0x00,0x03, // 122
+  0x45,0x16,0x06,0x00,0x0C,0x00,0x80,0x07,0xE0,0x3F,0xFF,0xFD,0x87,0xFF,0x03,0x00,0xF0,0x00,0x00,0x0C, // 123
+  0x85,0x17,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F, // 124
+  0x45,0x16,0x06,0x03,0x00,0xF0,0x00,0x00,0xFC,0x1F,0xFE,0xFB,0xEF,0x7F,0x00,0x1E,0x00,0x00,0x03,0x00, // 125
+  0x4C,0x04,0x0C,0x76,0x33,0x63,0xC6,0xCC,0x6E, // 126
+  0xC9,0x12,0x02,0xF3,0xFF,0xCF,0xFF,0x0F, // 161
+  0x45,0x16,0x0A,0x00,0x3F,0x00,0xF0,0x1F,0x00,0x0E,0xCE,0xC3,0x01,0x0F,0x30,0xF8,0x01,0xEC,0x61,0x00,0x07,0x18,0xBC,0x81,0x03,0xE0,0x70,0x00,0x20,0x0C,0x00, // 162
+  0x05,0x11,0x0C,0x00,0x83,0x00,0x86,0xE3,0x8F,0xF3,0xFF,0x77,0xF0,0x6C,0x60,0xD8,0xC0,0xB0,0x81,0xC1,0x07,0x80,0x1D,0x00,0x33,0x00,0x07,0x00,0x04, // 163
+  0x48,0x0C,0x0C,0x02,0x74,0xEF,0xFE,0xC7,0x30,0x06,0x66,0x60,0x06,0x66,0x60,0x0C,0xE3,0x7F,0xF7,0x2E,0x40, // 164
+  0x05,0x11,0x0D,0x07,0x33,0x1C,0x66,0xF0,0xCC,0x80,0x9F,0x01,0x3E,0x03,0xF0,0x3F,0xE0,0x7F,0xF0,0x19,0xF0,0x33,0x78,0x66,0x38,0xCC,0x38,0x98,0x11,0x00,0x00, // 165
+  0x85,0x17,0x02,0xFF,0xC3,0xFF,0xFF,0xE1,0x3F, // 166
+  0x45,0x16,0x0B,0x00,0x07,0x00,0xE7,0x83,0xE1,0x8F,0xE1,0x9D,0xE1,0x60,0xE3,0x30,0xF0,0x30,0x18,0x3C,0x18,0x0E,0x1F,0x0E,0xE7,0x0E,0xA7,0x1F,0x83,0xCF,0x03,0xC0,0x01,0x00, // 167
+  0x45,0x02,0x06,0x0F,0x0F, // 168
+  0x05,0x11,0x12,0xC0,0x07,0xE0,0x3F,0xE0,0xE0,0x60,0x00,0xE3,0x3C,0xCE,0xFE,0xD9,0x0C,0xE3,0x0D,0xCC,0x1B,0x98,0x37,0x30,0x6F,0x60,0xDE,0xE1,0x6C,0xC3,0xCC,0x85,0x1C,0x03,0x18,0x1C,0x1C,0xF0,0x1F,0x80,0x0F,0x00, // 169
+  0x45,0x09,0x06,0xE6,0xEE,0x4F,0x9E,0xFC,0xDF,0x3F, // 170
+  0x4A,0x0B,0x09,0x20,0xC0,0x87,0xF7,0x0E,0x1E,0x42,0x7C,0x78,0xEF,0xE0,0x01,0x04, // 171
+  0x4A,0x07,0x0B,0x83,0xC1,0x60,0x30,0x18,0x0C,0x06,0x83,0xFF,0x1F, // 172
+  0x0F,0x02,0x07,0xFF,0x3F, // 173
+  0x05,0x11,0x12,0xC0,0x07,0xE0,0x3F,0xE0,0xE0,0x60,0x00,0xE3,0x00,0xCE,0xFE,0xDB,0xFC,0xE7,0x99,0xC1,0x33,0x83,0x67,0x0E,0xCF,0x3F,0x1E,0xCF,0x6C,0x00,0xCD,0x01,0x1C,0x03,0x18,0x1C,0x1C,0xF0,0x1F,0x80,0x0F,0x00, // 174
+  0x02,0x02,0x0D,0xFF,0xFF,0xFF,0x03, // 175
+  0x45,0x07,0x07,0x1C,0x51,0x30,0x18,0x14,0x71,0x00, // 176
+  0x48,0x0E,0x0C,0x60,0x30,0x18,0x0C,0x06,0x83,0xC1,0x60,0xF0,0xFF,0xFF,0xFF,0x83,0xC1,0x60,0x30,0x18,0x0C,0x06,0x83,0xC1, // 177
+  0x05,0x09,0x07,0x02,0x07,0x07,0x0F,0x1B,0xF3,0xA3,0x43, // 178
+  0x05,0x09,0x07,0x82,0x06,0x07,0x8C,0x18,0xF1,0xBD,0x3B, // 179
+  0xC5,0x03,0x04,0xFC,0x02, // 180
+  0x89,0x12,0x0A,0xFF,0xFF,0xFF,0xFF,0x0F,0xE0,0x00,0x00,0x06,0x00,0x18,0x00,0x60,0x00,0x80,0x01,0x80,0x03,0xFF,0x1F,0xFC,0x7F,0x00, // 181
+  0x05,0x16,0x0D,0x78,0x00,0x80,0x7F,0x00,0xE0,0x1F,0x00,0xFC,0x0F,0x00,0xFF,0x03,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x00,0x00,0x03,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x00,0x00,0x03,0x00,0x00, // 182
+  0xCD,0x02,0x02,0x0F, // 183
+  0x56,0x04,0x05,0x88,0xEB,0x04, // 184
+  0x45,0x09,0x05,0x0C,0x0C,0x18,0xF8,0xFF,0x1F, // 185
+  0x45,0x09,0x07,0x7C,0xFC,0x1D,0x1F,0x7C,0xDC,0x1F,0x1F, // 186
+  0xCA,0x0B,0x09,0x01,0x3C,0xB8,0xF7,0xF0,0x11,0xC2,0x83,0x7B,0x0F,0x1F,0x20,0x00, // 187
+  0x45,0x11,0x13,0x0C,0x00,0x0C,0x00,0x18,0x00,0xFC,0x0F,0xFE,0x1F,0x0E,0x00,0x0E,0x00,0x07,0x00,0x07,0x00,0x07,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0xC6,0x01,0xCE,0x01,0x97,0x01,0x23,0x00,0xFF,0x01,0xFE,0x03,0x00,0x01, // 188
+  0x45,0x11,0x12,0x0C,0x00,0x0C,0x00,0x18,0x00,0xFC,0x0F,0xFC,0x1F,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x07,0x00,0x07,0x00,0x07,0x80,0x03,0x80,0x13,0x88,0x33,0xD8,0x21,0xF8,0x41,0xD8,0x81,0x98,0x00,0x3F,0x01,0x1C,0x02, // 189
+  0x05,0x11,0x13,0x82,0x00,0x06,0x03,0x04,0x04,0x88,0x08,0x18,0x11,0xF8,0x3D,0xB8,0x3B,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x07,0x06,0x07,0x0E,0x07,0x97,0x03,0x23,0x03,0xFF,0x03,0xFE,0x03,0x00,0x01, // 190
+  0x89,0x12,0x0B,0x00,0x78,0x00,0xF0,0x07,0xF0,0x18,0xE0,0xE0,0xF3,0x01,0xCF,0x03,0x0C,0x00,0x30,0x00,0xE0,0x00,0xC0,0x01,0x80,0x03,0x00,0x06, // 191
+  0x01,0x15,0x0F,0x00,0x00,0x18,0x00,0xE0,0x03,0x00,0x1F,0x00,0xFC,0x00,0xF0,0x0F,0x82,0x8F,0xC1,0x7C,0x30,0xB8,0x01,0x06,0xF4,0xC1,0x00,0xF8,0x18,0x00,0xFC,0x03,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x06, // 192
+  0x01,0x15,0x0F,0x00,0x00,0x18,0x00,0xE0,0x03,0x00,0x1F,0x00,0xFC,0x00,0xF0,0x0F,0x80,0x8F,0x01,0x7D,0x30,0xB8,0x01,0x06,0xF3,0xC1,0x20,0xF8,0x18,0x00,0xFC,0x03,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x06, // 193
+  0x01,0x15,0x0F,0x00,0x00,0x18,0x00,0xE0,0x03,0x00,0x1F,0x00,0xFC,0x00,0xF0,0x0F,0x88,0x8F,0x81,0x7D,0x30,0x98,0x01,0x06,0xF3,0xC1,0xC0,0xF8,0x18,0x10,0xFC,0x03,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x06, // 194
+  0x01,0x15,0x0F,0x00,0x00,0x18,0x00,0xE0,0x03,0x00,0x1F,0x00,0xFC,0x60,0xF0,0x0F,0x8E,0x8F,0xC1,0x7C,0x30,0x98,0x01,0x06,0xF6,0xC1,0xC0,0xF8,0x18,0x1C,0xFC,0x83,0x01,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x06, // 195
+  0x02,0x14,0x0F,0x00,0x00,0x0C,0x00,0xF8,0x00,0xE0,0x03,0xC0,0x0F,0x80,0x7F,0x30,0x3E,0x06,0xFB,0x60,0x80,0x01,0x06,0xF8,0x60,0x30,0x3E,0x06,0x83,0x7F,0x00,0xC0,0x0F,0x00,0xE0,0x03,0x00,0xF8,0x00,0x00,0x0C, // 196
+  0x01,0x15,0x0F,0x00,0x00,0x18,0x00,0xE0,0x03,0x00,0x1F,0x00,0xFC,0x00,0xF0,0x0F,0x9C,0x8F,0x41,0x7C,0x30,0x88,0x01,0x06,0xF1,0xC1,0xC0,0xF9,0x18,0x00,0xFC,0x03,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x06, // 197
+  0x05,0x11,0x17,0x00,0x80,0x01,0xC0,0x03,0xE0,0x01,0xF0,0x00,0xF8,0x00,0xBC,0x01,0x1E,0x03,0x0F,0x06,0x07,0x0C,0x06,0x18,0x0C,0x30,0xF8,0xFF,0xFF,0xFF,0x7F,0x30,0xF0,0x60,0xE0,0xC1,0xC0,0x83,0x81,0x07,0x03,0x0F,0x06,0x1E,0x0C,0x3C,0x18,0x78,0x30,0xF0,0x00,0x60, // 198
+  0x45,0x15,0x0F,0xE0,0x0F,0x00,0xFF,0x07,0xF0,0xE0,0x01,0x07,0x70,0x60,0x00,0x0C,0x06,0x00,0xE3,0x00,0x60,0x1C,0x00,0xBC,0x03,0x80,0x7D,0x00,0x30,0x0D,0x00,0x06,0x03,0x60,0xE0,0x00,0x0E,0x38,0xF0,0x00,0x04,0x06,0x00, // 199
+  0x81,0x15,0x0D,0xF0,0xFF,0x1F,0xFE,0xFF,0xC3,0x60,0x60,0x18,0x0C,0x1C,0x83,0x81,0x67,0x30,0xF0,0x0D,0x06,0xA6,0xC1,0xC0,0x30,0x18,0x18,0x06,0x03,0xC3,0x60,0x60,0x18,0x0C,0x0C,0x03,0x80,0x01, // 200
+  0x81,0x15,0x0D,0xF0,0xFF,0x1F,0xFE,0xFF,0xC3,0x60,0x60,0x18,0x0C,0x0C,0x83,0x81,0x69,0x30,0xF0,0x0D,0x06,0x9E,0xC1,0xC0,0x31,0x18,0x18,0x06,0x03,0xC3,0x60,0x60,0x18,0x0C,0x0C,0x03,0x80,0x01, // 201
+  0x81,0x15,0x0D,0xF0,0xFF,0x1F,0xFE,0xFF,0xC3,0x60,0x60,0x18,0x0C,0x4C,0x83,0x81,0x6D,0x30,0xF0,0x0C,0x06,0x9E,0xC1,0xC0,0x36,0x18,0x98,0x06,0x03,0xC3,0x60,0x60,0x18,0x0C,0x0C,0x03,0x80,0x01, // 202
+  0x82,0x14,0x0D,0xF8,0xFF,0x8F,0xFF,0xFF,0x18,0x0C,0x8C,0xC1,0xC0,0x1B,0x0C,0xBC,0xC1,0xC0,0x18,0x0C,0x8C,0xC1,0xC0,0x1B,0x0C,0xBC,0xC1,0xC0,0x18,0x0C,0x8C,0xC1,0xC0,0x18,0x00,0x0C, // 203
+  0x41,0x15,0x04,0x01,0x00,0x60,0xFE,0xFF,0xDF,0xFF,0x7F,0x02,0x00,0x00, // 204
+  0x41,0x15,0x04,0x04,0x00,0xE0,0xFE,0xFF,0xCF,0xFF,0xFF,0x00,0x00,0x00, // 205
+  0x01,0x15,0x06,0x04,0x00,0xC0,0x00,0x00,0xCC,0xFF,0xFF,0xF9,0xFF,0x6F,0x00,0x00,0x08,0x00,0x00, // 206
+  0x02,0x14,0x06,0x03,0x00,0x30,0x00,0x00,0xF8,0xFF,0x8F,0xFF,0xFF,0x03,0x00,0x30,0x00,0x00, // 207
+  0x05,0x11,0x10,0x80,0x01,0x00,0x03,0xFC,0xFF,0xFF,0xFF,0x3F,0x18,0x78,0x30,0xF0,0x60,0xE0,0xC1,0xC0,0x83,0x81,0x07,0x00,0x0F,0x00,0x3E,0x00,0xE6,0x00,0x8E,0x03,0x0E,0xFE,0x0F,0xF0,0x07, // 208
+  0x81,0x15,0x0D,0xF0,0xFF,0x1F,0xFE,0xFF,0x83,0x03,0x00,0xE3,0x00,0x70,0x70,0x00,0x06,0x3C,0xC0,0x00,0x0E,0x30,0x80,0x07,0x06,0xC0,0xE1,0x00,0xF0,0x0C,0x00,0x38,0xF8,0xFF,0x0F,0xFF,0xFF,0x01, // 209
+  0x41,0x15,0x11,0x00,0xFE,0x00,0xF0,0x7F,0x00,0x0F,0x1E,0x70,0x00,0x07,0x06,0xC0,0xE0,0x00,0x78,0x0C,0x00,0x9E,0x01,0xC0,0x37,0x00,0x98,0x06,0x00,0xC3,0x00,0x60,0x38,0x00,0x0E,0x06,0xC0,0xC0,0x01,0x1C,0xF0,0xE0,0x01,0xFC,0x1F,0x00,0xFE,0x00, // 210
+  0x41,0x15,0x11,0x00,0xFE,0x00,0xF0,0x7F,0x00,0x0F,0x1E,0x70,0x00,0x07,0x06,0xC0,0xE0,0x00,0x38,0x0C,0x00,0xA6,0x01,0xC0,0x37,0x00,0x78,0x06,0x00,0xC7,0x00,0x60,0x38,0x00,0x0E,0x06,0xC0,0xC0,0x01,0x1C,0xF0,0xE0,0x01,0xFC,0x1F,0x00,0xFE,0x00, // 211
+  0x41,0x15,0x11,0x00,0xFE,0x00,0xF0,0x7F,0x00,0x0F,0x1E,0x70,0x00,0x07,0x06,0xC0,0xE0,0x00,0x38,0x0D,0x00,0xB6,0x01,0xC0,0x33,0x00,0x78,0x06,0x00,0xDB,0x00,0x60,0x3A,0x00,0x0E,0x06,0xC0,0xC0,0x01,0x1C,0xF0,0xE0,0x01,0xFC,0x1F,0x00,0xFE,0x00, // 212
+  0x41,0x15,0x11,0x00,0xFE,0x00,0xF0,0x7F,0x00,0x0F,0x1E,0x70,0x00,0x67,0x06,0xC0,0xEE,0x00,0xF8,0x0C,0x00,0x9E,0x01,0xC0,0x36,0x00,0xD8,0x06,0x00,0xDF,0x00,0xE0,0x39,0x00,0x0E,0x06,0xC0,0xC0,0x01,0x1C,0xF0,0xE0,0x01,0xFC,0x1F,0x00,0xFE,0x00, // 213
+  0x42,0x14,0x11,0x00,0x7F,0x00,0xFC,0x1F,0xE0,0xC1,0x03,0x07,0x70,0x30,0x00,0x86,0x03,0xE0,0x1B,0x00,0xBC,0x01,0xC0,0x18,0x00,0x8C,0x01,0xC0,0x1B,0x00,0xBC,0x03,0xE0,0x30,0x00,0x06,0x07,0x70,0xE0,0xC1,0x03,0xFC,0x1F,0x00,0x7F,0x00, // 214
+  0x89,0x09,0x09,0x83,0x8F,0xBB,0xE3,0x83,0x83,0x8F,0xBB,0xE3,0x83,0x01, // 215
+  0x44,0x13,0x11,0xC0,0x1F,0x82,0xFF,0x3B,0x1E,0xFC,0x38,0xC0,0xC3,0x00,0x1F,0x07,0xDC,0x19,0x70,0xCC,0xC0,0x61,0x06,0x07,0x33,0x1C,0x98,0x71,0xC0,0xDC,0x01,0xC7,0x07,0x18,0x1E,0xE0,0xF8,0xC1,0xE3,0xFE,0x0F,0xC2,0x1F,0x00, // 216
+  0x81,0x15,0x0D,0xF0,0xFF,0x01,0xFE,0xFF,0x00,0x00,0x38,0x00,0x00,0x1E,0x00,0x80,0x07,0x00,0xF0,0x01,0x00,0x26,0x00,0xC0,0x00,0x00,0x18,0x00,0x80,0x03,0x00,0x38,0xF8,0xFF,0x03,0xFF,0x1F,0x00, // 217
+  0x81,0x15,0x0D,0xF0,0xFF,0x01,0xFE,0xFF,0x00,0x00,0x38,0x00,0x00,0x0E,0x00,0x80,0x09,0x00,0xF0,0x01,0x00,0x1E,0x00,0xC0,0x01,0x00,0x18,0x00,0x80,0x03,0x00,0x38,0xF8,0xFF,0x03,0xFF,0x1F,0x00, // 218
+  0x81,0x15,0x0D,0xF0,0xFF,0x01,0xFE,0xFF,0x00,0x00,0x38,0x00,0x00,0x4E,0x00,0x80,0x0D,0x00,0xF0,0x00,0x00,0x1E,0x00,0xC0,0x06,0x00,0x98,0x00,0x80,0x03,0x00,0x38,0xF8,0xFF,0x03,0xFF,0x1F,0x00, // 219
+  0x82,0x14,0x0D,0xF8,0xFF,0x80,0xFF,0x3F,0x00,0x00,0x07,0x00,0xE0,0x03,0x00,0x3C,0x00,0xC0,0x00,0x00,0x0C,0x00,0xC0,0x03,0x00,0x3C,0x00,0xE0,0x00,0x00,0x87,0xFF,0x3F,0xF8,0xFF,0x00, // 220
+  0x01,0x15,0x10,0x10,0x00,0x00,0x06,0x00,0x80,0x03,0x00,0xE0,0x00,0x00,0x38,0x00,0x00,0x1E,0x00,0x80,0x07,0x20,0xC0,0xFF,0x07,0xF8,0x7F,0xC0,0x03,0x04,0x3C,0x00,0xC0,0x01,0x00,0x1E,0x00,0xE0,0x01,0x00,0x0C,0x00,0x80,0x00,0x00, // 221
+  0x85,0x11,0x0D,0xFF,0xFF,0xFF,0xFF,0x63,0xC0,0xC0,0x80,0x81,0x01,0x03,0x03,0x06,0x06,0x0C,0x0C,0x18,0x18,0x30,0x30,0x70,0xC0,0x70,0x80,0x7F,0x00,0x7C,0x00, // 222
+  0x85,0x11,0x0C,0xFC,0xFF,0xFD,0xFF,0x1B,0x00,0x18,0x00,0x32,0x00,0x6E,0x00,0xF8,0xF1,0x60,0xFF,0xC1,0x3C,0x86,0x01,0x98,0x03,0xF0,0x03,0xC0,0x03, // 223
+  0x45,0x11,0x0B,0xC0,0x70,0xC0,0xF1,0x81,0x31,0x8F,0x61,0x3C,0xC3,0xF8,0xC6,0x30,0x8D,0x31,0x38,0x33,0xE0,0xFF,0x80,0xFF,0x03,0x00,0x04, // 224
+  0x45,0x11,0x0B,0xC0,0x70,0xC0,0xF1,0x81,0x31,0x87,0x61,0x4C,0xC3,0xF8,0xC6,0xF0,0x8C,0xB1,0x38,0x33,0xE0,0xFF,0x80,0xFF,0x03,0x00,0x04, // 225
+  0x45,0x11,0x0B,0xC0,0x70,0xC0,0xF1,0x91,0x31,0xB7,0x61,0x3C,0xC3,0x78,0xC6,0xB0,0x8D,0x31,0x3A,0x33,0xE0,0xFF,0x80,0xFF,0x03,0x00,0x04, // 226
+  0x45,0x11,0x0B,0xC0,0x70,0xCC,0xF1,0x9D,0x31,0x9F,0x61,0x3C,0xC3,0xD8,0xC6,0xB0,0x8D,0xB1,0x3B,0x33,0xE3,0xFF,0x80,0xFF,0x03,0x00,0x04, // 227
+  0x46,0x10,0x0B,0x60,0x38,0x70,0x7C,0x33,0xE6,0x1B,0xC6,0x18,0xC6,0x18,0xC3,0x1B,0x63,0x3B,0x33,0xF0,0x7F,0xE0,0xFF,0x00,0x80, // 228
+  0x43,0x13,0x0B,0x00,0xC3,0x01,0x1C,0x1F,0x60,0xCC,0x9D,0x61,0x1C,0x0D,0xE3,0x68,0x0C,0x47,0x63,0xCC,0x39,0x33,0x80,0xFF,0x03,0xF8,0x3F,0x00,0x00,0x01, // 229
+  0x49,0x0D,0x14,0x88,0xC7,0xF9,0x99,0xF3,0x31,0x3C,0x86,0xC7,0xF0,0x18,0x9E,0x61,0x37,0xCE,0xFF,0xF8,0x3F,0x33,0x77,0xC6,0xC7,0xF0,0x18,0x1E,0xC3,0x63,0xD8,0x8C,0xF1,0x19,0x38,0x01, // 230
+  0x49,0x11,0x0A,0xF8,0x03,0xF8,0x0F,0x38,0x38,0x38,0xE0,0x38,0x80,0x71,0x00,0xEF,0x00,0xF6,0x03,0x4E,0x0E,0x0E,0x18,0x0C,0x00, // 231
+  0x45,0x11,0x0B,0x00,0x3F,0x80,0xFF,0x80,0x9B,0x8B,0x33,0x3E,0x63,0xF8,0xC6,0x30,0x8D,0x61,0x38,0xE3,0xE0,0xC6,0x80,0xCF,0x00,0x9E,0x00, // 232
+  0x45,0x11,0x0B,0x00,0x3F,0x80,0xFF,0x80,0x9B,0x83,0x33,0x4E,0x63,0xF8,0xC6,0xF0,0x8C,0xE1,0x38,0xE3,0xE0,0xC6,0x80,0xCF,0x00,0x9E,0x00, // 233
+  0x45,0x11,0x0B,0x00,0x3F,0x80,0xFF,0x80,0x9B,0xA3,0x33,0x6E,0x63,0x78,0xC6,0xF0,0x8C,0x61,0x3B,0xE3,0xE4,0xC6,0x80,0xCF,0x00,0x9E,0x00, // 234
+  0x46,0x10,0x0B,0x80,0x1F,0xE0,0x3F,0x70,0x73,0x3B,0xE3,0x1B,0xC3,0x18,0xC3,0x18,0xC3,0x3B,0xE3,0x73,0x63,0xE0,0x33,0xC0,0x13, // 235
+  0x45,0x11,0x04,0x01,0x00,0xE6,0xFF,0xDF,0xFF,0x27,0x00,0x00, // 236
+  0x45,0x11,0x04,0x04,0x00,0xEE,0xFF,0xCF,0xFF,0x0F,0x00,0x00, // 237
+  0x05,0x11,0x06,0x04,0x00,0x0C,0x00,0xCC,0xFF,0x9F,0xFF,0x6F,0x00,0x80,0x00,0x00, // 238
+  0x06,0x10,0x06,0x03,0x00,0x03,0x00,0xF8,0xFF,0xF8,0xFF,0x03,0x00,0x03,0x00, // 239
+  0x45,0x11,0x0B,0x80,0x3F,0x80,0xFF,0xA0,0x83,0xEB,0x03,0x5E,0x03,0xF8,0x06,0xB0,0x0D,0x60,0x3F,0xE0,0xF9,0xE0,0xC0,0xFF,0x00,0xFC,0x00, // 240
+  0x85,0x11,0x0A,0xF0,0xFF,0xED,0xFF,0x1F,0x03,0x18,0x03,0x30,0x03,0xC0,0x06,0x80,0x0D,0x80,0x3B,0x00,0xE3,0xFF,0x81,0xFF,0x03, // 241
+  0x45,0x11,0x0B,0x80,0x3F,0x80,0xFF,0x80,0x83,0x8B,0x03,0x3E,0x03,0xF8,0x06,0x30,0x0D,0x60,0x38,0xE0,0xE0,0xE0,0x80,0xFF,0x00,0xFE,0x00, // 242
+  0x45,0x11,0x0B,0x80,0x3F,0x80,0xFF,0x80,0x83,0x83,0x03,0x4E,0x03,0xF8,0x06,0xF0,0x0C,0xE0,0x38,0xE0,0xE0,0xE0,0x80,0xFF,0x00,0xFE,0x00, // 243
+  0x45,0x11,0x0B,0x80,0x3F,0x80,0xFF,0x80,0x83,0xA3,0x03,0x6E,0x03,0x78,0x06,0xF0,0x0C,0x60,0x3B,0xE0,0xE4,0xE0,0x80,0xFF,0x00,0xFE,0x00, // 244
+  0x45,0x11,0x0B,0x80,0x3F,0x80,0xFF,0x98,0x83,0xBB,0x03,0x3E,0x03,0x78,0x06,0xB0,0x0D,0x60,0x3B,0xE0,0xE7,0xE0,0x86,0xFF,0x00,0xFE,0x00, // 245
+  0x46,0x10,0x0B,0xC0,0x1F,0xE0,0x3F,0x70,0x70,0x3B,0xE0,0x1B,0xC0,0x18,0xC0,0x18,0xC0,0x3B,0xE0,0x73,0x70,0xE0,0x3F,0xC0,0x1F, // 246
+  0x49,0x08,0x0C,0x18,0x18,0x18,0x18,0x18,0xDB,0xDB,0x18,0x18,0x18,0x18,0x18, // 247
+  0x88,0x0F,0x0B,0xF0,0x67,0xFC,0x3F,0x07,0xC7,0xE1,0x67,0x38,0x33,0x8F,0xD9,0xC1,0x7C,0x70,0x1C,0x9C,0xFF,0xC7,0xFC,0x01, // 248
+  0x85,0x11,0x0A,0xF0,0x7F,0xE0,0xFF,0x05,0x00,0x1F,0x00,0x7C,0x00,0x98,0x00,0x30,0x00,0x30,0x00,0x30,0xF0,0xFF,0xE1,0xFF,0x03, // 249
+  0x85,0x11,0x0A,0xF0,0x7F,0xE0,0xFF,0x01,0x00,0x07,0x00,0x4C,0x00,0xF8,0x00,0xF0,0x00,0xB0,0x00,0x30,0xF0,0xFF,0xE1,0xFF,0x03, // 250
+  0x85,0x11,0x0A,0xF0,0x7F,0xE0,0xFF,0x11,0x00,0x37,0x00,0x3C,0x00,0x78,0x00,0xB0,0x01,0x30,0x02,0x30,0xF0,0xFF,0xE1,0xFF,0x03, // 251
+  0x86,0x10,0x0A,0xF8,0x3F,0xF8,0x7F,0x03,0xE0,0x03,0xC0,0x00,0xC0,0x00,0xC0,0x03,0x60,0x03,0x30,0xF8,0xFF,0xF8,0xFF, // 252
+  0x45,0x16,0x0A,0x70,0x00,0x00,0xFC,0x00,0x0C,0xF8,0x00,0x03,0xF0,0xE1,0x04,0xF0,0xDF,0x01,0xF8,0x31,0xE0,0x0F,0x04,0x7F,0x00,0xF0,0x01,0x00,0x0C,0x00,0x00, // 253
+  0x85,0x16,0x0A,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0E,0x0C,0xC0,0x00,0x06,0x30,0x80,0x01,0x0C,0x60,0x00,0x07,0x1C,0x80,0x83,0x03,0xC0,0x7F,0x00,0xE0,0x07,0x00, // 254
+  0x46,0x15,0x0A,0x38,0x00,0x00,0x3F,0x00,0x0F,0x1F,0xE0,0x01,0x1F,0x0E,0x80,0xFF,0x00,0xE0,0xC7,0xC0,0x1F,0x18,0x7F,0x00,0xF8,0x00,0x00,0x03,0x00,0x00 // 255
+};
+
+#endif
@@ -0,0 +1,97 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+
+#ifndef OLEDDisplayT_h
+#define OLEDDisplayT_h
+
+#include "OLEDDisplay.h"
+
+// Geometry of a display with a width and height known at compile time
+template<uint16_t W, uint16_t H>
+struct OLEDDisplayGeometry {
+  static_assert((W == 128 && H == 64) || (W == 128 && H == 32) ||
+                (W == 64 && H == 48) || (W == 96 && H == 16),
+                "unsupported display geometry");
+
+  static const OLEDDISPLAY_GEOMETRY value =
+    W == 128 && H == 64 ? GEOMETRY_128_64 :
+    W == 128 && H == 32 ? GEOMETRY_128_32 :
+    W == 64           ? GEOMETRY_64_48  : GEOMETRY_96_16;
+};
+
+// A driver with its geometry fixed at compile time, e.g.
+//
+//   OLEDDisplayT<128, 64, SSD1306Wire> display(0x3c, D3, D5);
+//
+// The pixel, line and rectangle functions called on it are compiled
+// for the constant width and height, so clipping and the page stride fold
+// into immediates. It still is an OLEDDisplay: through a base pointer or
+// reference, like the one OLEDDisplayUi holds, the same functions use the
+// geometry stored at runtime and draw exactly the same pixels.
+template<uint16_t W, uint16_t H, class Driver>
+class OLEDDisplayT : public Driver {
+  public:
+    static const OLEDDISPLAY_GEOMETRY GEOMETRY = OLEDDisplayGeometry<W, H>::value;
+
+    // Takes the arguments of the driver, without the geometry
+    template<typename... Args>
+    OLEDDisplayT(Args... args) : Driver(args...) {
+      this->setGeometry(GEOMETRY);
+    }
+
+    const uint16_t width(void) const { return W; };
+    const uint16_t height(void) const { return H; };
+
+    void setPixel(int16_t x, int16_t y) {
+      this->setPixelIn(W, H, x, y);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t width, int16_t height) {
+      this->fillRectIn(W, H, x, y, width, height);
+    }
+
+    void drawHorizontalLine(int16_t x, int16_t y, int16_t length) {
+      this->drawHorizontalLineIn(W, H, x, y, length);
+    }
+
+    void drawVerticalLine(int16_t x, int16_t y, int16_t length) {
+      this->fillRectIn(W, H, x, y, 1, length);
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t width, int16_t height) {
+      drawHorizontalLine(x, y, width);
+      drawVerticalLine(x, y, height);
+      drawVerticalLine(x + width - 1, y, height);
+      drawHorizontalLine(x, y + height - 1, width);
+    }
+};
+
+#endif
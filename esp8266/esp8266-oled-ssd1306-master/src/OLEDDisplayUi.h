@@ -93,6 +93,17 @@ struct OLEDDisplayUiState {
   void*         userData                  = NULL;
 };
 
+// Frame time statistics, see OLEDDisplayUi::getStats()
+struct OLEDDisplayUiStats {
+  uint32_t      frames                    = 0;  // Ticks drawn
+  uint32_t      unchangedFrames           = 0;  // Drawn but not sent, the screen showed them already
+  uint32_t      skippedTicks              = 0;  // Left out to catch up with the time
+  uint32_t      drawMicros                = 0;  // Average time to draw a frame
+  uint32_t      flushMicros               = 0;  // Average time to send it, unchanged ones included
+  uint32_t      maxFrameMicros            = 0;  // Longest draw and send
+  uint16_t      interval                  = 0;  // Milliseconds between ticks after adapting to the load
+};
+
 struct LoadingStage {
   const char* process;
   void (*callback)();
@@ -154,11 +165,33 @@ class OLEDDisplayUi {
     OLEDDisplayUiState      state;
 
     // Bookeeping for update
-    uint8_t             updateInterval            = 33;
+    uint16_t            updateInterval            = 33;  // of a tick, as set by setTargetFPS()
+    uint16_t            frameInterval             = 33;  // between ticks drawn, adapted to the load
+    uint8_t             maxLoad                   = 100;
+
+    // Hash of the frame on the screen, to skip sending it again
+    uint32_t            shownHash                 = 0;
+    bool                shownHashValid            = false;
+
+    OLEDDisplayUiStats  stats;
+
+    // Both frames of the running transition as opaque sprites, rendered
+    // once, see enableFrameCache()
+    uint8_t*            frameCache                = NULL;
+    int16_t             cachedFrames              = -1;  // current << 8 | next
+    bool                cachedIndicators[2];
+
+    // RAM row the controller shows at the top, moved by vertical slides
+    // when nothing is drawn over the frames
+    uint8_t             startLine                 = 0;
+    uint8_t             shownStartLine            = 0;
+    bool                scrollInHardware          = false;
 
     uint8_t             getNextFrameNumber();
     void                drawIndicator();
     void                drawFrame();
+    bool                renderFrame(uint8_t frame, uint8_t *image);
+    void                drawCachedFrames(int16_t x, int16_t y, int16_t x1, int16_t y1);
     void                drawOverlays();
     void                tick();
     void                resetState();
@@ -166,6 +199,7 @@ class OLEDDisplayUi {
   public:
 
     OLEDDisplayUi(OLEDDisplay *display);
+    ~OLEDDisplayUi();
 
     /**
      * Initialise the display
@@ -177,6 +211,13 @@ class OLEDDisplayUi {
      */
     void setTargetFPS(uint8_t fps);
 
+    /**
+     * Set the share of the time, in percent, update() may spend drawing and
+     * sending frames. Ticks are drawn further apart when frames take longer,
+     * timing of frames and transitions stays the same. Defaults to 100.
+     */
+    void setMaxLoad(uint8_t percent);
+
     // Automatic Controll
     /**
      * Enable automatic transition to next frame after the some time can be configured with `setTimePerFrame` and `setTimePerTransition`.
@@ -264,6 +305,17 @@ class OLEDDisplayUi {
      */
     void setFrames(FrameCallback* frameFunctions, uint8_t frameCount);
 
+    /**
+     * Render the two frames of a transition once and slide the cached images
+     * instead of calling both frame callbacks on every tick. The frames don't
+     * animate while they slide. Vertical slides on 64 row screens move the
+     * controller's start line instead, as long as no overlay or indicator is
+     * drawn over them, and only send the rows that slide in.
+     * Takes two frame buffers of heap, returns false if they aren't free.
+     */
+    bool enableFrameCache();
+    void disableFrameCache();
+
     // Overlay
 
     /**
@@ -304,6 +356,18 @@ class OLEDDisplayUi {
     // State Info
     OLEDDisplayUiState* getUiState();
 
-    int8_t update();
+    /**
+     * Frame counts and times since the last resetStats(), the averages and the
+     * interval are kept up to date all the time.
+     */
+    const OLEDDisplayUiStats* getStats();
+    void resetStats();
+
+    /**
+     * Draws a tick once it is due and returns the milliseconds left until the
+     * next one. A frame equal to the one update() sent last isn't sent again,
+     * after drawing to the display in between call switchToFrame().
+     */
+    int32_t update();
 };
 #endif
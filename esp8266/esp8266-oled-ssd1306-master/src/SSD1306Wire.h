@@ -31,10 +31,21 @@
 #ifndef SSD1306Wire_h
 #define SSD1306Wire_h
 
-#include "OLEDDisplay.h"
 #include <Wire.h>
+#include "OLEDDisplayI2C.h"
+
+// Bytes Wire can buffer for one transmission, the control byte included
+#ifndef OLEDDISPLAY_WIRE_BUFFER
+  #if defined(I2C_BUFFER_LENGTH)
+    #define OLEDDISPLAY_WIRE_BUFFER I2C_BUFFER_LENGTH
+  #elif defined(BUFFER_LENGTH)
+    #define OLEDDISPLAY_WIRE_BUFFER BUFFER_LENGTH
+  #else
+    #define OLEDDISPLAY_WIRE_BUFFER 32
+  #endif
+#endif
 
-class SSD1306Wire : public OLEDDisplay {
+class SSD1306Wire : public OLEDDisplayI2C {
   private:
       uint8_t             _address;
       uint8_t             _sda;
@@ -48,6 +59,8 @@ class SSD1306Wire : public OLEDDisplay {
       this->_address = _address;
       this->_sda = _sda;
       this->_scl = _scl;
+      this->controller = CONTROLLER_SSD1306;
+      this->i2cChunkSize = OLEDDISPLAY_WIRE_BUFFER - 1;
     }
 
     bool connect() {
@@ -60,108 +73,44 @@ class SSD1306Wire : public OLEDDisplay {
 
     void display(void) {
       initI2cIfNeccesary();
-      const int x_offset = (128 - this->width()) / 2;
-      #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-        uint8_t minBoundY = UINT8_MAX;
-        uint8_t maxBoundY = 0;
-
-        uint8_t minBoundX = UINT8_MAX;
-        uint8_t maxBoundX = 0;
-        uint8_t x, y;
-
-        // Calculate the Y bounding box of changes
-        // and copy buffer[pos] to buffer_back[pos];
-        for (y = 0; y < (this->height() / 8); y++) {
-          for (x = 0; x < this->width(); x++) {
-           uint16_t pos = x + y * this->width();
-           if (buffer[pos] != buffer_back[pos]) {
-             minBoundY = _min(minBoundY, y);
-             maxBoundY = _max(maxBoundY, y);
-             minBoundX = _min(minBoundX, x);
-             maxBoundX = _max(maxBoundX, x);
-           }
-           buffer_back[pos] = buffer[pos];
-         }
-         yield();
-        }
-
-        // If the minBoundY wasn't updated
-        // we can savely assume that buffer_back[pos] == buffer[pos]
-        // holdes true for all values of pos
-
-        if (minBoundY == UINT8_MAX) return;
-
-        sendCommand(COLUMNADDR);
-        sendCommand(x_offset + minBoundX);
-        sendCommand(x_offset + maxBoundX);
-
-        sendCommand(PAGEADDR);
-        sendCommand(minBoundY);
-        sendCommand(maxBoundY);
-
-        byte k = 0;
-        for (y = minBoundY; y <= maxBoundY; y++) {
-          for (x = minBoundX; x <= maxBoundX; x++) {
-            if (k == 0) {
-              Wire.beginTransmission(_address);
-              Wire.write(0x40);
-            }
-
-            Wire.write(buffer[x + y * this->width()]);
-            k++;
-            if (k == 16)  {
-              Wire.endTransmission();
-              k = 0;
-            }
-          }
-          yield();
-        }
-
-        if (k != 0) {
-          Wire.endTransmission();
-        }
-      #else
-
-        sendCommand(COLUMNADDR);
-        sendCommand(x_offset);
-        sendCommand(x_offset + (this->width() - 1));
-
-        sendCommand(PAGEADDR);
-        sendCommand(0x0);
-        sendCommand((this->height() / 8) - 1);
-
-        if (geometry == GEOMETRY_128_64) {
-          sendCommand(0x7);
-        } else if (geometry == GEOMETRY_128_32) {
-          sendCommand(0x3);
-        }
-
-        for (uint16_t i=0; i < displayBufferSize; i++) {
-          Wire.beginTransmission(this->_address);
-          Wire.write(0x40);
-          for (uint8_t x = 0; x < 16; x++) {
-            Wire.write(buffer[i]);
-            i++;
-          }
-          i--;
-          Wire.endTransmission();
-        }
-      #endif
+      OLEDDisplayI2C::display();
     }
 
     void setI2cAutoInit(bool doI2cAutoInit) {
       _doI2cAutoInit = doI2cAutoInit;
     }
 
-  private:
-    inline void sendCommand(uint8_t command) __attribute__((always_inline)){
+  protected:
+    void sendCommand(uint8_t command) {
+      initI2cIfNeccesary();
+      OLEDDisplayI2C::sendCommand(command);
+    }
+
+    void sendCommands(const uint8_t *commands, uint8_t count) {
+      initI2cIfNeccesary();
+      OLEDDisplayI2C::sendCommands(commands, count);
+    }
+
+    // Pages of displays on other pins may be sent in between, see OLEDDisplayGroup
+    void sendWindowPage(const OLEDDisplayWindow &window, uint8_t page, const uint8_t *row) {
       initI2cIfNeccesary();
+      OLEDDisplayI2C::sendWindowPage(window, page, row);
+    }
+
+    void i2cBegin(uint8_t control) {
       Wire.beginTransmission(_address);
-      Wire.write(0x80);
-      Wire.write(command);
+      Wire.write(control);
+    }
+
+    void i2cWrite(const uint8_t *data, uint16_t length) {
+      Wire.write(data, length);
+    }
+
+    void i2cEnd(void) {
       Wire.endTransmission();
     }
 
+  private:
     void initI2cIfNeccesary() {
       if (_doI2cAutoInit) {
         Wire.begin(this->_sda, this->_scl);
@@ -9,6 +9,7 @@ void Accesspoints::sort() {
     return WiFi.RSSI(a.id) < WiFi.RSSI(b.id);
   });
   changed = true;
+  generation++;
 }
 
 void Accesspoints::sortAfterChannel() {
@@ -16,11 +17,13 @@ void Accesspoints::sortAfterChannel() {
     return WiFi.channel(a.id) > WiFi.channel(b.id);
   });
   changed = true;
+  generation++;
 }
 
 void Accesspoints::add(uint8_t id, bool selected) {
   list->add(AP{id, selected});
   changed = true;
+  generation++;
 }
 
 void Accesspoints::printAll() {
@@ -159,6 +162,10 @@ bool Accesspoints::getSelected(int num) {
   return list->get(num).selected;
 }
 
+uint32_t Accesspoints::getGeneration() {
+  return generation;
+}
+
 uint8_t Accesspoints::getID(int num){
   if (!check(num)) return -1;
   return list->get(num).id;
@@ -173,6 +180,7 @@ void Accesspoints::select(int num) {
   prntln(getSSID(num));
   
   changed = true;
+  generation++;
 }
 
 void Accesspoints::deselect(int num) {
@@ -184,6 +192,7 @@ void Accesspoints::deselect(int num) {
   prntln(getSSID(num));
 
   changed = true;
+  generation++;
 }
 
 void Accesspoints::remove(int num) {
@@ -195,6 +204,7 @@ void Accesspoints::remove(int num) {
   internal_remove(num);
   
   changed = true;
+  generation++;
 }
 
 void Accesspoints::selectAll() {
@@ -202,6 +212,7 @@ void Accesspoints::selectAll() {
     list->replace(i,AP{list->get(i).id,true});
   prntln(AP_SELECTED_ALL);
   changed = true;
+  generation++;
 }
 
 void Accesspoints::deselectAll() {
@@ -209,6 +220,7 @@ void Accesspoints::deselectAll() {
     list->replace(i,AP{list->get(i).id,false});
   prntln(AP_DESELECTED_ALL);
   changed = true;
+  generation++;
 }
 
 void Accesspoints::removeAll() {
@@ -216,6 +228,7 @@ void Accesspoints::removeAll() {
     internal_remove(0);
   prntln(AP_REMOVED_ALL);
   changed = true;
+  generation++;
 }
 
 int Accesspoints::find(uint8_t id){
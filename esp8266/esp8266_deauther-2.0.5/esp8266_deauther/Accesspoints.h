@@ -55,6 +55,7 @@ class Accesspoints {
     uint8_t* getMac(int num);    
     bool getHidden(int num);
     bool getSelected(int num);
+    uint32_t getGeneration(); // counts changes to the list
 
     int find(uint8_t id);
     
@@ -64,6 +65,7 @@ class Accesspoints {
     bool check(int num);
     bool changed = false;
   private:
+    uint32_t generation = 0;
     SimpleList<AP>* list;
     
     bool internal_check(int num);
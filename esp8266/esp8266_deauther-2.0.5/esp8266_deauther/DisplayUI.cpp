@@ -1,9 +1,127 @@
 #include "DisplayUI.h"
 
+uint8_t DisplayUI::buttonGpio[6];
+volatile ButtonEvent DisplayUI::buttonQueue[BUTTON_QUEUE_SIZE];
+volatile uint8_t DisplayUI::buttonHead = 0;
+volatile uint8_t DisplayUI::buttonTail = 0;
+volatile uint8_t DisplayUI::buttonLevels = 0;
+volatile bool DisplayUI::buttonLost = false;
+
 DisplayUI::DisplayUI() {
 
 }
 
+// ===== MENUS ===== //
+// { str, getStr, arg, click, hold, next, count, cache }, see MenuNode
+
+const MenuNode DisplayUI::mainNodes[] PROGMEM = {
+  { D_SCAN, NULL, 0, NULL, NULL, &DisplayUI::scanMenu }, // SCAN
+  { D_SHOW, NULL, 0, NULL, NULL, &DisplayUI::showMenu }, // SHOW
+  { D_ATTACK, NULL, 0, NULL, NULL, &DisplayUI::attackMenu }, // ATTACK
+  { D_PACKET_MONITOR, NULL, 0, &DisplayUI::startPacketMonitor } // PACKET MONITOR
+};
+
+const MenuNode DisplayUI::scanNodes[] PROGMEM = {
+  { D_BACK, NULL, 0, &DisplayUI::back }, // [BACK]
+  { D_SCAN_APST, NULL, 0, &DisplayUI::startScan }, // SCAN AP + ST
+  { D_SCAN_AP, NULL, 1, &DisplayUI::startScan }, // SCAN AP
+  { D_SCAN_ST, NULL, 2, &DisplayUI::startScan } // SCAN ST
+};
+
+const MenuNode DisplayUI::showNodes[] PROGMEM = {
+  { D_BACK, NULL, 0, &DisplayUI::back }, // [BACK]
+  { NULL, &DisplayUI::getListCount, MENU_LIST_APS, NULL, NULL, &DisplayUI::apListMenu }, // Accesspoints 0
+  { NULL, &DisplayUI::getListCount, MENU_LIST_STATIONS, NULL, NULL, &DisplayUI::stationListMenu }, // Stations 0
+  { NULL, &DisplayUI::getListCount, MENU_LIST_NAMES, NULL, NULL, &DisplayUI::nameListMenu }, // Names 0
+  { NULL, &DisplayUI::getListCount, MENU_LIST_SSIDS, NULL, NULL, &DisplayUI::ssidListMenu } // SSIDs 0
+};
+
+const MenuNode DisplayUI::apListNodes[] PROGMEM = {
+  { D_BACK, NULL, 0, &DisplayUI::back }, // [BACK]
+  { NULL, &DisplayUI::getAPLabel, 0, &DisplayUI::toggleAP, &DisplayUI::openAP, NULL, &DisplayUI::countAPs, true }, // *<ssid>
+  { D_SELECT_ALL, NULL, MENU_LIST_APS, &DisplayUI::selectAll }, // SELECT ALL
+  { D_DESELECT_ALL, NULL, MENU_LIST_APS, &DisplayUI::deselectAll }, // DESELECT ALL
+  { D_REMOVE_ALL, NULL, MENU_LIST_APS, &DisplayUI::removeAll } // REMOVE ALL
+};
+
+const MenuNode DisplayUI::stationListNodes[] PROGMEM = {
+  { D_BACK, NULL, 0, &DisplayUI::back }, // [BACK]
+  { NULL, &DisplayUI::getStationLabel, 0, &DisplayUI::toggleStation, &DisplayUI::openStation, NULL, &DisplayUI::countStations, true }, // *<name or vendor>
+  { D_SELECT_ALL, NULL, MENU_LIST_STATIONS, &DisplayUI::selectAll }, // SELECT ALL
+  { D_DESELECT_ALL, NULL, MENU_LIST_STATIONS, &DisplayUI::deselectAll }, // DESELECT ALL
+  { D_REMOVE_ALL, NULL, MENU_LIST_STATIONS, &DisplayUI::removeAll } // REMOVE ALL
+};
+
+const MenuNode DisplayUI::nameListNodes[] PROGMEM = {
+  { D_BACK, NULL, 0, &DisplayUI::back }, // [BACK]
+  { NULL, &DisplayUI::getNameLabel, 0, &DisplayUI::toggleName, &DisplayUI::openName, NULL, &DisplayUI::countNames, true }, // *<name>
+  { D_SELECT_ALL, NULL, MENU_LIST_NAMES, &DisplayUI::selectAll }, // SELECT ALL
+  { D_DESELECT_ALL, NULL, MENU_LIST_NAMES, &DisplayUI::deselectAll }, // DESELECT ALL
+  { D_REMOVE_ALL, NULL, MENU_LIST_NAMES, &DisplayUI::removeAll } // REMOVE ALL
+};
+
+const MenuNode DisplayUI::ssidListNodes[] PROGMEM = {
+  { D_BACK, NULL, 0, &DisplayUI::back }, // [BACK]
+  { D_CLONE_APS, NULL, 0, &DisplayUI::cloneAPs }, // CLONE APs
+  { NULL, &DisplayUI::getRandomMode, 0, &DisplayUI::toggleRandom }, // *RANDOM MODE
+  { NULL, &DisplayUI::getSSIDLabel, 0, &DisplayUI::openSSID, &DisplayUI::removeSSID, NULL, &DisplayUI::countSSIDs }, // <ssid>
+  { D_REMOVE_ALL, NULL, MENU_LIST_SSIDS, &DisplayUI::removeAll } // REMOVE ALL
+};
+
+const MenuNode DisplayUI::apNodes[] PROGMEM = {
+  { D_BACK, NULL, 0, &DisplayUI::back }, // [BACK]
+  { NULL, &DisplayUI::getAPInfo, 0, &DisplayUI::toggleSelected }, // *<ssid>
+  { NULL, &DisplayUI::getAPInfo, 1 }, // Encryption: -/WPA2
+  { NULL, &DisplayUI::getAPInfo, 2 }, // RSSI: -90
+  { NULL, &DisplayUI::getAPInfo, 3 }, // Channel: 11
+  { NULL, &DisplayUI::getAPInfo, 4 }, // 00:11:22:00:11:22
+  { NULL, &DisplayUI::getAPInfo, 5 }, // Vendor: INTEL
+  { NULL, &DisplayUI::getAPInfo, 6, &DisplayUI::toggleSelected }, // SELECT/DESELECT
+  { D_CLONE, NULL, 0, &DisplayUI::cloneAP }, // CLONE
+  { D_REMOVE, NULL, 0, &DisplayUI::removeSelected } // REMOVE
+};
+
+const MenuNode DisplayUI::stationNodes[] PROGMEM = {
+  { D_BACK, NULL, 0, &DisplayUI::back }, // [BACK]
+  { NULL, &DisplayUI::getStationInfo, 0, &DisplayUI::toggleSelected }, // *<station name>
+  { NULL, &DisplayUI::getStationInfo, 1 }, // 00:11:22:00:11:22
+  { NULL, &DisplayUI::getStationInfo, 2 }, // Vendor: INTEL
+  { NULL, &DisplayUI::getStationInfo, 3, &DisplayUI::openStationAP }, // AP: someAP
+  { NULL, &DisplayUI::getStationInfo, 4 }, // Pkts: 12
+  { NULL, &DisplayUI::getStationInfo, 5 }, // Channel: 11
+  { NULL, &DisplayUI::getStationInfo, 6 }, // Seen: <1min
+  { NULL, &DisplayUI::getStationInfo, 7, &DisplayUI::toggleSelected }, // SELECT/DESELECT
+  { D_REMOVE, NULL, 0, &DisplayUI::removeSelected } // REMOVE
+};
+
+const MenuNode DisplayUI::nameNodes[] PROGMEM = {
+  { D_BACK, NULL, 0, &DisplayUI::back }, // [BACK]
+  { NULL, &DisplayUI::getNameInfo, 0, &DisplayUI::toggleSelected }, // *<station name>
+  { NULL, &DisplayUI::getNameInfo, 1 }, // 00:11:22:00:11:22
+  { NULL, &DisplayUI::getNameInfo, 2 }, // Vendor: INTEL
+  { NULL, &DisplayUI::getNameInfo, 3 }, // AP: 00:11:22:00:11:22
+  { NULL, &DisplayUI::getNameInfo, 4 }, // Channel: 11
+  { NULL, &DisplayUI::getNameInfo, 5, &DisplayUI::toggleSelected }, // SELECT/DESELECT
+  { D_REMOVE, NULL, 0, &DisplayUI::removeSelected } // REMOVE
+};
+
+const MenuNode DisplayUI::ssidNodes[] PROGMEM = {
+  { D_BACK, NULL, 0, &DisplayUI::back }, // [BACK]
+  { NULL, &DisplayUI::getSSIDInfo, 0 }, // SSID
+  { NULL, &DisplayUI::getSSIDInfo, 1, &DisplayUI::toggleWPA2 }, // Encryption: WPA2
+  { D_REMOVE, NULL, 0, &DisplayUI::removeSelected } // REMOVE
+};
+
+const MenuNode DisplayUI::attackNodes[] PROGMEM = {
+  { D_BACK, NULL, 0, &DisplayUI::back }, // [BACK]
+  { NULL, &DisplayUI::getAttackInfo, 0, &DisplayUI::toggleAttack }, // *DEAUTH 0/0
+  { NULL, &DisplayUI::getAttackInfo, 1, &DisplayUI::toggleAttack }, // *BEACON 0/0
+  { NULL, &DisplayUI::getAttackInfo, 2, &DisplayUI::toggleAttack }, // *PROBE 0/0
+  { NULL, &DisplayUI::getAttackInfo, 3, &DisplayUI::startAttack } // START
+};
+
+#define MENU_SIZE(nodes) (sizeof(nodes) / sizeof(MenuNode))
+
 void DisplayUI::setupDisplay() {
   // ===== adjustable ===== //
   // initialize display
@@ -94,55 +212,37 @@ void DisplayUI::setupButtons() {
 #endif
 
   // ====================== //
-  // setup and read functions
+  // setup functions
   // ====================== //
   buttonUp.setup = [this]() {
     if (buttonUp.gpio != 2) pinMode(buttonUp.gpio, INPUT_PULLUP);
     buttonUp.time = currentTime;
   };
-  buttonUp.read = [this]() {
-    return !digitalRead(buttonUp.gpio);
-  };
 
   buttonDown.setup = [this]() {
     if (buttonDown.gpio != 2) pinMode(buttonDown.gpio, INPUT_PULLUP);
     buttonDown.time = currentTime;
   };
-  buttonDown.read = [this]() {
-    return !digitalRead(buttonDown.gpio);
-  };
 
   buttonLeft.setup = [this]() {
     if (buttonLeft.gpio != 2) pinMode(buttonLeft.gpio, INPUT_PULLUP);
     buttonLeft.time = currentTime;
   };
-  buttonLeft.read = [this]() {
-    return !digitalRead(buttonLeft.gpio);
-  };
 
   buttonRight.setup = [this]() {
     if (buttonRight.gpio != 2) pinMode(buttonRight.gpio, INPUT_PULLUP);
     buttonRight.time = currentTime;
   };
-  buttonRight.read = [this]() {
-    return !digitalRead(buttonRight.gpio);
-  };
 
   buttonA.setup = [this]() {
     if (buttonA.gpio != 2) pinMode(buttonA.gpio, INPUT_PULLUP);
     buttonA.time = currentTime;
   };
-  buttonA.read = [this]() {
-    return !digitalRead(buttonA.gpio);
-  };
 
   buttonB.setup = [this]() {
     if (buttonB.gpio != 2 ) pinMode(buttonB.gpio, INPUT_PULLUP);
     buttonB.time = currentTime;
   };
-  buttonB.read = [this]() {
-    return !digitalRead(buttonB.gpio);
-  };
 
   // ====================== //
 }
@@ -155,14 +255,14 @@ void DisplayUI::setup() {
   
   // === BUTTON UP === //
   buttonUp.push = [this]() {
-    if(buttonUp.time > currentTime - BUTTON_DELAY) return;
+    if(buttonUp.time > buttonTime - BUTTON_DELAY) return;
     buttonUp.pushed = true;
-    buttonUp.time = currentTime;
+    buttonUp.time = buttonTime;
     scrollCounter = 0;
 
     if (mode == SCREEN_MODE_MENU) { // when in menu, go up or down with cursor
       if (currentMenu->selected > 0) currentMenu->selected--;
-      else currentMenu->selected = currentMenu->list->size() - 1;
+      else currentMenu->selected = countNodes() - 1;
     } else if (mode == SCREEN_MODE_PACKETMONITOR) { // when in packet monitor, change channel
       scan.setChannel(wifi_channel + 1);
     }
@@ -175,13 +275,13 @@ void DisplayUI::setup() {
 
   // === BUTTON DOWN === //
   buttonDown.push = [this]() {
-    if(buttonDown.time > currentTime - BUTTON_DELAY) return;
+    if(buttonDown.time > buttonTime - BUTTON_DELAY) return;
     buttonDown.pushed = true;
-    buttonDown.time = currentTime;
+    buttonDown.time = buttonTime;
     scrollCounter = 0;
 
     if (mode == SCREEN_MODE_MENU) { // when in menu, go up or down with cursor
-      if (currentMenu->selected < currentMenu->list->size() - 1) currentMenu->selected++;
+      if (currentMenu->selected < countNodes() - 1) currentMenu->selected++;
       else currentMenu->selected = 0;
     } else if (mode == SCREEN_MODE_PACKETMONITOR) { // when in packet monitor, change channel
       scan.setChannel(wifi_channel - 1);
@@ -195,9 +295,9 @@ void DisplayUI::setup() {
 
   // === BUTTON LEFT === //
   buttonLeft.push = [this]() {
-    if(buttonLeft.time > currentTime - BUTTON_DELAY) return;
+    if(buttonLeft.time > buttonTime - BUTTON_DELAY) return;
     buttonLeft.pushed = true;
-    buttonLeft.time = currentTime;
+    buttonLeft.time = buttonTime;
     scrollCounter = 0;
   };
 
@@ -208,9 +308,9 @@ void DisplayUI::setup() {
 
   // === BUTTON RIGHT === //
   buttonRight.push = [this]() {
-    if(buttonRight.time > currentTime - BUTTON_DELAY) return;
+    if(buttonRight.time > buttonTime - BUTTON_DELAY) return;
     buttonRight.pushed = true;
-    buttonRight.time = currentTime;
+    buttonRight.time = buttonTime;
     scrollCounter = 0;
   };
 
@@ -223,11 +323,11 @@ void DisplayUI::setup() {
   buttonA.push = [this]() {
     if(!buttonA.pushed){ // first push
       buttonA.pushed = true;
-      buttonA.time = currentTime;
+      buttonA.time = buttonTime;
       scrollCounter = 0;
     }else{ // holding button
-      if(currentTime - buttonA.time > 800 && !buttonA.hold){
-        if(currentMenu->list->get(currentMenu->selected).hold) currentMenu->list->get(currentMenu->selected).hold();
+      if(buttonTime - buttonA.time > BUTTON_HOLD && !buttonA.hold){
+        holdNode(currentMenu->selected);
         buttonA.hold = true;
       }
     }
@@ -236,12 +336,10 @@ void DisplayUI::setup() {
   buttonA.release = [this]() {
     if (!buttonA.pushed) return; // exit when button wasn't pushed before
 
-    if(!buttonA.hold && currentTime - buttonA.time > 80){
+    if(!buttonA.hold && buttonTime - buttonA.time > 80){
       switch(mode){
         case SCREEN_MODE_MENU:
-          if( currentMenu->list->get(currentMenu->selected).click){
-            currentMenu->list->get(currentMenu->selected).click();
-          }
+          clickNode(currentMenu->selected);
           break;
         case SCREEN_MODE_PACKETMONITOR:
         case SCREEN_MODE_LOADSCAN:
@@ -257,9 +355,9 @@ void DisplayUI::setup() {
 
   // === BUTTON B === //
   buttonB.push = [this]() {
-    if(!buttonB.pushed && buttonB.time > currentTime - BUTTON_DELAY) return;
+    if(!buttonB.pushed && buttonB.time > buttonTime - BUTTON_DELAY) return;
     buttonB.pushed = true;
-    buttonB.time = currentTime;
+    buttonB.time = buttonTime;
     scrollCounter = 0;
   };
 
@@ -289,341 +387,32 @@ void DisplayUI::setup() {
   if (buttonA.enabled && buttonA.setup) buttonA.setup();
   if (buttonB.enabled && buttonB.setup) buttonB.setup();
 
-  // ===== MENUS ===== //
-
-  // MAIN MENU
-  createMenu(&mainMenu, NULL, [this]() {
-    addMenuNode(&mainMenu, D_SCAN, &scanMenu); /// SCAN
-    addMenuNode(&mainMenu, D_SHOW, &showMenu); // SHOW
-    addMenuNode(&mainMenu, D_ATTACK, &attackMenu); // ATTACK
-    addMenuNode(&mainMenu, D_PACKET_MONITOR, [this]() { // PACKET MONITOR
-      scan.start(SCAN_MODE_SNIFFER, 0, SCAN_MODE_OFF, 0, false, wifi_channel);
-      mode = SCREEN_MODE_PACKETMONITOR;
-    });
-  });
-
-  // SCAN MENU
-  createMenu(&scanMenu, &mainMenu, [this]() {
-    addMenuNode(&scanMenu, D_SCAN_APST, [this]() { // SCAN AP + ST
-      scan.start(SCAN_MODE_ALL, 15000, SCAN_MODE_OFF, 0, true, wifi_channel);
-      mode = SCREEN_MODE_LOADSCAN;
-    });
-    addMenuNode(&scanMenu, D_SCAN_AP, [this]() { // SCAN AP
-      scan.start(SCAN_MODE_APS, 0, SCAN_MODE_OFF, 0, true, wifi_channel);
-      mode = SCREEN_MODE_LOADSCAN;
-    });
-    addMenuNode(&scanMenu, D_SCAN_ST, [this]() { // SCAN ST
-      scan.start(SCAN_MODE_STATIONS, 30000, SCAN_MODE_OFF, 0, true, wifi_channel);
-      mode = SCREEN_MODE_LOADSCAN;
-    });
-  });
-
-  // SHOW MENU
-  createMenu(&showMenu, &mainMenu, [this]() {
-    addMenuNode(&showMenu, []() { // Accesspoints 0 [0]
-      return buildString(str(D_ACCESSPOINTS),(String)accesspoints.count(),CHARS_PER_LINE);
-    }, &apListMenu);
-    addMenuNode(&showMenu, []() { // Stations 0 [0]
-      return buildString(str(D_STATIONS),(String)stations.count(),CHARS_PER_LINE);
-    }, &stationListMenu);
-    addMenuNode(&showMenu, []() { // Names 0 [0]
-      return buildString(str(D_NAMES),(String)names.count(),CHARS_PER_LINE);
-    }, &nameListMenu);
-    addMenuNode(&showMenu, []() { // SSIDs 0
-      return buildString(str(D_SSIDS),(String)ssids.count(),CHARS_PER_LINE);
-    }, &ssidListMenu);
-  });
-
-  // AP LIST MENU
-  createMenu(&apListMenu, &showMenu, [this]() {
-    // add APs to list
-    int c = accesspoints.count();
-    for (int i = 0; i < c; i++) {
-      addMenuNode(&apListMenu, [i]() {
-        return b2a(accesspoints.getSelected(i)) + accesspoints.getSSID(i);
-      }, [this, i]() {
-        accesspoints.getSelected(i) ? accesspoints.deselect(i) : accesspoints.select(i);
-      }, [this, i](){
-        selectedID = i;
-        changeMenu(&apMenu);
-      });
-    }
-    addMenuNode(&apListMenu, D_SELECT_ALL, [this]() { // SELECT ALL
-      accesspoints.selectAll();
-      changeMenu(&apListMenu);
-    });
-    addMenuNode(&apListMenu, D_DESELECT_ALL, [this]() { // DESELECT ALL
-      accesspoints.deselectAll();
-      changeMenu(&apListMenu);
-    });
-    addMenuNode(&apListMenu, D_REMOVE_ALL, [this]() { // REMOVE ALL
-      accesspoints.removeAll();
-      goBack();
-    });
-  });
-
-  // STATION LIST MENU
-  createMenu(&stationListMenu, &showMenu, [this]() {
-    // add stations to list
-    int c = stations.count();
-    for (int i = 0; i < c; i++) {
-      addMenuNode(&stationListMenu, [i]() {
-        return b2a(stations.getSelected(i)) + (stations.hasName(i) ? stations.getNameStr(i) : stations.getMacVendorStr(i));
-      }, [this, i]() {
-        stations.getSelected(i) ? stations.deselect(i) : stations.select(i);
-      }, [this, i]() {
-        selectedID = i;
-        changeMenu(&stationMenu);
-      });
-    }
-    
-    addMenuNode(&stationListMenu, D_SELECT_ALL, [this]() { // SELECT ALL
-      stations.selectAll();
-      changeMenu(&stationListMenu);
-    });
-    addMenuNode(&stationListMenu, D_DESELECT_ALL, [this]() { // DESELECT ALL
-      stations.deselectAll();
-      changeMenu(&stationListMenu);
-    });
-    addMenuNode(&stationListMenu, D_REMOVE_ALL, [this]() { // REMOVE ALL
-      stations.removeAll();
-      goBack();
-    });
-  });
-
-  // NAME LIST MENU
-  createMenu(&nameListMenu, &showMenu, [this]() {
-    // add device names to list
-    int c = names.count();
-    for (int i = 0; i < c; i++) {
-      addMenuNode(&nameListMenu, [i]() {
-        return names.getSelectedStr(i) + names.getName(i);
-      }, [this, i]() {
-        names.getSelected(i) ? names.deselect(i) : names.select(i);
-      }, [this, i]() {
-        selectedID = i;
-        changeMenu(&nameMenu);
-      });
-    }
-    addMenuNode(&nameListMenu, D_SELECT_ALL, [this]() { // SELECT ALL
-      names.selectAll();
-      changeMenu(&nameListMenu);
-    });
-    addMenuNode(&nameListMenu, D_DESELECT_ALL, [this]() { // DESELECT ALL
-      names.deselectAll();
-      changeMenu(&nameListMenu);
-    });
-    addMenuNode(&nameListMenu, D_REMOVE_ALL, [this]() { // REMOVE ALL
-      names.removeAll();
-      goBack();
-    });
-  });
-
-  // SSID LIST MENU
-  createMenu(&ssidListMenu, &showMenu, [this]() {
-    addMenuNode(&ssidListMenu, D_CLONE_APS, [this]() { // CLONE APs
-      ssids.cloneSelected(true);
-      changeMenu(&ssidListMenu);
-      ssids.save(false);
-    });
-    addMenuNode(&ssidListMenu, [this](){
-      return b2a(ssids.getRandom()) + str(D_RANDOM_MODE);  // *RANDOM MODE
-    }, [this]() {
-      if(ssids.getRandom()) ssids.disableRandom();
-      else ssids.enableRandom(10);
-      changeMenu(&ssidListMenu);
-    });
-    
-    // add ssids to list
-    int c = ssids.count();
-    for (int i = 0; i < c; i++) {
-      addMenuNode(&ssidListMenu, [i]() {
-        return ssids.getName(i).substring(0, ssids.getLen(i));
-      }, [this, i]() {
-        selectedID = i;
-        changeMenu(&ssidMenu);
-      }, [this, i]() {
-        ssids.remove(i);
-        changeMenu(&ssidListMenu);
-        ssidListMenu.selected = i;
-      });
-    }
-
-    addMenuNode(&ssidListMenu, D_REMOVE_ALL, [this]() { // REMOVE ALL
-      ssids.removeAll();
-      goBack();
-    });
-  });
-
-  // AP MENU
-  createMenu(&apMenu, &apListMenu, [this]() {
-    addMenuNode(&apMenu, [this]() {
-      return accesspoints.getSelectedStr(selectedID)  + accesspoints.getSSID(selectedID); // *<ssid>
-    }, [this]() {
-      accesspoints.getSelected(selectedID) ? accesspoints.deselect(selectedID) : accesspoints.select(selectedID);
-    });
-    addMenuNode(&apMenu, [this]() {
-      return str(D_ENCRYPTION) + accesspoints.getEncStr(selectedID);
-    }, NULL); // Encryption: -/WPA2
-    addMenuNode(&apMenu, [this]() {
-      return str(D_RSSI) + (String)accesspoints.getRSSI(selectedID);
-    }, NULL); // RSSI: -90
-    addMenuNode(&apMenu, [this]() {
-      return str(D_CHANNEL) + (String)accesspoints.getCh(selectedID);
-    }, NULL); // Channel: 11
-    addMenuNode(&apMenu, [this]() {
-      return accesspoints.getMacStr(selectedID);
-    }, NULL); // 00:11:22:00:11:22
-    addMenuNode(&apMenu, [this]() {
-      return str(D_VENDOR) + accesspoints.getVendorStr(selectedID);
-    }, NULL); // Vendor: INTEL
-    addMenuNode(&apMenu, [this]() {
-      return accesspoints.getSelected(selectedID) ? str(D_DESELECT) : str(D_SELECT); // SELECT/DESELECT
-    }, [this]() {
-      accesspoints.getSelected(selectedID) ? accesspoints.deselect(selectedID) : accesspoints.select(selectedID);
-    });
-    addMenuNode(&apMenu, D_CLONE, [this]() { // CLONE
-      ssids.add(accesspoints.getSSID(selectedID), accesspoints.getEnc(selectedID) != ENC_TYPE_NONE, 60, true);
-      changeMenu(&showMenu);
-      ssids.save(false);
-    });
-    addMenuNode(&apMenu, D_REMOVE, [this]() { // REMOVE
-      accesspoints.remove(selectedID);
-      apListMenu.list->remove(apListMenu.selected);
-      goBack();
-    });
-  });
-
-  // STATION MENU
-  createMenu(&stationMenu, &stationListMenu, [this]() {
-    addMenuNode(&stationMenu, [this]() {
-      return stations.getSelectedStr(selectedID) + (stations.hasName(selectedID) ? stations.getNameStr(selectedID) : stations.getMacVendorStr(selectedID)); // <station name>
-    }, [this]() {
-      stations.getSelected(selectedID) ? stations.deselect(selectedID) : stations.select(selectedID);
-    });
-    addMenuNode(&stationMenu, [this]() {
-      return stations.getMacStr(selectedID);
-    }, NULL); // 00:11:22:00:11:22
-    addMenuNode(&stationMenu, [this]() {
-      return str(D_VENDOR) + stations.getVendorStr(selectedID);
-    }, NULL); // Vendor: INTEL
-    addMenuNode(&stationMenu, [this]() {
-      return str(D_AP) + stations.getAPStr(selectedID); // AP: someAP
-    }, [this]() {
-      int apID = accesspoints.find(stations.getAP(selectedID));
-      if(apID >= 0){
-        selectedID = apID;
-        changeMenu(&apMenu);
-      }
-    });
-    addMenuNode(&stationMenu, [this]() {
-      return str(D_PKTS) + String(*stations.getPkts(selectedID));
-    }, NULL); // Pkts: 12
-    addMenuNode(&stationMenu, [this]() {
-      return str(D_CHANNEL) + String(stations.getCh(selectedID));
-    }, NULL); // Channel: 11
-    addMenuNode(&stationMenu, [this]() {
-      return str(D_SEEN) + stations.getTimeStr(selectedID);
-    }, NULL); // Seen: <1min
-
-    addMenuNode(&stationMenu, [this]() {
-      return stations.getSelected(selectedID) ? str(D_DESELECT) : str(D_SELECT); // SELECT/DESELECT
-    }, [this]() {
-      stations.getSelected(selectedID) ? stations.deselect(selectedID) : stations.select(selectedID);
-    });
-    addMenuNode(&stationMenu, D_REMOVE, [this]() { // REMOVE
-      stations.remove(selectedID);
-      stationListMenu.list->remove(stationListMenu.selected);
-      goBack();
-    });
-  });
-
-  // NAME MENU
-  createMenu(&nameMenu, &nameListMenu, [this]() {
-    addMenuNode(&nameMenu, [this]() {
-      return names.getSelectedStr(selectedID) + names.getName(selectedID); // <station name>
-    }, [this]() {
-      names.getSelected(selectedID) ? names.deselect(selectedID) : names.select(selectedID);
-    });
-    addMenuNode(&nameMenu, [this]() {
-      return names.getMacStr(selectedID);
-    }, NULL); // 00:11:22:00:11:22
-    addMenuNode(&nameMenu, [this]() {
-      return str(D_VENDOR) + names.getVendorStr(selectedID);
-    }, NULL); // Vendor: INTEL
-    addMenuNode(&nameMenu, [this]() {
-      return str(D_AP) + names.getBssidStr(selectedID);
-    }, NULL); // AP: 00:11:22:00:11:22
-    addMenuNode(&nameMenu, [this]() {
-      return str(D_CHANNEL) + (String)names.getCh(selectedID);
-    }, NULL); // Channel: 11
-
-    addMenuNode(&nameMenu, [this]() {
-      return names.getSelected(selectedID) ? str(D_DESELECT) : str(D_SELECT); // SELECT/DESELECT
-    }, [this]() {
-      names.getSelected(selectedID) ? names.deselect(selectedID) : names.select(selectedID);
-    });
-    addMenuNode(&nameMenu, D_REMOVE, [this]() { // REMOVE
-      names.remove(selectedID);
-      nameListMenu.list->remove(nameListMenu.selected);
-      goBack();
-    });
-  });
-
-  // SSID MENU
-  createMenu(&ssidMenu, &ssidListMenu, [this]() {
-    addMenuNode(&ssidMenu, [this]() {
-      return ssids.getName(selectedID).substring(0,ssids.getLen(selectedID));
-    }, NULL); // SSID
-    addMenuNode(&ssidMenu, [this]() {
-      return str(D_ENCRYPTION) + ssids.getEncStr(selectedID); // WPA2
-    }, [this]() {
-      ssids.setWPA2(selectedID, !ssids.getWPA2(selectedID));
-    });
-    addMenuNode(&ssidMenu, D_REMOVE, [this]() { // REMOVE
-      ssids.remove(selectedID);
-      ssidListMenu.list->remove(ssidListMenu.selected);
-      goBack();
-    });
-  });
-
-  // ATTACK MENU
-  createMenu(&attackMenu, &mainMenu, [this]() {
-    addMenuNode(&attackMenu, [this]() { // *DEAUTH 0/0
-      if(attack.isRunning()) return buildString(b2a(deauthSelected) + str(D_DEAUTH), (String)attack.getDeauthPkts() + SLASH + (String)attack.getDeauthMaxPkts(), CHARS_PER_LINE);
-      else return buildString(b2a(deauthSelected) + str(D_DEAUTH) , (String)scan.countSelected(), CHARS_PER_LINE);
-    }, [this]() { // deauth
-      deauthSelected = !deauthSelected;
-      if (attack.isRunning()) {
-        attack.start(beaconSelected, deauthSelected, false, probeSelected, true, settings.getAttackTimeout() * 1000);
-      }
-    });
-    addMenuNode(&attackMenu, [this]() { // *BEACON 0/0
-      if(attack.isRunning()) return buildString(b2a(beaconSelected) + str(D_BEACON), (String)attack.getBeaconPkts() + SLASH + (String)attack.getBeaconMaxPkts(), CHARS_PER_LINE);
-      else return buildString(b2a(beaconSelected) + str(D_BEACON), (String)ssids.count(), CHARS_PER_LINE);
-    }, [this]() { // beacon
-      beaconSelected = !beaconSelected;
-      if (attack.isRunning()) {
-        attack.start(beaconSelected, deauthSelected, false, probeSelected, true, settings.getAttackTimeout() * 1000);
-      }
-    });
-    addMenuNode(&attackMenu, [this]() { // *PROBE 0/0
-      if(attack.isRunning()) return buildString(b2a(probeSelected) + str(D_PROBE), (String)attack.getProbePkts() + SLASH + (String)attack.getProbeMaxPkts(), CHARS_PER_LINE);
-      else return buildString(b2a(probeSelected) + str(D_PROBE), (String)ssids.count(), CHARS_PER_LINE);
-    }, [this]() { // probe
-      probeSelected = !probeSelected;
-      if (attack.isRunning()) {
-        attack.start(beaconSelected, deauthSelected, false, probeSelected, true, settings.getAttackTimeout() * 1000);
-      }
-    });
-    addMenuNode(&attackMenu, []() { // START
-      return buildString(str(attack.isRunning() ? D_STOP_ATTACK : D_START_ATTACK), attack.getPacketRate() > 0 ? (String)attack.getPacketRate() : String(), CHARS_PER_LINE);
-    }, [this]() {
-      if (attack.isRunning()) attack.stop();
-      else attack.start(beaconSelected, deauthSelected, false, probeSelected, true, settings.getAttackTimeout() * 1000);
-    });
-  });
+  // catch the edges of the pins in buttonInterrupt(), GPIO 16 has no interrupt and is polled
+  for (int i = 0; i < 6; i++) {
+    buttonGpio[i] = buttons[i]->enabled ? buttons[i]->gpio : 0xFF;
+    if (!buttons[i]->enabled) continue;
+    if (buttons[i]->gpio == 16) buttonPolling = true;
+    else attachInterrupt(digitalPinToInterrupt(buttons[i]->gpio), buttonInterrupt, CHANGE);
+  }
+  buttonLevels = readButtons();
+  for (int i = 0; i < 6; i++) {
+    buttons[i]->level = buttons[i]->down = buttonLevels >> i & 1;
+    buttons[i]->levelTime = buttons[i]->downTime = buttons[i]->tickTime = millis();
+  }
 
+  // ===== MENUS ===== //
+  createMenu(&mainMenu, NULL, mainNodes, MENU_SIZE(mainNodes));
+  createMenu(&scanMenu, &mainMenu, scanNodes, MENU_SIZE(scanNodes));
+  createMenu(&showMenu, &mainMenu, showNodes, MENU_SIZE(showNodes));
+  createMenu(&attackMenu, &mainMenu, attackNodes, MENU_SIZE(attackNodes));
+  createMenu(&apListMenu, &showMenu, apListNodes, MENU_SIZE(apListNodes));
+  createMenu(&stationListMenu, &showMenu, stationListNodes, MENU_SIZE(stationListNodes));
+  createMenu(&nameListMenu, &showMenu, nameListNodes, MENU_SIZE(nameListNodes));
+  createMenu(&ssidListMenu, &showMenu, ssidListNodes, MENU_SIZE(ssidListNodes));
+  createMenu(&apMenu, &apListMenu, apNodes, MENU_SIZE(apNodes));
+  createMenu(&stationMenu, &stationListMenu, stationNodes, MENU_SIZE(stationNodes));
+  createMenu(&nameMenu, &nameListMenu, nameNodes, MENU_SIZE(nameNodes));
+  createMenu(&ssidMenu, &ssidListMenu, ssidNodes, MENU_SIZE(ssidNodes));
   // ===================== //
 
   // set current menu to main menu
@@ -635,9 +424,13 @@ void DisplayUI::setup() {
 void DisplayUI::update() {
   if (!enabled) return;
 
+  // send the last frame a bit per loop, so the web server and CLI keep running
+  if (display.isFlushing()) display.flushStep(FLUSH_BUDGET);
+
   // when display is off
   if (mode == SCREEN_MODE_OFF) {
-    if (updateButton(&buttonA)){
+    updateButtons(1 << 4); // only buttonA turns it on
+    if (buttonA.pushed){
       on();
       buttonA.hold = true; // to make sure you don't double click
     }
@@ -657,23 +450,22 @@ void DisplayUI::update() {
       }
     }
 
-    // only one button can be pressed at a time
-    if (updateButton(&buttonB)) draw();
-    else if (updateButton(&buttonA)) draw();
-    else if (updateButton(&buttonUp)) draw();
-    else if (updateButton(&buttonDown)) draw();
-    else if (updateButton(&buttonLeft)) draw();
-    else if (updateButton(&buttonRight)) draw();
-    else draw();
+    updateButtons(0xFF);
+    draw();
   }
 }
 
 void DisplayUI::draw() {
-  if (currentTime - drawTime > DRAW_INTERVAL && currentMenu) {
+  if (currentTime - drawTime > DRAW_INTERVAL && currentMenu && !display.isFlushing()) {
     drawTime = currentTime;
+    bool changed = true;
 
     // ===== adjustable ===== //
-    display.clear(); // clear display
+    // the menu keeps what's on the display and only redraws rows that changed
+    if (mode != SCREEN_MODE_MENU) {
+      display.clear(); // clear display
+      rowsValid = false;
+    }
     display.setTextAlignment(TEXT_ALIGN_LEFT); // reset text alignment just in case ;)
     // ====================== //
 
@@ -682,7 +474,7 @@ void DisplayUI::draw() {
         drawButtonTest();
         break;
       case SCREEN_MODE_MENU:
-        drawMenu();
+        changed = drawMenu();
         break;
       case SCREEN_MODE_LOADSCAN:
         drawLoadingScan();
@@ -699,7 +491,7 @@ void DisplayUI::draw() {
     }
 
     // ===== adjustable ===== //
-    display.display(); // draw changes
+    if (changed) display.beginFlush(); // send changes, see update()
     // ====================== //
   }
 }
@@ -721,30 +513,66 @@ void DisplayUI::drawButtonTest() {
   // ====================== //
 }
 
-void DisplayUI::drawMenu() {
+bool DisplayUI::drawMenu() {
   String tmp;
   int tmpLen;
-  int row = (currentMenu->selected / 5) * 5;
+  int nodes = countNodes();
+  int row = (currentMenu->selected / MENU_ROWS) * MENU_ROWS;
+  bool changed[MENU_ROWS];
+  bool anyChanged = false;
 
   // correct selected if it's off
   if (currentMenu->selected < 0) currentMenu->selected = 0;
-  else if (currentMenu->selected >= currentMenu->list->size()) currentMenu->selected = currentMenu->list->size() - 1;
-
-  // draw menu entries
-  for (int i = row; i < currentMenu->list->size() && i < row + 5; i++) {
-    tmp = currentMenu->list->get(i).getStr();
-    tmpLen = tmp.length();
-
-    // horizontal scrolling
-    if (currentMenu->selected == i && tmpLen > CHARS_PER_LINE) {
-      tmp = tmp.substring(scrollCounter / SCROLL_SPEED);
-      scrollCounter++;
-      if (scrollCounter / SCROLL_SPEED > tmpLen - CHARS_PER_LINE) scrollCounter = 0;
+  else if (currentMenu->selected >= nodes) currentMenu->selected = nodes - 1;
+
+  // build the text of every row and compare it with what's on the display
+  for (int i = 0; i < MENU_ROWS; i++) {
+    tmp = String();
+
+    if (row + i < nodes) {
+      tmp = getLabel(row + i);
+      tmpLen = tmp.length();
+
+      // horizontal scrolling
+      if (currentMenu->selected == row + i && tmpLen > CHARS_PER_LINE) {
+        tmp = tmp.substring(scrollCounter / SCROLL_SPEED);
+        scrollCounter++;
+        if (scrollCounter / SCROLL_SPEED > tmpLen - CHARS_PER_LINE) scrollCounter = 0;
+      }
+
+      tmp = (currentMenu->selected == row + i ? CURSOR : SPACE) + tmp;
+    }
+
+    changed[i] = !rowsValid || tmp != rowText[i];
+    if (changed[i]) {
+      rowText[i] = tmp;
+      anyChanged = true;
     }
+  }
 
-    tmp = (currentMenu->selected == i ? CURSOR : SPACE) + tmp;
-    drawString(0, (i - row) * 12, tmp);
+  if (!anyChanged) return false;
+  if (!rowsValid) display.clear();
+  rowsValid = true;
+
+  // glyphs are taller than a row, so a row that changed also dirties the one below
+  // and whatever is drawn into a cleared row has to be drawn again
+  bool cleared[MENU_ROWS + 1];
+  for (int i = 0; i < MENU_ROWS; i++) {
+    cleared[i] = changed[i] || (i > 0 && changed[i - 1]);
+    if (cleared[i]) {
+      int y = i * ROW_HEIGHT;
+      display.setColor(BLACK);
+      display.fillRect(0, y, display.getWidth(), i == MENU_ROWS - 1 ? display.getHeight() - y : ROW_HEIGHT);
+      display.setColor(WHITE);
+    }
   }
+  cleared[MENU_ROWS] = false;
+
+  for (int i = 0; i < MENU_ROWS; i++) {
+    if (cleared[i] || cleared[i + 1]) drawString(0, i * ROW_HEIGHT, rowText[i]);
+  }
+
+  return true;
 }
 
 void DisplayUI::drawLoadingScan() {
@@ -793,26 +621,128 @@ void DisplayUI::drawIntro(){
   // ====================== //
 }
 
-bool DisplayUI::updateButton(Button* button) {
-  // direct exit when button is disabled or has no read function
-  if (!button->enabled || !button->read) return false;
+// called on every edge of a button pin, so it is kept in IRAM and short
+void ICACHE_RAM_ATTR DisplayUI::buttonInterrupt() {
+  uint8_t levels = readButtons();
+  if (levels == buttonLevels) return;
+  buttonLevels = levels;
+
+  uint8_t next = (buttonHead + 1) & (BUTTON_QUEUE_SIZE - 1);
+  if (next == buttonTail) {
+    buttonLost = true;
+    return;
+  }
+  buttonQueue[buttonHead].levels = levels;
+  buttonQueue[buttonHead].time = millis();
+  buttonHead = next; // only the interrupt writes buttonHead, only updateButtons() buttonTail
+}
+
+uint8_t ICACHE_RAM_ATTR DisplayUI::readButtons() {
+  uint8_t levels = 0;
+  for (uint8_t i = 0; i < 6; i++) {
+    if (buttonGpio[i] != 0xFF && !digitalRead(buttonGpio[i])) levels |= 1 << i;
+  }
+  return levels;
+}
+
+void DisplayUI::updateButtons(uint8_t mask) {
+  if (buttonPolling) {
+    noInterrupts();
+    buttonInterrupt();
+    interrupts();
+  }
+
+  while (buttonTail != buttonHead) {
+    uint8_t levels = buttonQueue[buttonTail].levels;
+    uint32_t time = buttonQueue[buttonTail].time;
+    buttonTail = (buttonTail + 1) & (BUTTON_QUEUE_SIZE - 1);
+    handleButtons(levels, time, mask);
+  }
 
-  // read pin
-  if(button->read()){
-    if(button->push) button->push();
-  }else{
-    if(button->release) button->release();
+  uint32_t now = millis();
+
+  // when edges got lost, go on from the levels the interrupt saw last. How
+  // long the pins kept them is unknown, so the debounce of a changed one starts over.
+  if (buttonLost) {
+    buttonLost = false;
+    uint8_t levels = buttonLevels;
+    for (uint8_t i = 0; i < 6; i++) {
+      bool level = levels >> i & 1;
+      if (level == buttons[i]->level) continue;
+      buttons[i]->level = level;
+      buttons[i]->levelTime = now;
+    }
   }
 
-  return button->pushed;
+  for (uint8_t i = 0; i < 6; i++) {
+    settleButton(i, now, mask);
+    tickButton(i, now, mask);
+  }
 }
 
-void DisplayUI::clearMenu(Menu* menu) {
-  while (menu->list->size() > 0) {
-    menu->list->remove(0);
+void DisplayUI::handleButtons(uint8_t levels, uint32_t time, uint8_t mask) {
+  for (uint8_t i = 0; i < 6; i++) {
+    bool level = levels >> i & 1;
+    if (level == buttons[i]->level) continue;
+    settleButton(i, time, mask); // the level before this edge may have been stable long enough
+    buttons[i]->level = level;
+    buttons[i]->levelTime = time;
   }
 }
 
+// takes the level of the pin once it kept it for BUTTON_DEBOUNCE ms until time
+void DisplayUI::settleButton(uint8_t num, uint32_t time, uint8_t mask) {
+  Button* button = buttons[num];
+  if (button->level == button->down || (int32_t)(time - button->levelTime) < BUTTON_DEBOUNCE) return;
+
+  if (button->level) {
+    button->down = true;
+    button->downTime = button->tickTime = button->levelTime;
+    buttonTime = button->levelTime;
+    if ((mask >> num & 1) && button->push) button->push();
+  } else {
+    tickButton(num, button->levelTime, mask);
+    button->down = false;
+    buttonTime = button->levelTime;
+    if (button->release) button->release(); // returns early when the push was not handled
+  }
+}
+
+// repeats push every BUTTON_DELAY ms while the button is down, and once after BUTTON_HOLD ms
+void DisplayUI::tickButton(uint8_t num, uint32_t time, uint8_t mask) {
+  Button* button = buttons[num];
+  if (!button->down || (int32_t)(time - button->downTime) < 0) return;
+
+  // only the last repeat that is due, in case update() was late
+  uint32_t tick = button->downTime + (time - button->downTime) / BUTTON_DELAY * BUTTON_DELAY;
+  uint32_t hold = button->downTime + BUTTON_HOLD + 1;
+  if ((int32_t)(time - hold) >= 0 && (int32_t)(hold - tick) > 0) tick = hold;
+  if ((int32_t)(tick - button->tickTime) <= 0) return;
+
+  button->tickTime = tick;
+  buttonTime = tick;
+  if ((mask >> num & 1) && button->push) button->push();
+}
+
+String DisplayUI::getLabel(int num) {
+  MenuNode node;
+  int arg = getNode(num, &node);
+  if (arg < 0) return String();
+  if (!node.getStr) return str(node.str);
+  if (!node.cache) return (this->*node.getStr)(arg);
+
+  // the pages of a menu are MENU_ROWS nodes long, so the nodes of a page never share a label
+  uint32_t generation = accesspoints.getGeneration() + stations.getGeneration() + names.getGeneration() + settings.getGeneration();
+  MenuLabel* label = &labels[num % MENU_ROWS];
+  if (label->menu != currentMenu || label->node != num || label->generation != generation) {
+    label->menu = currentMenu;
+    label->node = num;
+    label->generation = generation;
+    label->str = replaceUtf8((this->*node.getStr)(arg), String(QUESTIONMARK));
+  }
+  return label->str;
+}
+
 void DisplayUI::changeMenu(Menu* menu) {
   if (menu) {
     // only open list menu if it has nodes
@@ -822,16 +752,10 @@ void DisplayUI::changeMenu(Menu* menu) {
         (menu == &ssidListMenu && ssids.count() == 0)){
       return;
     }
-    if (currentMenu) clearMenu(currentMenu);
     currentMenu = menu;
-    currentMenu->selected = 0;
+    currentMenu->selected = currentMenu->parentMenu ? 1 : 0; // skip [BACK]
     buttonA.time = currentTime;
     if(selectedID < 0) selectedID = 0;
-    if (currentMenu->parentMenu) {
-      addMenuNode(currentMenu, D_BACK, currentMenu->parentMenu); // add [BACK]
-      currentMenu->selected = 1;
-    }
-    if (currentMenu->build) currentMenu->build();
   }
 }
 
@@ -839,37 +763,302 @@ void DisplayUI::goBack() {
   if (currentMenu->parentMenu) changeMenu(currentMenu->parentMenu);
 }
 
-void DisplayUI::createMenu(Menu* menu, Menu* parent, std::function<void()> build) {
-  menu->list = new SimpleList<MenuNode>;
+void DisplayUI::createMenu(Menu* menu, Menu* parent, const MenuNode* nodes, uint8_t size) {
+  menu->nodes = nodes;
+  menu->size = size;
   menu->parentMenu = parent;
   menu->selected = 0;
-  menu->build = build;
 }
 
-void DisplayUI::addMenuNode(Menu* menu, std::function<String()> getStr, std::function<void()> click, std::function<void()> hold) {
-  menu->list->add(MenuNode{getStr, click, hold});
+int DisplayUI::countNodes() {
+  int c = 0;
+  MenuNode node;
+  for (int i = 0; i < currentMenu->size; i++) {
+    memcpy_P(&node, &currentMenu->nodes[i], sizeof(MenuNode));
+    c += node.count ? (this->*node.count)() : 1;
+  }
+  return c;
+}
+
+// copies the table entry of node num of the current menu to node,
+// returns the index of the list entry or the arg, -1 when there is no such node
+int DisplayUI::getNode(int num, MenuNode* node) {
+  if (num < 0) return -1;
+  for (int i = 0; i < currentMenu->size; i++) {
+    memcpy_P(node, &currentMenu->nodes[i], sizeof(MenuNode));
+    int c = node->count ? (this->*node->count)() : 1;
+    if (num < c) return node->count ? num : node->arg;
+    num -= c;
+  }
+  return -1;
+}
+
+void DisplayUI::clickNode(int num) {
+  MenuNode node;
+  int arg = getNode(num, &node);
+  if (arg < 0) return;
+  if (node.click) (this->*node.click)(arg);
+  else if (node.next) changeMenu(&(this->*node.next));
+}
+
+void DisplayUI::holdNode(int num) {
+  MenuNode node;
+  int arg = getNode(num, &node);
+  if (arg >= 0 && node.hold) (this->*node.hold)(arg);
+}
+
+uint32_t DisplayUI::getMenuFlash() {
+  return sizeof(mainNodes) + sizeof(scanNodes) + sizeof(showNodes) + sizeof(attackNodes)
+         + sizeof(apListNodes) + sizeof(stationListNodes) + sizeof(nameListNodes) + sizeof(ssidListNodes)
+         + sizeof(apNodes) + sizeof(stationNodes) + sizeof(nameNodes) + sizeof(ssidNodes);
+}
+
+uint32_t DisplayUI::getMenuHeapSaved() {
+  if (!currentMenu) return 0;
+  // a SimpleList node with three std::function, the closures fit into them
+  return countNodes() * (sizeof(std::function<String()>) + 2 * sizeof(std::function<void()>) + sizeof(void*));
+}
+
+// ===== MENU NODE FUNCTIONS ===== //
+String DisplayUI::getListCount(int num) {
+  switch (num) {
+    case MENU_LIST_APS:
+      return buildString(str(D_ACCESSPOINTS), (String)accesspoints.count(), CHARS_PER_LINE);
+    case MENU_LIST_STATIONS:
+      return buildString(str(D_STATIONS), (String)stations.count(), CHARS_PER_LINE);
+    case MENU_LIST_NAMES:
+      return buildString(str(D_NAMES), (String)names.count(), CHARS_PER_LINE);
+    default:
+      return buildString(str(D_SSIDS), (String)ssids.count(), CHARS_PER_LINE);
+  }
+}
+
+String DisplayUI::getAPLabel(int num) {
+  return b2a(accesspoints.getSelected(num)) + accesspoints.getSSID(num);
+}
+
+String DisplayUI::getStationLabel(int num) {
+  return b2a(stations.getSelected(num)) + (stations.hasName(num) ? stations.getNameStr(num) : stations.getMacVendorStr(num));
+}
+
+String DisplayUI::getNameLabel(int num) {
+  return names.getSelectedStr(num) + names.getName(num);
+}
+
+String DisplayUI::getSSIDLabel(int num) {
+  return ssids.getName(num).substring(0, ssids.getLen(num));
+}
+
+String DisplayUI::getRandomMode(int num) {
+  return b2a(ssids.getRandom()) + str(D_RANDOM_MODE);
+}
+
+String DisplayUI::getAPInfo(int num) {
+  switch (num) {
+    case 0: return accesspoints.getSelectedStr(selectedID) + accesspoints.getSSID(selectedID);
+    case 1: return str(D_ENCRYPTION) + accesspoints.getEncStr(selectedID);
+    case 2: return str(D_RSSI) + (String)accesspoints.getRSSI(selectedID);
+    case 3: return str(D_CHANNEL) + (String)accesspoints.getCh(selectedID);
+    case 4: return accesspoints.getMacStr(selectedID);
+    case 5: return str(D_VENDOR) + accesspoints.getVendorStr(selectedID);
+    default: return accesspoints.getSelected(selectedID) ? str(D_DESELECT) : str(D_SELECT);
+  }
+}
+
+String DisplayUI::getStationInfo(int num) {
+  switch (num) {
+    case 0: return stations.getSelectedStr(selectedID) + (stations.hasName(selectedID) ? stations.getNameStr(selectedID) : stations.getMacVendorStr(selectedID));
+    case 1: return stations.getMacStr(selectedID);
+    case 2: return str(D_VENDOR) + stations.getVendorStr(selectedID);
+    case 3: return str(D_AP) + stations.getAPStr(selectedID);
+    case 4: return str(D_PKTS) + String(*stations.getPkts(selectedID));
+    case 5: return str(D_CHANNEL) + String(stations.getCh(selectedID));
+    case 6: return str(D_SEEN) + stations.getTimeStr(selectedID);
+    default: return stations.getSelected(selectedID) ? str(D_DESELECT) : str(D_SELECT);
+  }
+}
+
+String DisplayUI::getNameInfo(int num) {
+  switch (num) {
+    case 0: return names.getSelectedStr(selectedID) + names.getName(selectedID);
+    case 1: return names.getMacStr(selectedID);
+    case 2: return str(D_VENDOR) + names.getVendorStr(selectedID);
+    case 3: return str(D_AP) + names.getBssidStr(selectedID);
+    case 4: return str(D_CHANNEL) + (String)names.getCh(selectedID);
+    default: return names.getSelected(selectedID) ? str(D_DESELECT) : str(D_SELECT);
+  }
+}
+
+String DisplayUI::getSSIDInfo(int num) {
+  if (num == 0) return ssids.getName(selectedID).substring(0, ssids.getLen(selectedID));
+  return str(D_ENCRYPTION) + ssids.getEncStr(selectedID);
+}
+
+String DisplayUI::getAttackInfo(int num) {
+  switch (num) {
+    case 0:
+      if (attack.isRunning()) return buildString(b2a(deauthSelected) + str(D_DEAUTH), (String)attack.getDeauthPkts() + SLASH + (String)attack.getDeauthMaxPkts(), CHARS_PER_LINE);
+      return buildString(b2a(deauthSelected) + str(D_DEAUTH), (String)scan.countSelected(), CHARS_PER_LINE);
+    case 1:
+      if (attack.isRunning()) return buildString(b2a(beaconSelected) + str(D_BEACON), (String)attack.getBeaconPkts() + SLASH + (String)attack.getBeaconMaxPkts(), CHARS_PER_LINE);
+      return buildString(b2a(beaconSelected) + str(D_BEACON), (String)ssids.count(), CHARS_PER_LINE);
+    case 2:
+      if (attack.isRunning()) return buildString(b2a(probeSelected) + str(D_PROBE), (String)attack.getProbePkts() + SLASH + (String)attack.getProbeMaxPkts(), CHARS_PER_LINE);
+      return buildString(b2a(probeSelected) + str(D_PROBE), (String)ssids.count(), CHARS_PER_LINE);
+    default:
+      return buildString(str(attack.isRunning() ? D_STOP_ATTACK : D_START_ATTACK), attack.getPacketRate() > 0 ? (String)attack.getPacketRate() : String(), CHARS_PER_LINE);
+  }
+}
+
+int DisplayUI::countAPs() {
+  return accesspoints.count();
+}
+
+int DisplayUI::countStations() {
+  return stations.count();
+}
+
+int DisplayUI::countNames() {
+  return names.count();
+}
+
+int DisplayUI::countSSIDs() {
+  return ssids.count();
 }
 
-void DisplayUI::addMenuNode(Menu* menu, std::function<String()> getStr, std::function<void()> click) {
-  addMenuNode(menu, getStr, click, NULL);
+void DisplayUI::back(int num) {
+  goBack();
 }
 
-void DisplayUI::addMenuNode(Menu* menu, std::function<String()> getStr, Menu* next) {
-  addMenuNode(menu, getStr, [this, next]() {
-    changeMenu(next);
-  });
+void DisplayUI::startScan(int num) {
+  if (num == 0) scan.start(SCAN_MODE_ALL, 15000, SCAN_MODE_OFF, 0, true, wifi_channel); // SCAN AP + ST
+  else if (num == 1) scan.start(SCAN_MODE_APS, 0, SCAN_MODE_OFF, 0, true, wifi_channel); // SCAN AP
+  else scan.start(SCAN_MODE_STATIONS, 30000, SCAN_MODE_OFF, 0, true, wifi_channel); // SCAN ST
+  mode = SCREEN_MODE_LOADSCAN;
 }
 
-void DisplayUI::addMenuNode(Menu* menu, const char* ptr, std::function<void()> click) {
-  addMenuNode(menu, [ptr]() {
-    return str(ptr);
-  }, click);
+void DisplayUI::startPacketMonitor(int num) {
+  scan.start(SCAN_MODE_SNIFFER, 0, SCAN_MODE_OFF, 0, false, wifi_channel);
+  mode = SCREEN_MODE_PACKETMONITOR;
 }
 
-void DisplayUI::addMenuNode(Menu* menu, const char* ptr, Menu* next) {
-  addMenuNode(menu, [ptr]() {
-    return str(ptr);
-  }, next);
+void DisplayUI::selectAll(int num) {
+  if (num == MENU_LIST_APS) accesspoints.selectAll();
+  else if (num == MENU_LIST_STATIONS) stations.selectAll();
+  else if (num == MENU_LIST_NAMES) names.selectAll();
+  changeMenu(currentMenu);
 }
 
+void DisplayUI::deselectAll(int num) {
+  if (num == MENU_LIST_APS) accesspoints.deselectAll();
+  else if (num == MENU_LIST_STATIONS) stations.deselectAll();
+  else if (num == MENU_LIST_NAMES) names.deselectAll();
+  changeMenu(currentMenu);
+}
+
+void DisplayUI::removeAll(int num) {
+  if (num == MENU_LIST_APS) accesspoints.removeAll();
+  else if (num == MENU_LIST_STATIONS) stations.removeAll();
+  else if (num == MENU_LIST_NAMES) names.removeAll();
+  else ssids.removeAll();
+  goBack();
+}
+
+void DisplayUI::toggleAP(int num) {
+  accesspoints.getSelected(num) ? accesspoints.deselect(num) : accesspoints.select(num);
+}
+
+void DisplayUI::toggleStation(int num) {
+  stations.getSelected(num) ? stations.deselect(num) : stations.select(num);
+}
+
+void DisplayUI::toggleName(int num) {
+  names.getSelected(num) ? names.deselect(num) : names.select(num);
+}
+
+// (de)selects the entry of the open AP, station or name menu
+void DisplayUI::toggleSelected(int num) {
+  if (currentMenu == &apMenu) toggleAP(selectedID);
+  else if (currentMenu == &stationMenu) toggleStation(selectedID);
+  else if (currentMenu == &nameMenu) toggleName(selectedID);
+}
+
+// removes the entry of the open AP, station, name or SSID menu
+void DisplayUI::removeSelected(int num) {
+  if (currentMenu == &apMenu) accesspoints.remove(selectedID);
+  else if (currentMenu == &stationMenu) stations.remove(selectedID);
+  else if (currentMenu == &nameMenu) names.remove(selectedID);
+  else if (currentMenu == &ssidMenu) ssids.remove(selectedID);
+  goBack();
+}
+
+void DisplayUI::openAP(int num) {
+  selectedID = num;
+  changeMenu(&apMenu);
+}
+
+void DisplayUI::openStation(int num) {
+  selectedID = num;
+  changeMenu(&stationMenu);
+}
+
+void DisplayUI::openName(int num) {
+  selectedID = num;
+  changeMenu(&nameMenu);
+}
+
+void DisplayUI::openSSID(int num) {
+  selectedID = num;
+  changeMenu(&ssidMenu);
+}
+
+void DisplayUI::openStationAP(int num) {
+  int apID = accesspoints.find(stations.getAP(selectedID));
+  if(apID >= 0){
+    selectedID = apID;
+    changeMenu(&apMenu);
+  }
+}
+
+void DisplayUI::cloneAP(int num) {
+  ssids.add(accesspoints.getSSID(selectedID), accesspoints.getEnc(selectedID) != ENC_TYPE_NONE, 60, true);
+  changeMenu(&showMenu);
+  ssids.save(false);
+}
+
+void DisplayUI::cloneAPs(int num) {
+  ssids.cloneSelected(true);
+  changeMenu(&ssidListMenu);
+  ssids.save(false);
+}
+
+void DisplayUI::toggleRandom(int num) {
+  if(ssids.getRandom()) ssids.disableRandom();
+  else ssids.enableRandom(10);
+  changeMenu(&ssidListMenu);
+}
+
+void DisplayUI::toggleWPA2(int num) {
+  ssids.setWPA2(selectedID, !ssids.getWPA2(selectedID));
+}
+
+void DisplayUI::removeSSID(int num) {
+  ssids.remove(num);
+  changeMenu(&ssidListMenu);
+  ssidListMenu.selected = num;
+}
+
+void DisplayUI::toggleAttack(int num) {
+  if (num == 0) deauthSelected = !deauthSelected;
+  else if (num == 1) beaconSelected = !beaconSelected;
+  else probeSelected = !probeSelected;
+  if (attack.isRunning()) {
+    attack.start(beaconSelected, deauthSelected, false, probeSelected, true, settings.getAttackTimeout() * 1000);
+  }
+}
+
+void DisplayUI::startAttack(int num) {
+  if (attack.isRunning()) attack.stop();
+  else attack.start(beaconSelected, deauthSelected, false, probeSelected, true, settings.getAttackTimeout() * 1000);
+}
 
@@ -37,10 +37,22 @@ extern String replaceUtf8(String str, String r);
 #define SCREEN_MODE_PACKETMONITOR 4
 #define SCREEN_MODE_INTRO 5
 
+// lists the menu node functions work on
+#define MENU_LIST_APS 0
+#define MENU_LIST_STATIONS 1
+#define MENU_LIST_NAMES 2
+#define MENU_LIST_SSIDS 3
+
 // ===== adjustable ===== //
 #define BUTTON_DELAY 280  // in ms
+#define BUTTON_HOLD 800 // in ms, pushing button A that long holds it
+#define BUTTON_DEBOUNCE 20 // in ms, a pin has to keep its level that long to count
+#define BUTTON_QUEUE_SIZE 32 // button edges that fit in the queue, power of 2
 #define DRAW_INTERVAL 100 // 100ms = 10 FPS
+#define FLUSH_BUDGET 2000 // max. time in us sending a frame may take per loop
 #define CHARS_PER_LINE 17
+#define MENU_ROWS 5 // menu entries per page
+#define ROW_HEIGHT 12 // in px, glyphs reach into the next row
 #define SCROLL_SPEED 5
 #define SCREEN_INTRO_TIME 2500
 // ====================== //
@@ -48,6 +60,13 @@ extern String replaceUtf8(String str, String r);
 struct Menu;
 struct MenuNode;
 struct Button;
+struct ButtonEvent;
+class DisplayUI;
+
+// menu node functions get the index of the list entry or the arg of the node
+typedef String (DisplayUI::*MenuStrFunc)(int num);
+typedef void (DisplayUI::*MenuFunc)(int num);
+typedef int (DisplayUI::*MenuCountFunc)();
 
 struct Button {
   bool enabled; // use button
@@ -55,23 +74,46 @@ struct Button {
   bool pushed; // currently pushed
   bool hold; // if button was hold (only used for buttonA at the moment)
   uint32_t time; // last time it was pushed 
-  std::function<bool()> read; // function to return if button is pushed
+  bool down; // debounced pin level, true when pushed
+  bool level; // last pin level from the queue
+  uint32_t levelTime; // when the pin changed to level
+  uint32_t downTime; // when down was set
+  uint32_t tickTime; // last time push was repeated while down
   std::function<void()> setup; // function to enable/setup the button, if needed
   std::function<void()> push; // function that is executed when button is pushed
   std::function<void()> release; // function that is executed when button is released
 };
 
+// levels of all buttons (bit n for buttons[n], set when pushed) after an edge
+struct ButtonEvent {
+  uint8_t levels;
+  uint32_t time;
+};
+
 struct Menu {
-  SimpleList<MenuNode>* list;
+  const MenuNode* nodes; // node table in PROGMEM
+  uint8_t size; // nodes in the table
   Menu* parentMenu;
   uint8_t selected;
-  std::function<void()> build; // function that is executed when button is clicked
 };
 
+// the menus are tables of these in PROGMEM, see DisplayUI.cpp
 struct MenuNode {
-  std::function<String()> getStr; // function used to create the displayed string
-  std::function<void()> click; // function that is executed when node is clicked
-  std::function<void()> hold; // function that is executed when node is pressed for > 800ms
+  const char* str; // PROGMEM string that is displayed when there is no getStr
+  MenuStrFunc getStr; // function used to create the displayed string
+  int8_t arg; // passed to the functions, unless it's a list node
+  MenuFunc click; // function that is executed when node is clicked
+  MenuFunc hold; // function that is executed when node is pressed for > 800ms
+  Menu DisplayUI::* next; // menu that is opened when node is clicked and there is no click function
+  MenuCountFunc count; // makes it a list node that stands for count() nodes, one per entry
+  bool cache; // string only changes with the scan results, names and settings, see getLabel()
+};
+
+struct MenuLabel {
+  Menu* menu = NULL;
+  int node = 0;
+  uint32_t generation = 0; // sum of the generations of the lists it was made from
+  String str;
 };
 
 class DisplayUI {
@@ -82,6 +124,9 @@ class DisplayUI {
     void on();
     void off();
 
+    uint32_t getMenuFlash(); // bytes of the menu tables
+    uint32_t getMenuHeapSaved(); // bytes the current menu took on the heap as std::function nodes
+
     uint8_t mode = SCREEN_MODE_MENU;
   private:
     DEAUTHER_DISPLAY // see config.h
@@ -92,6 +137,14 @@ class DisplayUI {
     int16_t selectedID = 0; // i.e. access point ID to draw the apMenu
     uint16_t scrollCounter = 0; // for horizontal scrolling
     uint32_t drawTime = 0; // last time a frame was drawn
+
+    // what each menu row shows on the display, see drawMenu()
+    String rowText[MENU_ROWS];
+    bool rowsValid = false;
+
+    // strings of the cached menu nodes on the current page, see getLabel()
+    MenuLabel labels[MENU_ROWS];
+
     uint32_t startTime = 0; // when the screen was enabled
     bool enabled = false; // display enabled
     
@@ -101,6 +154,18 @@ class DisplayUI {
     Button buttonRight;
     Button buttonA;
     Button buttonB;
+    Button* buttons[6] = { &buttonUp, &buttonDown, &buttonLeft, &buttonRight, &buttonA, &buttonB };
+
+    uint32_t buttonTime = 0; // time of the button event that is handled
+
+    // button edges, written by buttonInterrupt() and read by updateButtons()
+    static uint8_t buttonGpio[6];
+    static volatile ButtonEvent buttonQueue[BUTTON_QUEUE_SIZE];
+    static volatile uint8_t buttonHead;
+    static volatile uint8_t buttonTail;
+    static volatile uint8_t buttonLevels; // levels of the last edge
+    static volatile bool buttonLost; // queue was full
+    bool buttonPolling = false; // a button has no interrupt, see setup()
     
     // selected attack modes
     bool beaconSelected = false;
@@ -108,29 +173,74 @@ class DisplayUI {
     bool probeSelected = false;
 
     // functions for buttons
-    bool updateButton(Button* button); // read and update
+    static void buttonInterrupt();
+    static uint8_t readButtons();
+    void updateButtons(uint8_t mask); // handle queued edges, only call functions of the buttons in mask
+    void handleButtons(uint8_t levels, uint32_t time, uint8_t mask);
+    void settleButton(uint8_t num, uint32_t time, uint8_t mask);
+    void tickButton(uint8_t num, uint32_t time, uint8_t mask);
 
     // draw functions
     void draw();
     void drawString(int x, int y, String str);
     void drawButtonTest();
-    void drawMenu();
+    bool drawMenu();
     void drawLoadingScan();
     void drawPacketMonitor();
     void drawIntro();
-    void clearMenu(Menu* menu);
+    String getLabel(int num);
     
     // menu functions
     void changeMenu(Menu* menu);
     void goBack();
-    void createMenu(Menu* menu, Menu* parent, std::function<void()> build);
+    void createMenu(Menu* menu, Menu* parent, const MenuNode* nodes, uint8_t size);
+    int countNodes();
+    int getNode(int num, MenuNode* node);
+    void clickNode(int num);
+    void holdNode(int num);
+
+    // menu node functions, see the node tables in DisplayUI.cpp
+    String getListCount(int num);
+    String getAPLabel(int num);
+    String getStationLabel(int num);
+    String getNameLabel(int num);
+    String getSSIDLabel(int num);
+    String getRandomMode(int num);
+    String getAPInfo(int num);
+    String getStationInfo(int num);
+    String getNameInfo(int num);
+    String getSSIDInfo(int num);
+    String getAttackInfo(int num);
+
+    int countAPs();
+    int countStations();
+    int countNames();
+    int countSSIDs();
+
+    void back(int num);
+    void startScan(int num);
+    void startPacketMonitor(int num);
+    void selectAll(int num);
+    void deselectAll(int num);
+    void removeAll(int num);
+    void toggleAP(int num);
+    void toggleStation(int num);
+    void toggleName(int num);
+    void toggleSelected(int num);
+    void removeSelected(int num);
+    void openAP(int num);
+    void openStation(int num);
+    void openName(int num);
+    void openSSID(int num);
+    void openStationAP(int num);
+    void cloneAP(int num);
+    void cloneAPs(int num);
+    void toggleRandom(int num);
+    void toggleWPA2(int num);
+    void removeSSID(int num);
+    void toggleAttack(int num);
+    void startAttack(int num);
 
-    void addMenuNode(Menu* menu, std::function<String()> getStr, std::function<void()> click, std::function<void()> hold);
-    void addMenuNode(Menu* menu, std::function<String()> getStr, std::function<void()> click);
-    void addMenuNode(Menu* menu, std::function<String()> getStr, Menu* next);
-    void addMenuNode(Menu* menu, const char* ptr, std::function<void()> click);
-    void addMenuNode(Menu* menu, const char* ptr, Menu* next);
-    
     // menus
     Menu* currentMenu;
     
@@ -149,466 +259,480 @@ class DisplayUI {
     Menu stationMenu;
     Menu nameMenu;
     Menu ssidMenu;
+
+    static const MenuNode mainNodes[];
+    static const MenuNode scanNodes[];
+    static const MenuNode showNodes[];
+    static const MenuNode attackNodes[];
+    static const MenuNode apListNodes[];
+    static const MenuNode stationListNodes[];
+    static const MenuNode nameListNodes[];
+    static const MenuNode ssidListNodes[];
+    static const MenuNode apNodes[];
+    static const MenuNode stationNodes[];
+    static const MenuNode nameNodes[];
+    static const MenuNode ssidNodes[];
 };
 
 // ===== FONT ===== //
 // Created by http://oleddisplay.squix.ch/ Consider a donation
 // In case of problems make sure that you are using the font file with the correct version!
+// Packed with extras/host/fontconvert of esp8266-oled-ssd1306, all chars are kept for SSIDs and names
 const uint8_t DejaVu_Sans_Mono_12[] PROGMEM = {
-  0x07, // Width: 7
+  0x87, // Width: 7, packed
   0x0F, // Height: 15
   0x20, // First Char: 32
   0xE0, // Numbers of Chars: 224
 
-  // Jump Table:
-  0xFF, 0xFF, 0x00, 0x07,  // 32:65535
-  0x00, 0x00, 0x08, 0x07,  // 33:0
-  0x00, 0x08, 0x09, 0x07,  // 34:8
-  0x00, 0x11, 0x0D, 0x07,  // 35:17
-  0x00, 0x1E, 0x0C, 0x07,  // 36:30
-  0x00, 0x2A, 0x0E, 0x07,  // 37:42
-  0x00, 0x38, 0x0E, 0x07,  // 38:56
-  0x00, 0x46, 0x07, 0x07,  // 39:70
-  0x00, 0x4D, 0x0C, 0x07,  // 40:77
-  0x00, 0x59, 0x0A, 0x07,  // 41:89
-  0x00, 0x63, 0x0B, 0x07,  // 42:99
-  0x00, 0x6E, 0x0E, 0x07,  // 43:110
-  0x00, 0x7C, 0x08, 0x07,  // 44:124
-  0x00, 0x84, 0x0A, 0x07,  // 45:132
-  0x00, 0x8E, 0x08, 0x07,  // 46:142
-  0x00, 0x96, 0x0D, 0x07,  // 47:150
-  0x00, 0xA3, 0x0E, 0x07,  // 48:163
-  0x00, 0xB1, 0x0C, 0x07,  // 49:177
-  0x00, 0xBD, 0x0E, 0x07,  // 50:189
-  0x00, 0xCB, 0x0E, 0x07,  // 51:203
-  0x00, 0xD9, 0x0E, 0x07,  // 52:217
-  0x00, 0xE7, 0x0E, 0x07,  // 53:231
-  0x00, 0xF5, 0x0E, 0x07,  // 54:245
-  0x01, 0x03, 0x0D, 0x07,  // 55:259
-  0x01, 0x10, 0x0E, 0x07,  // 56:272
-  0x01, 0x1E, 0x0E, 0x07,  // 57:286
-  0x01, 0x2C, 0x08, 0x07,  // 58:300
-  0x01, 0x34, 0x08, 0x07,  // 59:308
-  0x01, 0x3C, 0x0E, 0x07,  // 60:316
-  0x01, 0x4A, 0x0E, 0x07,  // 61:330
-  0x01, 0x58, 0x0E, 0x07,  // 62:344
-  0x01, 0x66, 0x0D, 0x07,  // 63:358
-  0x01, 0x73, 0x0E, 0x07,  // 64:371
-  0x01, 0x81, 0x0E, 0x07,  // 65:385
-  0x01, 0x8F, 0x0E, 0x07,  // 66:399
-  0x01, 0x9D, 0x0E, 0x07,  // 67:413
-  0x01, 0xAB, 0x0E, 0x07,  // 68:427
-  0x01, 0xB9, 0x0E, 0x07,  // 69:441
-  0x01, 0xC7, 0x0D, 0x07,  // 70:455
-  0x01, 0xD4, 0x0E, 0x07,  // 71:468
-  0x01, 0xE2, 0x0E, 0x07,  // 72:482
-  0x01, 0xF0, 0x0C, 0x07,  // 73:496
-  0x01, 0xFC, 0x0C, 0x07,  // 74:508
-  0x02, 0x08, 0x0E, 0x07,  // 75:520
-  0x02, 0x16, 0x0E, 0x07,  // 76:534
-  0x02, 0x24, 0x0E, 0x07,  // 77:548
-  0x02, 0x32, 0x0E, 0x07,  // 78:562
-  0x02, 0x40, 0x0E, 0x07,  // 79:576
-  0x02, 0x4E, 0x0D, 0x07,  // 80:590
-  0x02, 0x5B, 0x0E, 0x07,  // 81:603
-  0x02, 0x69, 0x0E, 0x07,  // 82:617
-  0x02, 0x77, 0x0E, 0x07,  // 83:631
-  0x02, 0x85, 0x0D, 0x07,  // 84:645
-  0x02, 0x92, 0x0E, 0x07,  // 85:658
-  0x02, 0xA0, 0x0D, 0x07,  // 86:672
-  0x02, 0xAD, 0x0E, 0x07,  // 87:685
-  0x02, 0xBB, 0x0E, 0x07,  // 88:699
-  0x02, 0xC9, 0x0D, 0x07,  // 89:713
-  0x02, 0xD6, 0x0E, 0x07,  // 90:726
-  0x02, 0xE4, 0x0A, 0x07,  // 91:740
-  0x02, 0xEE, 0x0E, 0x07,  // 92:750
-  0x02, 0xFC, 0x08, 0x07,  // 93:764
-  0x03, 0x04, 0x0B, 0x07,  // 94:772
-  0x03, 0x0F, 0x0E, 0x07,  // 95:783
-  0x03, 0x1D, 0x09, 0x07,  // 96:797
-  0x03, 0x26, 0x0C, 0x07,  // 97:806
-  0x03, 0x32, 0x0C, 0x07,  // 98:818
-  0x03, 0x3E, 0x0C, 0x07,  // 99:830
-  0x03, 0x4A, 0x0C, 0x07,  // 100:842
-  0x03, 0x56, 0x0C, 0x07,  // 101:854
-  0x03, 0x62, 0x0B, 0x07,  // 102:866
-  0x03, 0x6D, 0x0C, 0x07,  // 103:877
-  0x03, 0x79, 0x0C, 0x07,  // 104:889
-  0x03, 0x85, 0x0C, 0x07,  // 105:901
-  0x03, 0x91, 0x0A, 0x07,  // 106:913
-  0x03, 0x9B, 0x0C, 0x07,  // 107:923
-  0x03, 0xA7, 0x0C, 0x07,  // 108:935
-  0x03, 0xB3, 0x0C, 0x07,  // 109:947
-  0x03, 0xBF, 0x0C, 0x07,  // 110:959
-  0x03, 0xCB, 0x0C, 0x07,  // 111:971
-  0x03, 0xD7, 0x0C, 0x07,  // 112:983
-  0x03, 0xE3, 0x0C, 0x07,  // 113:995
-  0x03, 0xEF, 0x0D, 0x07,  // 114:1007
-  0x03, 0xFC, 0x0C, 0x07,  // 115:1020
-  0x04, 0x08, 0x0C, 0x07,  // 116:1032
-  0x04, 0x14, 0x0C, 0x07,  // 117:1044
-  0x04, 0x20, 0x0B, 0x07,  // 118:1056
-  0x04, 0x2B, 0x0D, 0x07,  // 119:1067
-  0x04, 0x38, 0x0C, 0x07,  // 120:1080
-  0x04, 0x44, 0x0B, 0x07,  // 121:1092
-  0x04, 0x4F, 0x0C, 0x07,  // 122:1103
-  0x04, 0x5B, 0x0C, 0x07,  // 123:1115
-  0x04, 0x67, 0x08, 0x07,  // 124:1127
-  0x04, 0x6F, 0x0B, 0x07,  // 125:1135
-  0x04, 0x7A, 0x0E, 0x07,  // 126:1146
-  0x04, 0x88, 0x0E, 0x07,  // 127:1160
-  0x04, 0x96, 0x0E, 0x07,  // 128:1174
-  0x04, 0xA4, 0x0E, 0x07,  // 129:1188
-  0x04, 0xB2, 0x0E, 0x07,  // 130:1202
-  0x04, 0xC0, 0x0E, 0x07,  // 131:1216
-  0x04, 0xCE, 0x0E, 0x07,  // 132:1230
-  0x04, 0xDC, 0x0E, 0x07,  // 133:1244
-  0x04, 0xEA, 0x0E, 0x07,  // 134:1258
-  0x04, 0xF8, 0x0E, 0x07,  // 135:1272
-  0x05, 0x06, 0x0E, 0x07,  // 136:1286
-  0x05, 0x14, 0x0E, 0x07,  // 137:1300
-  0x05, 0x22, 0x0E, 0x07,  // 138:1314
-  0x05, 0x30, 0x0E, 0x07,  // 139:1328
-  0x05, 0x3E, 0x0E, 0x07,  // 140:1342
-  0x05, 0x4C, 0x0E, 0x07,  // 141:1356
-  0x05, 0x5A, 0x0E, 0x07,  // 142:1370
-  0x05, 0x68, 0x0E, 0x07,  // 143:1384
-  0x05, 0x76, 0x0E, 0x07,  // 144:1398
-  0x05, 0x84, 0x0E, 0x07,  // 145:1412
-  0x05, 0x92, 0x0E, 0x07,  // 146:1426
-  0x05, 0xA0, 0x0E, 0x07,  // 147:1440
-  0x05, 0xAE, 0x0E, 0x07,  // 148:1454
-  0x05, 0xBC, 0x0E, 0x07,  // 149:1468
-  0x05, 0xCA, 0x0E, 0x07,  // 150:1482
-  0x05, 0xD8, 0x0E, 0x07,  // 151:1496
-  0x05, 0xE6, 0x0E, 0x07,  // 152:1510
-  0x05, 0xF4, 0x0E, 0x07,  // 153:1524
-  0x06, 0x02, 0x0E, 0x07,  // 154:1538
-  0x06, 0x10, 0x0E, 0x07,  // 155:1552
-  0x06, 0x1E, 0x0E, 0x07,  // 156:1566
-  0x06, 0x2C, 0x0E, 0x07,  // 157:1580
-  0x06, 0x3A, 0x0E, 0x07,  // 158:1594
-  0x06, 0x48, 0x0E, 0x07,  // 159:1608
-  0xFF, 0xFF, 0x00, 0x07,  // 160:65535
-  0x06, 0x56, 0x08, 0x07,  // 161:1622
-  0x06, 0x5E, 0x0C, 0x07,  // 162:1630
-  0x06, 0x6A, 0x0C, 0x07,  // 163:1642
-  0x06, 0x76, 0x0E, 0x07,  // 164:1654
-  0x06, 0x84, 0x0D, 0x07,  // 165:1668
-  0x06, 0x91, 0x08, 0x07,  // 166:1681
-  0x06, 0x99, 0x0C, 0x07,  // 167:1689
-  0x06, 0xA5, 0x09, 0x07,  // 168:1701
-  0x06, 0xAE, 0x0E, 0x07,  // 169:1710
-  0x06, 0xBC, 0x0A, 0x07,  // 170:1724
-  0x06, 0xC6, 0x0E, 0x07,  // 171:1734
-  0x06, 0xD4, 0x0E, 0x07,  // 172:1748
-  0x06, 0xE2, 0x0A, 0x07,  // 173:1762
-  0x06, 0xEC, 0x0E, 0x07,  // 174:1772
-  0x06, 0xFA, 0x0B, 0x07,  // 175:1786
-  0x07, 0x05, 0x0B, 0x07,  // 176:1797
-  0x07, 0x10, 0x0E, 0x07,  // 177:1808
-  0x07, 0x1E, 0x09, 0x07,  // 178:1822
-  0x07, 0x27, 0x0B, 0x07,  // 179:1831
-  0x07, 0x32, 0x09, 0x07,  // 180:1842
-  0x07, 0x3B, 0x0E, 0x07,  // 181:1851
-  0x07, 0x49, 0x0E, 0x07,  // 182:1865
-  0x07, 0x57, 0x08, 0x07,  // 183:1879
-  0x07, 0x5F, 0x0A, 0x07,  // 184:1887
-  0x07, 0x69, 0x09, 0x07,  // 185:1897
-  0x07, 0x72, 0x0A, 0x07,  // 186:1906
-  0x07, 0x7C, 0x0E, 0x07,  // 187:1916
-  0x07, 0x8A, 0x0E, 0x07,  // 188:1930
-  0x07, 0x98, 0x0C, 0x07,  // 189:1944
-  0x07, 0xA4, 0x0E, 0x07,  // 190:1956
-  0x07, 0xB2, 0x0A, 0x07,  // 191:1970
-  0x07, 0xBC, 0x0E, 0x07,  // 192:1980
-  0x07, 0xCA, 0x0E, 0x07,  // 193:1994
-  0x07, 0xD8, 0x0E, 0x07,  // 194:2008
-  0x07, 0xE6, 0x0E, 0x07,  // 195:2022
-  0x07, 0xF4, 0x0E, 0x07,  // 196:2036
-  0x08, 0x02, 0x0E, 0x07,  // 197:2050
-  0x08, 0x10, 0x0E, 0x07,  // 198:2064
-  0x08, 0x1E, 0x0E, 0x07,  // 199:2078
-  0x08, 0x2C, 0x0E, 0x07,  // 200:2092
-  0x08, 0x3A, 0x0E, 0x07,  // 201:2106
-  0x08, 0x48, 0x0E, 0x07,  // 202:2120
-  0x08, 0x56, 0x0E, 0x07,  // 203:2134
-  0x08, 0x64, 0x0C, 0x07,  // 204:2148
-  0x08, 0x70, 0x0C, 0x07,  // 205:2160
-  0x08, 0x7C, 0x0C, 0x07,  // 206:2172
-  0x08, 0x88, 0x0C, 0x07,  // 207:2184
-  0x08, 0x94, 0x0E, 0x07,  // 208:2196
-  0x08, 0xA2, 0x0E, 0x07,  // 209:2210
-  0x08, 0xB0, 0x0E, 0x07,  // 210:2224
-  0x08, 0xBE, 0x0E, 0x07,  // 211:2238
-  0x08, 0xCC, 0x0E, 0x07,  // 212:2252
-  0x08, 0xDA, 0x0E, 0x07,  // 213:2266
-  0x08, 0xE8, 0x0E, 0x07,  // 214:2280
-  0x08, 0xF6, 0x0C, 0x07,  // 215:2294
-  0x09, 0x02, 0x0E, 0x07,  // 216:2306
-  0x09, 0x10, 0x0E, 0x07,  // 217:2320
-  0x09, 0x1E, 0x0E, 0x07,  // 218:2334
-  0x09, 0x2C, 0x0E, 0x07,  // 219:2348
-  0x09, 0x3A, 0x0E, 0x07,  // 220:2362
-  0x09, 0x48, 0x0D, 0x07,  // 221:2376
-  0x09, 0x55, 0x0D, 0x07,  // 222:2389
-  0x09, 0x62, 0x0C, 0x07,  // 223:2402
-  0x09, 0x6E, 0x0C, 0x07,  // 224:2414
-  0x09, 0x7A, 0x0C, 0x07,  // 225:2426
-  0x09, 0x86, 0x0C, 0x07,  // 226:2438
-  0x09, 0x92, 0x0C, 0x07,  // 227:2450
-  0x09, 0x9E, 0x0C, 0x07,  // 228:2462
-  0x09, 0xAA, 0x0C, 0x07,  // 229:2474
-  0x09, 0xB6, 0x0C, 0x07,  // 230:2486
-  0x09, 0xC2, 0x0C, 0x07,  // 231:2498
-  0x09, 0xCE, 0x0C, 0x07,  // 232:2510
-  0x09, 0xDA, 0x0C, 0x07,  // 233:2522
-  0x09, 0xE6, 0x0C, 0x07,  // 234:2534
-  0x09, 0xF2, 0x0C, 0x07,  // 235:2546
-  0x09, 0xFE, 0x0C, 0x07,  // 236:2558
-  0x0A, 0x0A, 0x0C, 0x07,  // 237:2570
-  0x0A, 0x16, 0x0C, 0x07,  // 238:2582
-  0x0A, 0x22, 0x0C, 0x07,  // 239:2594
-  0x0A, 0x2E, 0x0C, 0x07,  // 240:2606
-  0x0A, 0x3A, 0x0C, 0x07,  // 241:2618
-  0x0A, 0x46, 0x0C, 0x07,  // 242:2630
-  0x0A, 0x52, 0x0C, 0x07,  // 243:2642
-  0x0A, 0x5E, 0x0C, 0x07,  // 244:2654
-  0x0A, 0x6A, 0x0C, 0x07,  // 245:2666
-  0x0A, 0x76, 0x0C, 0x07,  // 246:2678
-  0x0A, 0x82, 0x0C, 0x07,  // 247:2690
-  0x0A, 0x8E, 0x0C, 0x07,  // 248:2702
-  0x0A, 0x9A, 0x0C, 0x07,  // 249:2714
-  0x0A, 0xA6, 0x0C, 0x07,  // 250:2726
-  0x0A, 0xB2, 0x0C, 0x07,  // 251:2738
-  0x0A, 0xBE, 0x0C, 0x07,  // 252:2750
-  0x0A, 0xCA, 0x0B, 0x07,  // 253:2762
-  0x0A, 0xD5, 0x0C, 0x07,  // 254:2773
-  0x0A, 0xE1, 0x0B, 0x07,  // 255:2785
+  // Glyph Table:
+  0x07,0x00, // 32
+  0x07,0x05, // 33
+  0x07,0x05, // 34
+  0x07,0x0A, // 35
+  0x07,0x0A, // 36
+  0x07,0x0B, // 37
+  0x07,0x0A, // 38
+  0x07,0x04, // 39
+  0x07,0x08, // 40
+  0x07,0x08, // 41
+  0x07,0x07, // 42
+  0x07,0x0A, // 43
+  0x07,0x04, // 44
+  0x07,0x04, // 45
+  0x07,0x04, // 46
+  0x07,0x0B, // 47
+  0x07,0x0A, // 48
+  0x07,0x09, // 49
+  0x07,0x0A, // 50
+  0x07,0x0A, // 51
+  0x07,0x0A, // 52
+  0x07,0x0A, // 53
+  0x07,0x0A, // 54
+  0x07,0x0A, // 55
+  0x07,0x0A, // 56
+  0x07,0x0A, // 57
+  0x07,0x04, // 58
+  0x07,0x05, // 59
+  0x07,0x08, // 60
+  0x07,0x06, // 61
+  0x07,0x08, // 62
+  0x07,0x09, // 63
+  0x07,0x0B, // 64
+  0x07,0x0A, // 65
+  0x07,0x0A, // 66
+  0x07,0x0A, // 67
+  0x07,0x0A, // 68
+  0x07,0x0A, // 69
+  0x07,0x0A, // 70
+  0x07,0x0A, // 71
+  0x07,0x0A, // 72
+  0x07,0x09, // 73
+  0x07,0x09, // 74
+  0x07,0x0A, // 75
+  0x07,0x0A, // 76
+  0x07,0x0A, // 77
+  0x07,0x0A, // 78
+  0x07,0x0A, // 79
+  0x07,0x0A, // 80
+  0x07,0x0C, // 81
+  0x07,0x0A, // 82
+  0x07,0x0A, // 83
+  0x07,0x0B, // 84
+  0x07,0x0A, // 85
+  0x07,0x0A, // 86
+  0x07,0x0B, // 87
+  0x07,0x0A, // 88
+  0x07,0x0B, // 89
+  0x07,0x0A, // 90
+  0x07,0x06, // 91
+  0x07,0x0B, // 92
+  0x07,0x06, // 93
+  0x07,0x06, // 94
+  0x07,0x04, // 95
+  0x07,0x04, // 96
+  0x07,0x08, // 97
+  0x07,0x0A, // 98
+  0x07,0x08, // 99
+  0x07,0x0A, // 100
+  0x07,0x08, // 101
+  0x07,0x0A, // 102
+  0x07,0x0A, // 103
+  0x07,0x0A, // 104
+  0x07,0x0A, // 105
+  0x07,0x08, // 106
+  0x07,0x0A, // 107
+  0x07,0x0A, // 108
+  0x07,0x08, // 109
+  0x07,0x08, // 110
+  0x07,0x08, // 111
+  0x07,0x0A, // 112
+  0x07,0x0A, // 113
+  0x07,0x08, // 114
+  0x07,0x08, // 115
+  0x07,0x09, // 116
+  0x07,0x08, // 117
+  0x07,0x08, // 118
+  0x07,0x0A, // 119
+  0x07,0x08, // 120
+  0x07,0x0A, // 121
+  0x07,0x08, // 122
+  0x07,0x0A, // 123
+  0x07,0x05, // 124
+  0x07,0x0A, // 125
+  0x07,0x05, // 126
+  0x07,0x0C, // 127
+  0x07,0x0C, // 128
+  0x07,0x0C, // 129
+  0x07,0x0C, // 130
+  0x07,0x0C, // 131
+  0x07,0x0C, // 132
+  0x07,0x0C, // 133
+  0x07,0x0C, // 134
+  0x07,0x0C, // 135
+  0x07,0x0C, // 136
+  0x07,0x0C, // 137
+  0x07,0x0C, // 138
+  0x07,0x0C, // 139
+  0x07,0x0C, // 140
+  0x07,0x0C, // 141
+  0x07,0x0C, // 142
+  0x07,0x0C, // 143
+  0x07,0x0C, // 144
+  0x07,0x0C, // 145
+  0x07,0x0C, // 146
+  0x07,0x0C, // 147
+  0x07,0x0C, // 148
+  0x07,0x0C, // 149
+  0x07,0x0C, // 150
+  0x07,0x0C, // 151
+  0x07,0x0C, // 152
+  0x07,0x0C, // 153
+  0x07,0x0C, // 154
+  0x07,0x0C, // 155
+  0x07,0x0C, // 156
+  0x07,0x0C, // 157
+  0x07,0x0C, // 158
+  0x07,0x0C, // 159
+  0x07,0x00, // 160
+  0x07,0x05, // 161
+  0x07,0x0A, // 162
+  0x07,0x09, // 163
+  0x07,0x08, // 164
+  0x07,0x0B, // 165
+  0x07,0x05, // 166
+  0x07,0x0A, // 167
+  0x07,0x04, // 168
+  0x07,0x0A, // 169
+  0x07,0x07, // 170
+  0x07,0x07, // 171
+  0x07,0x06, // 172
+  0x07,0x04, // 173
+  0x07,0x0A, // 174
+  0x07,0x04, // 175
+  0x07,0x05, // 176
+  0x07,0x0A, // 177
+  0x07,0x05, // 178
+  0x07,0x06, // 179
+  0x07,0x04, // 180
+  0x07,0x0B, // 181
+  0x07,0x0B, // 182
+  0x07,0x04, // 183
+  0x07,0x04, // 184
+  0x07,0x05, // 185
+  0x07,0x07, // 186
+  0x07,0x07, // 187
+  0x07,0x0D, // 188
+  0x07,0x0C, // 189
+  0x07,0x0D, // 190
+  0x07,0x0A, // 191
+  0x07,0x0C, // 192
+  0x07,0x0C, // 193
+  0x07,0x0C, // 194
+  0x07,0x0C, // 195
+  0x07,0x0C, // 196
+  0x07,0x0C, // 197
+  0x07,0x0B, // 198
+  0x07,0x0C, // 199
+  0x07,0x0C, // 200
+  0x07,0x0C, // 201
+  0x07,0x0C, // 202
+  0x07,0x0C, // 203
+  0x07,0x0B, // 204
+  0x07,0x0B, // 205
+  0x07,0x0B, // 206
+  0x07,0x0A, // 207
+  0x07,0x0B, // 208
+  0x07,0x0C, // 209
+  0x07,0x0C, // 210
+  0x07,0x0C, // 211
+  0x07,0x0C, // 212
+  0x07,0x0C, // 213
+  0x07,0x0C, // 214
+  0x07,0x07, // 215
+  0x07,0x0B, // 216
+  0x07,0x0C, // 217
+  0x07,0x0C, // 218
+  0x07,0x0C, // 219
+  0x07,0x0C, // 220
+  0x07,0x0E, // 221
+  0x07,0x0A, // 222
+  0x07,0x0A, // 223
+  0x07,0x0A, // 224
+  0x07,0x0A, // 225
+  0x07,0x0A, // 226
+  0x07,0x0A, // 227
+  0x07,0x09, // 228
+  0x07,0x0B, // 229
+  0x07,0x08, // 230
+  0x07,0x09, // 231
+  0x07,0x0A, // 232
+  0x07,0x0A, // 233
+  0x07,0x0A, // 234
+  0x07,0x09, // 235
+  0x07,0x0A, // 236
+  0x07,0x0A, // 237
+  0x07,0x0A, // 238
+  0x07,0x09, // 239
+  0x07,0x0A, // 240
+  0x07,0x0A, // 241
+  0x07,0x0A, // 242
+  0x07,0x0A, // 243
+  0x07,0x0A, // 244
+  0x07,0x0A, // 245
+  0x07,0x09, // 246
+  0x07,0x07, // 247
+  0x07,0x08, // 248
+  0x07,0x0A, // 249
+  0x07,0x0A, // 250
+  0x07,0x0A, // 251
+  0x07,0x09, // 252
+  0x07,0x0C, // 253
+  0x07,0x0C, // 254
+  0x07,0x0B, // 255
 
   // Font Data:
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0D, // 33
-  0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, // 34
-  0x00, 0x02, 0x40, 0x0E, 0xE0, 0x03, 0x50, 0x0A, 0xC0, 0x07, 0x70, 0x02, 0x40, // 35
-  0x00, 0x00, 0xE0, 0x04, 0x90, 0x08, 0xF8, 0x3F, 0x10, 0x09, 0x20, 0x07, // 36
-  0x30, 0x00, 0x48, 0x01, 0x48, 0x01, 0xB0, 0x06, 0x80, 0x09, 0x40, 0x09, 0x00, 0x06, // 37
-  0x00, 0x00, 0x00, 0x07, 0xF0, 0x0C, 0xC8, 0x08, 0x08, 0x0B, 0x08, 0x06, 0x00, 0x0B, // 38
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, // 39
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x1C, 0x1C, 0x04, 0x10, // 40
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x1C, 0x1C, 0xE0, 0x03, // 41
-  0x00, 0x00, 0x90, 0x00, 0x60, 0x00, 0xF8, 0x01, 0x60, 0x00, 0x90, // 42
-  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xE0, 0x0F, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, // 43
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0C, // 44
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, // 45
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, // 46
-  0x00, 0x00, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x08, // 47
-  0x00, 0x00, 0xE0, 0x03, 0x18, 0x0C, 0x08, 0x08, 0x88, 0x08, 0x18, 0x0C, 0xE0, 0x03, // 48
-  0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, 0x00, 0x08, 0x00, 0x08, // 49
-  0x00, 0x00, 0x10, 0x08, 0x08, 0x0C, 0x08, 0x0A, 0x08, 0x09, 0x88, 0x08, 0x70, 0x08, // 50
-  0x00, 0x00, 0x10, 0x04, 0x08, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x70, 0x07, // 51
-  0x00, 0x00, 0x00, 0x03, 0xC0, 0x02, 0x60, 0x02, 0x18, 0x02, 0xF8, 0x0F, 0x00, 0x02, // 52
-  0x00, 0x00, 0x78, 0x04, 0x48, 0x08, 0x48, 0x08, 0x48, 0x08, 0xC8, 0x0C, 0x80, 0x07, // 53
-  0x00, 0x00, 0xE0, 0x03, 0x90, 0x0C, 0x48, 0x08, 0x48, 0x08, 0xC8, 0x0C, 0x90, 0x07, // 54
-  0x00, 0x00, 0x08, 0x00, 0x08, 0x08, 0x08, 0x06, 0x88, 0x01, 0x78, 0x00, 0x18, // 55
-  0x00, 0x00, 0x70, 0x07, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x70, 0x07, // 56
-  0x00, 0x00, 0xF0, 0x04, 0x18, 0x09, 0x08, 0x09, 0x08, 0x09, 0x98, 0x04, 0xE0, 0x03, // 57
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, // 58
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC0, 0x0C, // 59
-  0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x20, 0x04, // 60
-  0x00, 0x00, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, // 61
-  0x00, 0x00, 0x20, 0x04, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x80, 0x01, 0x80, 0x01, // 62
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x88, 0x0D, 0xC8, 0x00, 0x48, 0x00, 0x30, // 63
-  0x00, 0x00, 0xC0, 0x0F, 0x20, 0x18, 0x10, 0x23, 0x90, 0x24, 0xB0, 0x24, 0xE0, 0x07, // 64
-  0x00, 0x00, 0x00, 0x0C, 0xC0, 0x03, 0x38, 0x02, 0x38, 0x02, 0xC0, 0x03, 0x00, 0x0C, // 65
-  0x00, 0x00, 0xF8, 0x0F, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x70, 0x07, // 66
-  0x00, 0x00, 0xE0, 0x03, 0x10, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x04, // 67
-  0x00, 0x00, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x04, 0xE0, 0x03, // 68
-  0x00, 0x00, 0xF8, 0x0F, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, // 69
-  0x00, 0x00, 0xF8, 0x0F, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, // 70
-  0x00, 0x00, 0xE0, 0x03, 0x10, 0x04, 0x08, 0x08, 0x08, 0x08, 0x88, 0x08, 0x90, 0x07, // 71
-  0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xF8, 0x0F, // 72
-  0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x0F, 0x08, 0x08, 0x08, 0x08, // 73
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x07, // 74
-  0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0xC0, 0x00, 0x20, 0x03, 0x10, 0x06, 0x08, 0x08, // 75
-  0x00, 0x00, 0xF8, 0x0F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, // 76
-  0x00, 0x00, 0xF8, 0x0F, 0x30, 0x00, 0xC0, 0x01, 0xC0, 0x01, 0x30, 0x00, 0xF8, 0x0F, // 77
-  0x00, 0x00, 0xF8, 0x0F, 0x18, 0x00, 0xE0, 0x00, 0x80, 0x03, 0x00, 0x0C, 0xF8, 0x0F, // 78
-  0x00, 0x00, 0xE0, 0x03, 0x18, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x18, 0x0C, 0xE0, 0x03, // 79
-  0x00, 0x00, 0xF8, 0x0F, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x70, // 80
-  0x00, 0x00, 0xE0, 0x03, 0x18, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x18, 0x3C, 0xE0, 0x07, // 81
-  0x00, 0x00, 0xF8, 0x0F, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x01, 0x70, 0x06, // 82
-  0x00, 0x00, 0x70, 0x04, 0xC8, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x10, 0x07, // 83
-  0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0xF8, 0x0F, 0x08, 0x00, 0x08, 0x00, 0x08, // 84
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0xF8, 0x07, // 85
-  0x00, 0x00, 0x18, 0x00, 0xE0, 0x01, 0x00, 0x0E, 0x00, 0x0E, 0xE0, 0x01, 0x18, // 86
-  0xF8, 0x01, 0x00, 0x0E, 0xC0, 0x03, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0E, 0xF8, 0x01, // 87
-  0x00, 0x00, 0x08, 0x08, 0x30, 0x06, 0xC0, 0x01, 0xC0, 0x01, 0x30, 0x06, 0x08, 0x08, // 88
-  0x08, 0x00, 0x10, 0x00, 0x60, 0x00, 0x80, 0x0F, 0x60, 0x00, 0x10, 0x00, 0x08, // 89
-  0x00, 0x00, 0x08, 0x0C, 0x08, 0x0E, 0x88, 0x09, 0xC8, 0x08, 0x38, 0x08, 0x18, 0x08, // 90
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x04, 0x10, // 91
-  0x00, 0x00, 0x08, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x10, // 92
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0xFC, 0x1F, // 93
-  0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, // 94
-  0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, // 95
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, // 96
-  0x00, 0x00, 0x40, 0x06, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0xC0, 0x0F, // 97
-  0x00, 0x00, 0xFC, 0x0F, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07, // 98
-  0x00, 0x00, 0xC0, 0x07, 0x60, 0x0C, 0x20, 0x08, 0x20, 0x08, 0x40, 0x08, // 99
-  0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xFC, 0x0F, // 100
-  0x00, 0x00, 0xC0, 0x07, 0x60, 0x09, 0x20, 0x09, 0x20, 0x09, 0xC0, 0x05, // 101
-  0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0xF8, 0x0F, 0x24, 0x00, 0x24, // 102
-  0x00, 0x00, 0xC0, 0x07, 0x20, 0x28, 0x20, 0x48, 0x20, 0x48, 0xE0, 0x3F, // 103
-  0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0xC0, 0x0F, // 104
-  0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xE4, 0x0F, 0x00, 0x08, 0x00, 0x08, // 105
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x20, 0x40, 0xE4, 0x3F, // 106
-  0x00, 0x00, 0xFC, 0x0F, 0x00, 0x01, 0x80, 0x02, 0x40, 0x04, 0x20, 0x08, // 107
-  0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0xFC, 0x07, 0x00, 0x08, 0x00, 0x08, // 108
-  0x00, 0x00, 0xE0, 0x0F, 0x20, 0x00, 0xE0, 0x0F, 0x20, 0x00, 0xE0, 0x0F, // 109
-  0x00, 0x00, 0xE0, 0x0F, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0xC0, 0x0F, // 110
-  0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07, // 111
-  0x00, 0x00, 0xE0, 0x7F, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07, // 112
-  0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xE0, 0x7F, // 113
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x60, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, // 114
-  0x00, 0x00, 0xC0, 0x04, 0x20, 0x09, 0x20, 0x09, 0x20, 0x09, 0x40, 0x06, // 115
-  0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0xF8, 0x0F, 0x20, 0x08, 0x20, 0x08, // 116
-  0x00, 0x00, 0xE0, 0x07, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0xE0, 0x0F, // 117
-  0x00, 0x00, 0x60, 0x00, 0x80, 0x03, 0x00, 0x0C, 0x80, 0x03, 0x60, // 118
-  0x60, 0x00, 0x80, 0x03, 0x00, 0x0E, 0x80, 0x01, 0x00, 0x0E, 0x80, 0x03, 0x60, // 119
-  0x00, 0x00, 0x20, 0x08, 0xC0, 0x06, 0x00, 0x01, 0xC0, 0x06, 0x20, 0x08, // 120
-  0x00, 0x00, 0x60, 0x40, 0x80, 0x67, 0x00, 0x1C, 0x80, 0x03, 0x60, // 121
-  0x00, 0x00, 0x20, 0x0C, 0x20, 0x0A, 0x20, 0x09, 0xA0, 0x08, 0x60, 0x08, // 122
-  0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x7C, 0x1F, 0x04, 0x10, 0x04, 0x10, // 123
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, // 124
-  0x00, 0x00, 0x04, 0x10, 0x04, 0x10, 0x7C, 0x1F, 0x80, 0x00, 0x80, // 125
-  0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, // 126
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 127
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 128
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 129
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 130
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 131
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 132
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 133
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 134
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 135
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 136
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 137
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 138
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 139
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 140
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 141
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 142
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 143
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 144
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 145
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 146
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 147
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 148
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 149
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 150
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 151
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 152
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 153
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 154
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 155
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 156
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 157
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 158
-  0x00, 0x00, 0xF0, 0x7F, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0xF0, 0x7F, // 159
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x3F, // 161
-  0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0xF8, 0x3F, 0x20, 0x08, 0x40, 0x04, // 162
-  0x00, 0x00, 0x80, 0x08, 0xF0, 0x0F, 0x88, 0x08, 0x88, 0x08, 0x08, 0x08, // 163
-  0x00, 0x00, 0x20, 0x04, 0xC0, 0x03, 0x40, 0x02, 0x40, 0x02, 0xC0, 0x03, 0x20, 0x04, // 164
-  0x08, 0x00, 0x50, 0x01, 0x60, 0x01, 0x80, 0x0F, 0x60, 0x01, 0x50, 0x01, 0x08, // 165
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, // 166
-  0x00, 0x00, 0xF0, 0x11, 0x28, 0x13, 0x48, 0x12, 0xC8, 0x14, 0x88, 0x0F, // 167
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, // 168
-  0xC0, 0x01, 0x20, 0x02, 0xD0, 0x05, 0x50, 0x05, 0x50, 0x05, 0x20, 0x02, 0xC0, 0x01, // 169
-  0x00, 0x00, 0xE8, 0x02, 0xA8, 0x02, 0xA8, 0x02, 0xF0, 0x02, // 170
-  0x00, 0x00, 0x00, 0x01, 0x80, 0x02, 0x40, 0x04, 0x00, 0x01, 0x80, 0x02, 0x40, 0x04, // 171
-  0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x03, // 172
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, // 173
-  0xC0, 0x01, 0x20, 0x02, 0xD0, 0x05, 0xD0, 0x05, 0xD0, 0x05, 0x20, 0x02, 0xC0, 0x01, // 174
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, // 175
-  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x48, 0x00, 0x48, 0x00, 0x30, // 176
-  0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0xE0, 0x0B, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, // 177
-  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0xE8, 0x00, 0xB8, // 178
-  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0xA8, 0x00, 0xA8, 0x00, 0xD8, // 179
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, // 180
-  0x00, 0x00, 0xE0, 0x7F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0xE0, 0x0F, 0x00, 0x08, // 181
-  0x00, 0x00, 0x70, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x1F, 0x08, 0x00, 0xF8, 0x1F, // 182
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, // 183
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x30, // 184
-  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0xF8, 0x00, 0x80, // 185
-  0x00, 0x00, 0x70, 0x02, 0x88, 0x02, 0x88, 0x02, 0x70, 0x02, // 186
-  0x00, 0x00, 0x40, 0x04, 0x80, 0x02, 0x00, 0x01, 0x40, 0x04, 0x80, 0x02, 0x00, 0x01, // 187
-  0x44, 0x02, 0x7C, 0x03, 0x40, 0x01, 0x00, 0x0D, 0x80, 0x0B, 0x80, 0x1F, 0x00, 0x08, // 188
-  0x44, 0x02, 0x7C, 0x03, 0x40, 0x01, 0x00, 0x11, 0x80, 0x1D, 0x80, 0x17, // 189
-  0x00, 0x02, 0x44, 0x03, 0x54, 0x01, 0x54, 0x0D, 0xEC, 0x0B, 0x80, 0x1F, 0x00, 0x08, // 190
-  0x00, 0x38, 0x00, 0x4C, 0x00, 0x44, 0x60, 0x43, 0x00, 0x20, // 191
-  0x00, 0x00, 0x00, 0x0C, 0xC1, 0x03, 0x3A, 0x02, 0x38, 0x02, 0xC0, 0x03, 0x00, 0x0C, // 192
-  0x00, 0x00, 0x00, 0x0C, 0xC0, 0x03, 0x3A, 0x02, 0x39, 0x02, 0xC0, 0x03, 0x00, 0x0C, // 193
-  0x00, 0x00, 0x00, 0x0C, 0xC2, 0x03, 0x39, 0x02, 0x39, 0x02, 0xC2, 0x03, 0x00, 0x0C, // 194
-  0x00, 0x00, 0x00, 0x0C, 0xC3, 0x03, 0x39, 0x02, 0x3A, 0x02, 0xC3, 0x03, 0x00, 0x0C, // 195
-  0x00, 0x00, 0x00, 0x0C, 0xC2, 0x03, 0x38, 0x02, 0x38, 0x02, 0xC2, 0x03, 0x00, 0x0C, // 196
-  0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0xFE, 0x02, 0xE6, 0x02, 0x00, 0x07, 0x00, 0x08, // 197
-  0x00, 0x0C, 0x80, 0x03, 0x78, 0x02, 0x08, 0x02, 0xF8, 0x0F, 0x88, 0x08, 0x88, 0x08, // 198
-  0x00, 0x00, 0xE0, 0x03, 0x10, 0x04, 0x08, 0x28, 0x08, 0x28, 0x08, 0x38, 0x10, 0x04, // 199
-  0x00, 0x00, 0xF8, 0x0F, 0x89, 0x08, 0x8A, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, // 200
-  0x00, 0x00, 0xF8, 0x0F, 0x88, 0x08, 0x8A, 0x08, 0x89, 0x08, 0x88, 0x08, 0x88, 0x08, // 201
-  0x00, 0x00, 0xF8, 0x0F, 0x8A, 0x08, 0x89, 0x08, 0x89, 0x08, 0x8A, 0x08, 0x88, 0x08, // 202
-  0x00, 0x00, 0xF8, 0x0F, 0x8A, 0x08, 0x88, 0x08, 0x8A, 0x08, 0x88, 0x08, 0x88, 0x08, // 203
-  0x00, 0x00, 0x08, 0x08, 0x09, 0x08, 0xFA, 0x0F, 0x08, 0x08, 0x08, 0x08, // 204
-  0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0xFA, 0x0F, 0x09, 0x08, 0x08, 0x08, // 205
-  0x00, 0x00, 0x08, 0x08, 0x0A, 0x08, 0xF9, 0x0F, 0x0A, 0x08, 0x08, 0x08, // 206
-  0x00, 0x00, 0x08, 0x08, 0x0A, 0x08, 0xF8, 0x0F, 0x0A, 0x08, 0x08, 0x08, // 207
-  0x80, 0x00, 0xF8, 0x0F, 0x88, 0x08, 0x88, 0x08, 0x08, 0x08, 0x10, 0x04, 0xE0, 0x03, // 208
-  0x00, 0x00, 0xF8, 0x0F, 0x1B, 0x00, 0xE1, 0x00, 0x82, 0x03, 0x03, 0x0C, 0xF8, 0x0F, // 209
-  0x00, 0x00, 0xE0, 0x03, 0x19, 0x0C, 0x0A, 0x08, 0x08, 0x08, 0x18, 0x0C, 0xE0, 0x03, // 210
-  0x00, 0x00, 0xE0, 0x03, 0x18, 0x0C, 0x0A, 0x08, 0x09, 0x08, 0x18, 0x0C, 0xE0, 0x03, // 211
-  0x00, 0x00, 0xE0, 0x03, 0x1A, 0x0C, 0x09, 0x08, 0x09, 0x08, 0x1A, 0x0C, 0xE0, 0x03, // 212
-  0x00, 0x00, 0xE0, 0x03, 0x1B, 0x0C, 0x09, 0x08, 0x0A, 0x08, 0x1B, 0x0C, 0xE0, 0x03, // 213
-  0x00, 0x00, 0xE0, 0x03, 0x1A, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x1A, 0x0C, 0xE0, 0x03, // 214
-  0x00, 0x00, 0x20, 0x02, 0x40, 0x01, 0x80, 0x00, 0x40, 0x01, 0x20, 0x02, // 215
-  0x00, 0x08, 0xE0, 0x07, 0x18, 0x0E, 0x88, 0x09, 0x48, 0x08, 0x38, 0x0C, 0xF8, 0x03, // 216
-  0x00, 0x00, 0xF8, 0x07, 0x01, 0x08, 0x02, 0x08, 0x00, 0x08, 0x00, 0x08, 0xF8, 0x07, // 217
-  0x00, 0x00, 0xF8, 0x07, 0x00, 0x08, 0x02, 0x08, 0x01, 0x08, 0x00, 0x08, 0xF8, 0x07, // 218
-  0x00, 0x00, 0xF8, 0x07, 0x02, 0x08, 0x01, 0x08, 0x01, 0x08, 0x02, 0x08, 0xF8, 0x07, // 219
-  0x00, 0x00, 0xF8, 0x07, 0x02, 0x08, 0x00, 0x08, 0x00, 0x08, 0x02, 0x08, 0xF8, 0x07, // 220
-  0x08, 0x00, 0x10, 0x00, 0x60, 0x00, 0x82, 0x0F, 0x61, 0x00, 0x10, 0x00, 0x08, // 221
-  0x00, 0x00, 0xF8, 0x0F, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0xE0, // 222
-  0x00, 0x00, 0xF8, 0x0F, 0xE4, 0x00, 0xA4, 0x09, 0x18, 0x09, 0x00, 0x06, // 223
-  0x00, 0x00, 0x40, 0x06, 0x20, 0x09, 0x24, 0x09, 0x28, 0x09, 0xC0, 0x0F, // 224
-  0x00, 0x00, 0x40, 0x06, 0x20, 0x09, 0x28, 0x09, 0x24, 0x09, 0xC0, 0x0F, // 225
-  0x00, 0x00, 0x40, 0x06, 0x28, 0x09, 0x24, 0x09, 0x24, 0x09, 0xC8, 0x0F, // 226
-  0x00, 0x00, 0x40, 0x06, 0x2C, 0x09, 0x24, 0x09, 0x28, 0x09, 0xCC, 0x0F, // 227
-  0x00, 0x00, 0x40, 0x06, 0x28, 0x09, 0x20, 0x09, 0x28, 0x09, 0xC0, 0x0F, // 228
-  0x00, 0x00, 0x40, 0x06, 0x26, 0x09, 0x29, 0x09, 0x29, 0x09, 0xC6, 0x0F, // 229
-  0x00, 0x00, 0x40, 0x0F, 0x20, 0x09, 0xC0, 0x07, 0x20, 0x09, 0xE0, 0x09, // 230
-  0x00, 0x00, 0xC0, 0x07, 0x60, 0x0C, 0x20, 0x28, 0x20, 0x28, 0x40, 0x38, // 231
-  0x00, 0x00, 0xC0, 0x07, 0x60, 0x09, 0x24, 0x09, 0x28, 0x09, 0xC0, 0x05, // 232
-  0x00, 0x00, 0xC0, 0x07, 0x60, 0x09, 0x28, 0x09, 0x24, 0x09, 0xC0, 0x05, // 233
-  0x00, 0x00, 0xC0, 0x07, 0x68, 0x09, 0x24, 0x09, 0x24, 0x09, 0xC8, 0x05, // 234
-  0x00, 0x00, 0xC0, 0x07, 0x68, 0x09, 0x20, 0x09, 0x28, 0x09, 0xC0, 0x05, // 235
-  0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xE4, 0x0F, 0x08, 0x08, 0x00, 0x08, // 236
-  0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0xE8, 0x0F, 0x04, 0x08, 0x00, 0x08, // 237
-  0x00, 0x00, 0x28, 0x08, 0x24, 0x08, 0xE4, 0x0F, 0x08, 0x08, 0x00, 0x08, // 238
-  0x00, 0x00, 0x20, 0x08, 0x28, 0x08, 0xE0, 0x0F, 0x08, 0x08, 0x00, 0x08, // 239
-  0x00, 0x00, 0x80, 0x07, 0x54, 0x08, 0x58, 0x08, 0x68, 0x08, 0xC0, 0x07, // 240
-  0x00, 0x00, 0xE0, 0x0F, 0x4C, 0x00, 0x24, 0x00, 0x28, 0x00, 0xCC, 0x0F, // 241
-  0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x24, 0x08, 0x28, 0x08, 0xC0, 0x07, // 242
-  0x00, 0x00, 0xC0, 0x07, 0x20, 0x08, 0x28, 0x08, 0x24, 0x08, 0xC0, 0x07, // 243
-  0x00, 0x00, 0xC0, 0x07, 0x28, 0x08, 0x24, 0x08, 0x28, 0x08, 0xC0, 0x07, // 244
-  0x00, 0x00, 0xCC, 0x07, 0x24, 0x08, 0x2C, 0x08, 0x28, 0x08, 0xCC, 0x07, // 245
-  0x00, 0x00, 0xC0, 0x07, 0x28, 0x08, 0x20, 0x08, 0x28, 0x08, 0xC0, 0x07, // 246
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x40, 0x05, 0x00, 0x01, 0x00, 0x01, // 247
-  0x00, 0x00, 0xC0, 0x0F, 0x20, 0x0A, 0x20, 0x09, 0xA0, 0x08, 0xE0, 0x07, // 248
-  0x00, 0x00, 0xE0, 0x07, 0x00, 0x08, 0x04, 0x08, 0x08, 0x08, 0xE0, 0x0F, // 249
-  0x00, 0x00, 0xE0, 0x07, 0x00, 0x08, 0x08, 0x08, 0x04, 0x08, 0xE0, 0x0F, // 250
-  0x00, 0x00, 0xE0, 0x07, 0x08, 0x08, 0x04, 0x08, 0x08, 0x08, 0xE0, 0x0F, // 251
-  0x00, 0x00, 0xE0, 0x07, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0xE0, 0x0F, // 252
-  0x00, 0x00, 0x60, 0x40, 0x80, 0x67, 0x08, 0x1C, 0x84, 0x03, 0x60, // 253
-  0x00, 0x00, 0xFC, 0x7F, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0xC0, 0x07, // 254
-  0x00, 0x00, 0x60, 0x40, 0x88, 0x67, 0x00, 0x1C, 0x88, 0x03, 0x60 // 255
+  0xC3,0x09,0x01,0xBF,0x01, // 33
+  0x83,0x03,0x03,0xC7,0x01, // 34
+  0x04,0x08,0x07,0x20,0xE4,0x3E,0xA5,0x7C,0x27,0x04, // 35
+  0x43,0x0B,0x05,0x9C,0x90,0xC8,0xFF,0x45,0x42,0x0E, // 36
+  0x03,0x09,0x07,0x06,0x52,0xA4,0xB0,0x06,0x13,0x25,0x30, // 37
+  0x43,0x09,0x06,0xE0,0x3C,0x67,0x0C,0x1B,0x0C,0x2C, // 38
+  0xC3,0x03,0x01,0x07, // 39
+  0xC2,0x0B,0x03,0xF8,0x38,0x78,0x00,0x01, // 40
+  0x82,0x0B,0x03,0x01,0x3C,0x38,0x3E,0x00, // 41
+  0x43,0x06,0x05,0x12,0xF3,0x33,0x12, // 42
+  0x05,0x07,0x07,0x08,0x04,0xE2,0x8F,0x40,0x20,0x00, // 43
+  0x8A,0x03,0x02,0x1C, // 44
+  0x88,0x01,0x03,0x07, // 45
+  0xCA,0x02,0x01,0x03, // 46
+  0x43,0x0A,0x06,0x00,0x02,0x06,0x06,0x06,0x06,0x04,0x00, // 47
+  0x43,0x09,0x06,0x7C,0x06,0x07,0x8C,0x38,0x98,0x0F, // 48
+  0x43,0x09,0x05,0x01,0x03,0xFE,0x07,0x08,0x10, // 49
+  0x43,0x09,0x06,0x02,0x03,0x07,0x0D,0x19,0xD1,0x21, // 50
+  0x43,0x09,0x06,0x82,0x02,0x46,0x8C,0x18,0xD1,0x1D, // 51
+  0x43,0x09,0x06,0x60,0xB0,0x30,0x19,0xF2,0x1F,0x08, // 52
+  0x43,0x09,0x06,0x8F,0x12,0x26,0x4C,0x98,0x19,0x1E, // 53
+  0x43,0x09,0x06,0x7C,0x24,0x27,0x4C,0x98,0x59,0x1E, // 54
+  0x43,0x09,0x06,0x01,0x02,0x06,0x8B,0xF1,0x60,0x00, // 55
+  0x43,0x09,0x06,0xEE,0x22,0x46,0x8C,0x18,0xD1,0x1D, // 56
+  0x43,0x09,0x06,0x9E,0x46,0x86,0x0C,0x39,0x89,0x0F, // 57
+  0xC6,0x06,0x01,0x33, // 58
+  0x86,0x07,0x02,0xC0,0x19, // 59
+  0x45,0x06,0x06,0x0C,0x23,0x49,0x52,0x08, // 60
+  0x47,0x03,0x06,0x6D,0xDB,0x02, // 61
+  0x45,0x06,0x06,0xA1,0x24,0x49,0x0C,0x03, // 62
+  0x83,0x09,0x05,0x02,0x62,0x67,0x48,0x60,0x00, // 63
+  0x44,0x0A,0x06,0xFC,0x08,0x16,0x63,0x92,0x4B,0xFA,0x01, // 64
+  0x43,0x09,0x06,0x80,0xF1,0x1C,0x39,0x82,0x07,0x30, // 65
+  0x43,0x09,0x06,0xFF,0x23,0x46,0x8C,0x18,0xD1,0x1D, // 66
+  0x43,0x09,0x06,0x7C,0x04,0x05,0x0C,0x18,0x50,0x10, // 67
+  0x43,0x09,0x06,0xFF,0x03,0x06,0x0C,0x28,0x88,0x0F, // 68
+  0x43,0x09,0x06,0xFF,0x23,0x46,0x8C,0x18,0x31,0x22, // 69
+  0x43,0x09,0x06,0xFF,0x23,0x44,0x88,0x10,0x21,0x02, // 70
+  0x43,0x09,0x06,0x7C,0x04,0x05,0x0C,0x18,0x51,0x1E, // 71
+  0x43,0x09,0x06,0xFF,0x21,0x40,0x80,0x00,0xE1,0x3F, // 72
+  0x43,0x09,0x05,0x01,0x03,0xFE,0x0F,0x18,0x10, // 73
+  0x43,0x09,0x05,0x80,0x00,0x06,0x0C,0xF8,0x0F, // 74
+  0x43,0x09,0x06,0xFF,0x21,0x60,0x20,0x23,0x2C,0x20, // 75
+  0x43,0x09,0x06,0xFF,0x01,0x02,0x04,0x08,0x10,0x20, // 76
+  0x43,0x09,0x06,0xFF,0x0D,0xE0,0xC0,0x61,0xE0,0x3F, // 77
+  0x43,0x09,0x06,0xFF,0x07,0x70,0x80,0x03,0xF8,0x3F, // 78
+  0x43,0x09,0x06,0x7C,0x06,0x07,0x0C,0x38,0x98,0x0F, // 79
+  0x43,0x09,0x06,0xFF,0x23,0x44,0x88,0x10,0xC1,0x01, // 80
+  0x43,0x0B,0x06,0x7C,0x18,0x4C,0x40,0x02,0x32,0x78,0x7E,0x00, // 81
+  0x43,0x09,0x06,0xFF,0x23,0x44,0x88,0x10,0xC3,0x19, // 82
+  0x43,0x09,0x06,0x8E,0x32,0x46,0x8C,0x18,0x51,0x1C, // 83
+  0x03,0x09,0x07,0x01,0x02,0x04,0xF8,0x1F,0x20,0x40,0x00, // 84
+  0x43,0x09,0x06,0xFF,0x00,0x02,0x04,0x08,0xF0,0x1F, // 85
+  0x43,0x09,0x06,0x03,0x78,0x00,0x07,0xCE,0x63,0x00, // 86
+  0x03,0x09,0x07,0x3F,0x80,0xE3,0x31,0x80,0x07,0xF8,0x0F, // 87
+  0x43,0x09,0x06,0x01,0x8D,0xE1,0xC0,0x61,0x2C,0x20, // 88
+  0x03,0x09,0x07,0x01,0x04,0x30,0x80,0xCF,0x40,0x40,0x00, // 89
+  0x43,0x09,0x06,0x81,0x83,0xC7,0xCC,0x78,0x70,0x20, // 90
+  0xC2,0x0B,0x02,0xFF,0x0F,0x20, // 91
+  0x43,0x0A,0x06,0x01,0x18,0x80,0x01,0x18,0x80,0x01,0x08, // 92
+  0x82,0x0B,0x02,0x01,0xFC,0x3F, // 93
+  0x03,0x03,0x06,0x54,0x22,0x02, // 94
+  0x0E,0x01,0x07,0x7F, // 95
+  0xC2,0x02,0x02,0x09, // 96
+  0x45,0x07,0x05,0xB2,0x64,0x32,0xE9,0x07, // 97
+  0x42,0x0A,0x05,0xFF,0x23,0x88,0x20,0x82,0xF0,0x01, // 98
+  0x45,0x07,0x05,0xBE,0x71,0x30,0x28,0x04, // 99
+  0x42,0x0A,0x05,0xF0,0x21,0x88,0x20,0x82,0xFF,0x03, // 100
+  0x45,0x07,0x05,0xBE,0x65,0x32,0xE9,0x02, // 101
+  0x42,0x0A,0x05,0x08,0x20,0xE0,0x7F,0x02,0x09,0x00, // 102
+  0x45,0x0A,0x05,0x3E,0x04,0x15,0x64,0x90,0xFF,0x01, // 103
+  0x42,0x0A,0x05,0xFF,0x43,0x80,0x00,0x02,0xF0,0x03, // 104
+  0x42,0x0A,0x05,0x08,0x22,0x98,0x3F,0x80,0x00,0x02, // 105
+  0x82,0x0D,0x03,0x08,0x10,0x01,0xE6,0x3F, // 106
+  0x42,0x0A,0x05,0xFF,0x03,0x01,0x0A,0x44,0x08,0x02, // 107
+  0x42,0x0A,0x05,0x01,0x04,0xF0,0x1F,0x80,0x00,0x02, // 108
+  0x45,0x07,0x05,0xFF,0xC0,0x3F,0xF0,0x07, // 109
+  0x45,0x07,0x05,0x7F,0x41,0x20,0xE0,0x07, // 110
+  0x45,0x07,0x05,0xBE,0x60,0x30,0xE8,0x03, // 111
+  0x45,0x0A,0x05,0xFF,0x07,0x11,0x44,0x10,0x3E,0x00, // 112
+  0x45,0x0A,0x05,0x3E,0x04,0x11,0x44,0x10,0xFF,0x03, // 113
+  0x85,0x07,0x05,0xFF,0x41,0x20,0x20,0x00, // 114
+  0x45,0x07,0x05,0xA6,0x64,0x32,0x29,0x03, // 115
+  0x43,0x09,0x05,0x04,0x08,0xFC,0x27,0x48,0x10, // 116
+  0x45,0x07,0x05,0x3F,0x20,0x10,0xF8,0x07, // 117
+  0x45,0x07,0x05,0x03,0x0E,0x98,0x33,0x00, // 118
+  0x05,0x07,0x07,0x03,0x0E,0x9C,0x01,0xE7,0x0C,0x00, // 119
+  0x45,0x07,0x05,0x41,0x1B,0xC2,0x16,0x04, // 120
+  0x45,0x0A,0x05,0x03,0xF2,0x0C,0x0E,0x07,0x03,0x00, // 121
+  0x45,0x07,0x05,0xE1,0x68,0xB2,0x38,0x04, // 122
+  0x42,0x0B,0x05,0x20,0x00,0xC1,0xF7,0x03,0x18,0x40, // 123
+  0xC2,0x0C,0x01,0xFF,0x0F, // 124
+  0x42,0x0B,0x05,0x01,0x0C,0xE0,0xF7,0x41,0x00,0x02, // 125
+  0x47,0x02,0x06,0x95,0x0A, // 126
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 127
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 128
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 129
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 130
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 131
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 132
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 133
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 134
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 135
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 136
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 137
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 138
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 139
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 140
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 141
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 142
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 143
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 144
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 145
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 146
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 147
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 148
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 149
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 150
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 151
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 152
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 153
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 154
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 155
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 156
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 157
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 158
+  0x44,0x0B,0x06,0xFF,0x0F,0x60,0x00,0x03,0x18,0xC0,0xFF,0x03, // 159
+  0xC5,0x09,0x01,0xFB,0x01, // 161
+  0x43,0x0B,0x05,0xF8,0x20,0xC8,0xFF,0x09,0x82,0x08, // 162
+  0x43,0x09,0x05,0x10,0xFD,0x47,0x8C,0x18,0x10, // 163
+  0x45,0x06,0x06,0xA1,0x27,0x49,0x5E,0x08, // 164
+  0x03,0x09,0x07,0x01,0x54,0xB0,0x80,0xCF,0x42,0x45,0x00, // 165
+  0xC4,0x0A,0x01,0xCF,0x03, // 166
+  0x43,0x0A,0x05,0x3E,0x96,0x99,0x64,0xA6,0xF1,0x01, // 167
+  0x83,0x01,0x03,0x05, // 168
+  0x04,0x07,0x07,0x1C,0x51,0xB7,0x5A,0x15,0x71,0x00, // 169
+  0x43,0x07,0x04,0xDD,0x6A,0xD5,0x0B, // 170
+  0x46,0x05,0x06,0x44,0x45,0xA2,0x22, // 171
+  0x47,0x03,0x06,0x49,0x92,0x03, // 172
+  0x88,0x01,0x03,0x07, // 173
+  0x04,0x07,0x07,0x1C,0x51,0xB7,0xDB,0x15,0x71,0x00, // 174
+  0x83,0x01,0x04,0x0F, // 175
+  0x83,0x04,0x04,0x96,0x69, // 176
+  0x05,0x07,0x07,0x44,0x22,0xF1,0x4B,0x24,0x12,0x01, // 177
+  0x83,0x05,0x03,0xB1,0x5F, // 178
+  0x83,0x05,0x04,0xB1,0xD6,0x0D, // 179
+  0xC2,0x02,0x02,0x06, // 180
+  0x45,0x0A,0x06,0xFF,0x03,0x01,0x04,0x10,0x7F,0x00,0x01, // 181
+  0x43,0x0A,0x06,0x0E,0x7C,0xF0,0xC1,0xFF,0x01,0xFC,0x0F, // 182
+  0xC7,0x02,0x01,0x03, // 183
+  0x8C,0x02,0x03,0x3A, // 184
+  0x83,0x05,0x03,0xF1,0x43, // 185
+  0x43,0x07,0x04,0xCE,0x68,0xD4,0x09, // 186
+  0x46,0x05,0x06,0x51,0x91,0xA8,0x08, // 187
+  0x02,0x0B,0x07,0x91,0xF8,0x06,0x14,0x80,0x06,0x2E,0xF0,0x03,0x08, // 188
+  0x02,0x0B,0x06,0x91,0xF8,0x06,0x14,0x80,0x08,0x76,0xF0,0x02, // 189
+  0x02,0x0B,0x07,0x80,0x88,0x46,0x15,0xAA,0xB6,0x2F,0xF0,0x03,0x08, // 190
+  0x05,0x0A,0x05,0xC0,0x81,0x09,0xE2,0x86,0x00,0x01, // 191
+  0x40,0x0C,0x06,0x00,0x1C,0x3C,0x3A,0x82,0x23,0xC0,0x03,0xC0, // 192
+  0x40,0x0C,0x06,0x00,0x0C,0x3C,0x3A,0x92,0x23,0xC0,0x03,0xC0, // 193
+  0x40,0x0C,0x06,0x00,0x2C,0x3C,0x39,0x92,0x23,0xC2,0x03,0xC0, // 194
+  0x40,0x0C,0x06,0x00,0x3C,0x3C,0x39,0xA2,0x23,0xC3,0x03,0xC0, // 195
+  0x41,0x0B,0x06,0x00,0x0E,0x0F,0x47,0x38,0x12,0x1E,0x00,0x03, // 196
+  0x41,0x0B,0x06,0x00,0x04,0xDC,0x5F,0xE6,0x02,0x38,0x00,0x02, // 197
+  0x03,0x09,0x07,0x80,0xE1,0x3C,0x09,0xF2,0x3F,0x62,0x44, // 198
+  0x43,0x0B,0x06,0x7C,0x10,0x44,0x40,0x03,0x1A,0x70,0x41,0x00, // 199
+  0x40,0x0C,0x06,0xF8,0x9F,0x88,0x8A,0x88,0x88,0x88,0x88,0x88, // 200
+  0x40,0x0C,0x06,0xF8,0x8F,0x88,0x8A,0x98,0x88,0x88,0x88,0x88, // 201
+  0x40,0x0C,0x06,0xF8,0xAF,0x88,0x89,0x98,0x88,0x8A,0x88,0x88, // 202
+  0x41,0x0B,0x06,0xFC,0x2F,0x22,0x11,0x8B,0x48,0x44,0x22,0x02, // 203
+  0x40,0x0C,0x05,0x08,0x98,0x80,0xFA,0x8F,0x80,0x08,0x08, // 204
+  0x40,0x0C,0x05,0x08,0x88,0x80,0xFA,0x9F,0x80,0x08,0x08, // 205
+  0x40,0x0C,0x05,0x08,0xA8,0x80,0xF9,0xAF,0x80,0x08,0x08, // 206
+  0x41,0x0B,0x05,0x04,0x2C,0x20,0xFF,0x0B,0x48,0x40, // 207
+  0x03,0x09,0x07,0x10,0xFE,0x47,0x8C,0x18,0x50,0x10,0x1F, // 208
+  0x40,0x0C,0x06,0xF8,0xBF,0x01,0xE1,0x20,0x38,0x03,0x8C,0xFF, // 209
+  0x40,0x0C,0x06,0xE0,0x93,0xC1,0x0A,0x88,0x80,0x18,0x0C,0x3E, // 210
+  0x40,0x0C,0x06,0xE0,0x83,0xC1,0x0A,0x98,0x80,0x18,0x0C,0x3E, // 211
+  0x40,0x0C,0x06,0xE0,0xA3,0xC1,0x09,0x98,0x80,0x1A,0x0C,0x3E, // 212
+  0x40,0x0C,0x06,0xE0,0xB3,0xC1,0x09,0xA8,0x80,0x1B,0x0C,0x3E, // 213
+  0x41,0x0B,0x06,0xF0,0x69,0x30,0x01,0x09,0xD8,0x60,0xF8,0x00, // 214
+  0x45,0x05,0x05,0x51,0x11,0x15,0x01, // 215
+  0x03,0x09,0x07,0x00,0xF9,0x0D,0x8F,0x99,0xF0,0xF0,0x1F, // 216
+  0x40,0x0C,0x06,0xF8,0x17,0x80,0x02,0x08,0x80,0x00,0x88,0x7F, // 217
+  0x40,0x0C,0x06,0xF8,0x07,0x80,0x02,0x18,0x80,0x00,0x88,0x7F, // 218
+  0x40,0x0C,0x06,0xF8,0x27,0x80,0x01,0x18,0x80,0x02,0x88,0x7F, // 219
+  0x41,0x0B,0x06,0xFC,0x0B,0x20,0x00,0x01,0x18,0x40,0xFE,0x01, // 220
+  0x00,0x0C,0x07,0x08,0x00,0x01,0x60,0x20,0xF8,0x61,0x00,0x01,0x08,0x00, // 221
+  0x43,0x09,0x06,0xFF,0x45,0x88,0x10,0x21,0x82,0x03, // 222
+  0x42,0x0A,0x05,0xFE,0xE7,0x90,0xA6,0x91,0x80,0x01, // 223
+  0x42,0x0A,0x05,0x90,0x21,0x99,0xA4,0x92,0xF0,0x03, // 224
+  0x42,0x0A,0x05,0x90,0x21,0xA9,0x64,0x92,0xF0,0x03, // 225
+  0x42,0x0A,0x05,0x90,0x29,0x99,0x64,0x92,0xF2,0x03, // 226
+  0x42,0x0A,0x05,0x90,0x2D,0x99,0xA4,0x92,0xF3,0x03, // 227
+  0x43,0x09,0x05,0xC8,0x4A,0x92,0x2C,0x89,0x1F, // 228
+  0x40,0x0C,0x05,0x40,0x66,0x92,0x29,0x99,0x92,0xC6,0x0F, // 229
+  0x45,0x07,0x05,0xFA,0xA4,0x2F,0xF9,0x04, // 230
+  0x45,0x09,0x05,0x3E,0xC6,0x04,0x0D,0x2A,0x1C, // 231
+  0x42,0x0A,0x05,0xF0,0x61,0x99,0xA4,0x92,0x70,0x01, // 232
+  0x42,0x0A,0x05,0xF0,0x61,0xA9,0x64,0x92,0x70,0x01, // 233
+  0x42,0x0A,0x05,0xF0,0x69,0x99,0x64,0x92,0x72,0x01, // 234
+  0x43,0x09,0x05,0xF8,0x5A,0x92,0x2C,0x89,0x0B, // 235
+  0x42,0x0A,0x05,0x08,0x22,0x98,0xBF,0x80,0x00,0x02, // 236
+  0x42,0x0A,0x05,0x08,0x22,0xA8,0x7F,0x80,0x00,0x02, // 237
+  0x42,0x0A,0x05,0x0A,0x26,0x98,0xBF,0x80,0x00,0x02, // 238
+  0x43,0x09,0x05,0x04,0x0B,0xF2,0x0F,0x08,0x10, // 239
+  0x42,0x0A,0x05,0xE0,0x55,0x68,0xA1,0x86,0xF0,0x01, // 240
+  0x42,0x0A,0x05,0xF8,0x4F,0x90,0x80,0x02,0xF3,0x03, // 241
+  0x42,0x0A,0x05,0xF0,0x21,0x98,0xA0,0x82,0xF0,0x01, // 242
+  0x42,0x0A,0x05,0xF0,0x21,0xA8,0x60,0x82,0xF0,0x01, // 243
+  0x42,0x0A,0x05,0xF0,0x29,0x98,0xA0,0x82,0xF0,0x01, // 244
+  0x42,0x0A,0x05,0xF3,0x25,0xB8,0xA0,0x82,0xF3,0x01, // 245
+  0x43,0x09,0x05,0xF8,0x0A,0x12,0x2C,0x88,0x0F, // 246
+  0x46,0x05,0x05,0x84,0x54,0x42,0x00, // 247
+  0x45,0x07,0x05,0xFE,0x68,0xB2,0xF8,0x03, // 248
+  0x42,0x0A,0x05,0xF8,0x01,0x18,0xA0,0x80,0xF8,0x03, // 249
+  0x42,0x0A,0x05,0xF8,0x01,0x28,0x60,0x80,0xF8,0x03, // 250
+  0x42,0x0A,0x05,0xF8,0x09,0x18,0xA0,0x80,0xF8,0x03, // 251
+  0x43,0x09,0x05,0xFC,0x02,0x02,0x0C,0xC8,0x1F, // 252
+  0x42,0x0D,0x05,0x18,0x10,0x3C,0x0B,0x9C,0x70,0x80,0x01,0x00, // 253
+  0x42,0x0D,0x05,0xFF,0x1F,0x41,0x20,0x08,0x04,0x01,0x1F,0x00, // 254
+  0x43,0x0C,0x05,0x0C,0x18,0xCF,0x80,0x13,0x07,0x0C,0x00 // 255
 };
 
 #endif
@@ -17,6 +17,7 @@ void Names::load() {
     internal_add(tmpArray.get<String>(0), tmpArray.get<String>(2), tmpArray.get<String>(3), tmpArray.get<uint8_t>(4), false);
     sort();
   }
+  generation++;
 
   prnt(N_LOADED);
   prntln(FILE_PATH);
@@ -94,12 +95,14 @@ void Names::sort() {
   list->sort([](Device & a, Device & b) -> bool{
     return memcmp(a.mac, b.mac, 6) > 0;
   });
+  generation++;
 }
 
 void Names::removeAll() {
   internal_removeAll();
   prntln(N_REMOVED_ALL);
   changed = true;
+  generation++;
 }
 
 bool Names::check(int num) {
@@ -192,6 +195,7 @@ void Names::add(uint8_t* mac, String name, uint8_t* bssid, uint8_t ch, bool sele
   prnt(N_ADDED);
   prntln(name);
   changed = true;
+  generation++;
 }
 
 void Names::add(String macStr, String name, String bssidStr, uint8_t ch, bool selected, bool force) {
@@ -212,6 +216,7 @@ void Names::add(String macStr, String name, String bssidStr, uint8_t ch, bool se
   prnt(N_ADDED);
   prntln(name);
   changed = true;
+  generation++;
 }
 
 void Names::replace(int num, String macStr, String name, String bssidStr, uint8_t ch, bool selected){
@@ -223,6 +228,7 @@ void Names::replace(int num, String macStr, String name, String bssidStr, uint8_
   prnt(N_REPLACED);
   prntln(name);
   changed = true;
+  generation++;
 }
 
 void Names::remove(int num) {
@@ -231,6 +237,7 @@ void Names::remove(int num) {
   prntln(getName(num));
   internal_remove(num);
   changed = true;
+  generation++;
 }
 
 void Names::setName(int num, String name) {
@@ -242,6 +249,7 @@ void Names::setName(int num, String name) {
   internal_remove(num);
   sort();
   changed = true;
+  generation++;
 }
 
 void Names::setMac(int num, String macStr) {
@@ -253,6 +261,7 @@ void Names::setMac(int num, String macStr) {
   internal_remove(num);
   sort();
   changed = true;
+  generation++;
 }
 
 void Names::setCh(int num, uint8_t ch) {
@@ -262,6 +271,7 @@ void Names::setCh(int num, uint8_t ch) {
   internal_remove(num);
   sort();
   changed = true;
+  generation++;
 }
 
 void Names::setBSSID(int num, String bssidStr) {
@@ -273,6 +283,7 @@ void Names::setBSSID(int num, String bssidStr) {
   internal_remove(num);
   sort();
   changed = true;
+  generation++;
 }
 
 void Names::select(int num) {
@@ -281,6 +292,7 @@ void Names::select(int num) {
   prnt(N_SELECTED);
   prntln(getName(num));
   changed = true;
+  generation++;
 }
 
 void Names::select(String name) {
@@ -301,6 +313,7 @@ void Names::deselect(int num) {
   prnt(N_DESELECTED);
   prntln(getName(num));
   changed = true;
+  generation++;
 }
 
 void Names::deselect(String name) {
@@ -320,6 +333,7 @@ void Names::selectAll() {
   for (int i = 0; i < c; i++)
     internal_select(i);
   prntln(N_SELECTED_ALL);
+  generation++;
 }
 
 void Names::deselectAll() {
@@ -327,6 +341,7 @@ void Names::deselectAll() {
   for (int i = 0; i < c; i++)
     internal_deselect(i);
   prntln(N_DESELECTED_ALL);
+  generation++;
 }
 
 uint8_t* Names::getMac(int num) {
@@ -382,6 +397,10 @@ bool Names::getSelected(int num) {
   return list->get(num).selected;
 }
 
+uint32_t Names::getGeneration() {
+  return generation;
+}
+
 bool Names::isStation(int num) {
   return getBssid(num) != NULL;
 }
@@ -64,6 +64,7 @@ class Names {
     String getSelectedStr(int num);
     uint8_t getCh(int num);
     bool getSelected(int num);
+    uint32_t getGeneration(); // counts changes to the list
     bool isStation(int num);
 
     void setName(int num, String name);
@@ -79,6 +80,7 @@ class Names {
   private:
     String FILE_PATH = "/names.json";
     bool changed = false;
+    uint32_t generation = 0;
   
     struct Device{
       uint8_t* mac;     // mac address
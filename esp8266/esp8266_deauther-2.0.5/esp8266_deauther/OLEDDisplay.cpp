@@ -68,11 +68,22 @@ bool OLEDDisplay::init() {
 }
 
 void OLEDDisplay::end() {
-  if (this->buffer) { free(this->buffer); this->buffer = NULL; }
+  if (this->buffer && this->ownsBuffers) free(this->buffer);
+  this->buffer = NULL;
   #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-  if (this->buffer_back) { free(this->buffer_back); this->buffer_back = NULL; }
+  if (this->buffer_back && this->ownsBuffers) free(this->buffer_back);
+  this->buffer_back = NULL;
   #endif
   if (this->logBuffer != NULL) { free(this->logBuffer); this->logBuffer = NULL; }
+  this->logBufferSize = 0;
+  #ifdef OLEDDISPLAY_PARTIAL_UPDATE
+  this->flushWindowCount = 0;
+  #endif
+  #ifdef OLEDDISPLAY_FONT_CACHE
+  if (this->glyphs) { free(this->glyphs); this->glyphs = NULL; }
+  this->glyphFont = NULL;
+  this->glyphCapacity = 0;
+  #endif
 }
 
 void OLEDDisplay::resetDisplay(void) {
@@ -80,6 +91,10 @@ void OLEDDisplay::resetDisplay(void) {
   #ifdef OLEDDISPLAY_DOUBLE_BUFFER
   memset(buffer_back, 1, displayBufferSize);
   #endif
+  #ifdef OLEDDISPLAY_CHECKSUM_BUFFER
+  checksumsValid = false;
+  #endif
+  markDirty();
   display();
 }
 
@@ -92,18 +107,34 @@ OLEDDISPLAY_COLOR OLEDDisplay::getColor() {
 }
 
 void OLEDDisplay::setPixel(int16_t x, int16_t y) {
-  if (x >= 0 && x < this->width() && y >= 0 && y < this->height()) {
-    switch (color) {
-      case WHITE:   buffer[x + (y / 8) * this->width()] |=  (1 << (y & 7)); break;
-      case BLACK:   buffer[x + (y / 8) * this->width()] &= ~(1 << (y & 7)); break;
-      case INVERSE: buffer[x + (y / 8) * this->width()] ^=  (1 << (y & 7)); break;
-    }
-  }
+  setPixelIn(this->width(), this->height(), x, y);
 }
 
 // Bresenham's algorithm - thx wikipedia and Adafruit_GFX
+//
+// The line is clipped before it is walked: the steps along the major axis
+// that land on the screen are computed up front and the error term is
+// advanced to the first of them, so the pixels are the same as walking all
+// of it. The walk then writes to the buffer with a rolling bit mask.
+// Horizontal and vertical lines are filled as spans.
 void OLEDDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
-  int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+  if (y0 == y1 || x0 == x1) {
+    int32_t from = y0 == y1 ? _min(x0, x1) : _min(y0, y1);
+    int32_t to   = y0 == y1 ? _max(x0, x1) : _max(y0, y1);
+    int32_t end  = y0 == y1 ? this->width() : this->height();
+    if (from < 0)  from = 0;
+    if (to >= end) to = end - 1;
+    if (from > to) return;
+
+    if (y0 == y1) {
+      drawHorizontalLine(from, y0, to - from + 1);
+    } else {
+      fillRect(x0, from, 1, to - from + 1);
+    }
+    return;
+  }
+
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
   if (steep) {
     _swap_int16_t(x0, y0);
     _swap_int16_t(x1, y1);
@@ -114,31 +145,95 @@ void OLEDDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
     _swap_int16_t(y0, y1);
   }
 
-  int16_t dx, dy;
-  dx = x1 - x0;
-  dy = abs(y1 - y0);
-
-  int16_t err = dx / 2;
-  int16_t ystep;
-
-  if (y0 < y1) {
-    ystep = 1;
-  } else {
-    ystep = -1;
-  }
-
-  for (; x0<=x1; x0++) {
-    if (steep) {
-      setPixel(y0, x0);
-    } else {
-      setPixel(x0, y0);
+  int32_t dx = x1 - x0;
+  int32_t dy = abs(y1 - y0);
+  int32_t err = dx / 2;
+  int8_t  ystep = y0 < y1 ? 1 : -1;
+
+  // x is the major axis, y the minor one, swapped for steep lines
+  int32_t xEnd = steep ? this->height() : this->width();
+  int32_t yEnd = steep ? this->width() : this->height();
+
+  // Step i = 0..dx draws x0 + i, y0 + ystep * k with k = ceil((i * dy - err) / dx).
+  // Keep the steps where x is on the screen, then where k puts y on it.
+  int32_t first = _max(0, -x0);
+  int32_t last  = _min(dx, xEnd - 1 - x0);
+  int32_t kMin  = ystep > 0 ? -y0 : y0 - (yEnd - 1);
+  int32_t kMax  = ystep > 0 ? yEnd - 1 - y0 : y0;
+  if (first > last || kMax < 0 || kMin > dy) return;
+
+  if (kMin > 0)  first = _max(first, (int32_t) (((uint32_t) (kMin - 1) * dx + err) / dy + 1));
+  if (kMax < dy) last  = _min(last,  (int32_t) (((uint32_t) kMax * dx + err) / dy));
+  if (first > last) return;
+
+  // Enter the screen at step `first`, k * dx + err - first * dy is in [0, dx)
+  uint32_t k = ((uint32_t) first * dy + dx - 1 - err) / dx;
+  err = (int32_t) (k * dx + err - (uint32_t) first * dy);
+
+  int16_t  col   = steep ? y0 + ystep * (int32_t) k : x0 + first;
+  int16_t  row   = steep ? x0 + first : y0 + ystep * (int32_t) k;
+  uint16_t count = last - first + 1;
+
+  uint16_t width   = this->width();
+  uint8_t  page    = row >> 3;
+  uint8_t  mask    = 1 << (row & 7);
+  uint8_t *bufferPtr = buffer + page * width + col;
+
+  // WHITE sets the mask bits, BLACK clears them and INVERSE flips them
+  uint8_t  clearMask = color == INVERSE ? 0x00 : 0xFF;
+  uint8_t  flipMask  = color == BLACK ? 0x00 : 0xFF;
+
+  // Columns drawn to on the current page
+  int16_t  from = col, to = col;
+
+  if (!steep) {
+    // One column per step, the mask moves to the next row on an error step
+    for (;;) {
+      *bufferPtr = (*bufferPtr & ~(mask & clearMask)) ^ (mask & flipMask);
+      if (--count == 0) break;
+
+      err -= dy;
+      if (err < 0) {
+        err += dx;
+        mask = ystep > 0 ? mask << 1 : mask >> 1;
+        if (!mask) {
+          markPages(from, to, page, page);
+          mask = ystep > 0 ? 0x01 : 0x80;
+          page += ystep;
+          bufferPtr += ystep * width;
+          from = to + 1;
+        }
+      }
+      bufferPtr++;
+      to++;
     }
-    err -= dy;
-    if (err < 0) {
-      y0 += ystep;
-      err += dx;
+  } else {
+    // One row per step, the column moves on an error step
+    for (;;) {
+      *bufferPtr = (*bufferPtr & ~(mask & clearMask)) ^ (mask & flipMask);
+      if (--count == 0) break;
+
+      err -= dy;
+      if (err < 0) {
+        err += dx;
+        col += ystep;
+        bufferPtr += ystep;
+      }
+      mask <<= 1;
+      if (!mask) {
+        markPages(from, to, page, page);
+        mask = 0x01;
+        page++;
+        bufferPtr += width;
+        from = to = col;
+      } else if (col < from) {
+        from = col;
+      } else if (col > to) {
+        to = col;
+      }
     }
   }
+  markPages(from, to, page, page);
 }
 
 void OLEDDisplay::drawRect(int16_t x, int16_t y, int16_t width, int16_t height) {
@@ -149,9 +244,7 @@ void OLEDDisplay::drawRect(int16_t x, int16_t y, int16_t width, int16_t height)
 }
 
 void OLEDDisplay::fillRect(int16_t xMove, int16_t yMove, int16_t width, int16_t height) {
-  for (int16_t x = xMove; x < xMove + width; x++) {
-    drawVerticalLine(x, yMove, height);
-  }
+  fillRectIn(this->width(), this->height(), xMove, yMove, width, height);
 }
 
 void OLEDDisplay::drawCircle(int16_t x0, int16_t y0, int16_t radius) {
@@ -221,131 +314,239 @@ void OLEDDisplay::drawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_
 
 
 void OLEDDisplay::fillCircle(int16_t x0, int16_t y0, int16_t radius) {
-  int16_t x = 0, y = radius;
-	int16_t dp = 1 - radius;
-	do {
-		if (dp < 0)
-			dp = dp + 2 * (++x) + 3;
-		else
-			dp = dp + 2 * (++x) - 2 * (--y) + 5;
-
-    drawHorizontalLine(x0 - x, y0 - y, 2*x);
-    drawHorizontalLine(x0 - x, y0 + y, 2*x);
-    drawHorizontalLine(x0 - y, y0 - x, 2*y);
-    drawHorizontalLine(x0 - y, y0 + x, 2*y);
-
+  OLEDDisplayRows rows;
+  beginRows(rows);
+  addCircleRows(rows, x0, y0, radius);
+  fillRows(rows);
+}
 
-	} while (x < y);
-  drawHorizontalLine(x0 - radius, y0, 2 * radius);
+void OLEDDisplay::addCircleRows(OLEDDisplayRows &rows, int16_t x0, int16_t y0, int16_t radius) {
+  // The spans of all octants start at x0 - half and end at x0 + half - 1,
+  // so every row is filled once with the widest span that lands on it. The
+  // rows y0 +- y are the widest right before y steps.
+  int16_t x = 0, y = radius;
+  int16_t dp = 1 - radius;
+  do {
+    if (dp < 0) {
+      dp = dp + 2 * (++x) + 3;
+    } else {
+      if (x > 0) {
+        addRowSpan(rows, y0 - y, x0 - x, x0 + x - 1);
+        addRowSpan(rows, y0 + y, x0 - x, x0 + x - 1);
+      }
+      dp = dp + 2 * (++x) - 2 * (--y) + 5;
+    }
 
+    addRowSpan(rows, y0 - x, x0 - y, x0 + y - 1);
+    addRowSpan(rows, y0 + x, x0 - y, x0 + y - 1);
+  } while (x < y);
+  addRowSpan(rows, y0 - y, x0 - x, x0 + x - 1);
+  addRowSpan(rows, y0 + y, x0 - x, x0 + x - 1);
+  addRowSpan(rows, y0, x0 - radius, x0 + radius - 1);
 }
 
-void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length) {
-  if (y < 0 || y >= this->height()) { return; }
+void OLEDDisplay::fillRoundRect(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius) {
+  if (width <= 0 || height <= 0) return;
+  if (radius > _min(width, height) / 2) radius = _min(width, height) / 2;
+  if (radius < 0) radius = 0;
 
-  if (x < 0) {
-    length += x;
-    x = 0;
-  }
+  OLEDDisplayRows rows;
+  beginRows(rows);
 
-  if ( (x + length) > this->width()) {
-    length = (this->width() - x);
+  // Straight rows between the corners
+  int32_t from = _max(y + radius, 0);
+  int32_t to   = _min(y + height - 1 - radius, this->height() - 1);
+  for (int32_t row = from; row <= to; row++) {
+    addRowSpan(rows, row, x, x + width - 1);
   }
 
-  if (length <= 0) { return; }
+  // Top and bottom corner rows mirror each other, `half` columns of the
+  // corner circles are filled `d` rows above or below their centre
+  int32_t limit = (int32_t) radius * (radius + 1);
+  uint16_t half = 0;
+  for (int32_t d = radius; d > 0; d--) {
+    while ((int32_t) (half + 1) * (half + 1) + d * d <= limit) half++;
+    int16_t inset = radius - half;
+    addRowSpan(rows, y + radius - d, x + inset, x + width - 1 - inset);
+    addRowSpan(rows, y + height - 1 - radius + d, x + inset, x + width - 1 - inset);
+  }
 
-  uint8_t * bufferPtr = buffer;
-  bufferPtr += (y >> 3) * this->width();
-  bufferPtr += x;
+  fillRows(rows);
+}
 
-  uint8_t drawBit = 1 << (y & 7);
+static int32_t floorDiv(int32_t a, int32_t b) {
+  int32_t q = a / b;
+  if ((a % b != 0) && ((a < 0) != (b < 0))) q--;
+  return q;
+}
 
-  switch (color) {
-    case WHITE:   while (length--) {
-        *bufferPtr++ |= drawBit;
-      }; break;
-    case BLACK:   drawBit = ~drawBit;   while (length--) {
-        *bufferPtr++ &= drawBit;
-      }; break;
-    case INVERSE: while (length--) {
-        *bufferPtr++ ^= drawBit;
-      }; break;
-  }
+// sin() of 0 to 90 degrees, times 4096
+static const int16_t sineTable[91] PROGMEM = {
+     0,   71,  143,  214,  286,  357,  428,  499,  570,  641,
+   711,  782,  852,  921,  991, 1060, 1129, 1198, 1266, 1334,
+  1401, 1468, 1534, 1600, 1666, 1731, 1796, 1860, 1923, 1986,
+  2048, 2110, 2171, 2231, 2290, 2349, 2408, 2465, 2522, 2578,
+  2633, 2687, 2741, 2793, 2845, 2896, 2946, 2996, 3044, 3091,
+  3138, 3183, 3228, 3271, 3314, 3355, 3396, 3435, 3474, 3511,
+  3547, 3582, 3617, 3650, 3681, 3712, 3742, 3770, 3798, 3824,
+  3849, 3873, 3896, 3917, 3937, 3956, 3974, 3991, 4006, 4021,
+  4034, 4046, 4056, 4065, 4074, 4080, 4086, 4090, 4094, 4095,
+  4096
+};
+
+// sin() of 0 to 360 degrees, times 4096
+static int16_t sine(int16_t angle) {
+  if (angle <= 90)  return  (int16_t) pgm_read_word(sineTable + angle);
+  if (angle <= 180) return  (int16_t) pgm_read_word(sineTable + 180 - angle);
+  if (angle <= 270) return -(int16_t) pgm_read_word(sineTable + angle - 180);
+  return -(int16_t) pgm_read_word(sineTable + 360 - angle);
 }
 
-void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length) {
-  if (x < 0 || x >= this->width()) return;
+void OLEDDisplay::fillArc(int16_t x0, int16_t y0, int16_t radius, int16_t innerRadius, int16_t startAngle, int16_t endAngle) {
+  if (radius < 0 || startAngle == endAngle) return;
+  if (innerRadius < 0) innerRadius = 0;
+
+  int32_t sweep = (int32_t) endAngle - startAngle;
+  if (sweep >= 360 || sweep <= -360 || sweep % 360 == 0) {
+    sweep = 360;
+  } else {
+    sweep = (sweep % 360 + 360) % 360;
+  }
 
-  if (y < 0) {
-    length += y;
-    y = 0;
+  // Columns of the ring right of the centre on every row, the same for the
+  // rows dy above and below it and mirrored on the left. Both edges only
+  // move inwards as dy grows.
+  int32_t outer = (int32_t) radius * (radius + 1);
+  int32_t inner = (int32_t) (innerRadius - 1) * innerRadius;
+  int32_t outerX = radius, innerX = innerRadius - 1;
+
+  OLEDDisplayRows ring;
+  int32_t first = _max(y0 - radius, 0);
+  int32_t last  = _min(y0 + radius, this->height() - 1);
+  if (first > last) return;
+  ring.first = first;
+  ring.last  = last;
+
+  for (int32_t dy = 0; dy <= radius; dy++) {
+    while (outerX * outerX + dy * dy > outer) outerX--;
+    while (innerX >= 0 && innerX * innerX + dy * dy > inner) innerX--;
+    if (y0 - dy < first && y0 + dy > last) break;
+
+    int16_t from = innerRadius == 0 || innerX < 0 ? 0 : innerX + 1;
+    if (y0 - dy >= first && y0 - dy <= last) {
+      ring.from[y0 - dy] = from;
+      ring.to[y0 - dy]   = outerX;
+    }
+    if (y0 + dy >= first && y0 + dy <= last) {
+      ring.from[y0 + dy] = from;
+      ring.to[y0 + dy]   = outerX;
+    }
   }
 
-  if ( (y + length) > this->height()) {
-    length = (this->height() - y);
+  // A quadrant is one span per row, split the sweep at them
+  int16_t angle = (startAngle % 360 + 360) % 360;
+  while (sweep > 0) {
+    int16_t end = _min((angle / 90 + 1) * 90, angle + sweep);
+    fillArcQuadrant(x0, y0, ring, angle, end);
+    sweep -= end - angle;
+    angle = end % 360;
   }
 
-  if (length <= 0) return;
+  // The centre is on the border of all quadrants
+  if (innerRadius == 0) setPixel(x0, y0);
+}
 
+void OLEDDisplay::fillArcQuadrant(int16_t x0, int16_t y0, const OLEDDisplayRows &ring, int16_t startAngle, int16_t endAngle) {
+  // Directions of both angles, x right and y down
+  int32_t startX = sine(startAngle), startY = -sine((startAngle + 90) % 360);
+  int32_t endX   = sine(endAngle),   endY   = -sine((endAngle + 90) % 360);
 
-  uint8_t yOffset = y & 7;
-  uint8_t drawBit;
-  uint8_t *bufferPtr = buffer;
+  uint8_t quadrant = startAngle / 90;
+  bool    right    = quadrant < 2;
+  bool    top      = quadrant == 0 || quadrant == 3;
 
-  bufferPtr += (y >> 3) * this->width();
-  bufferPtr += x;
+  // Rows of the quadrant, up to and including the centre row
+  int32_t first = top ? ring.first : _max(y0, ring.first);
+  int32_t last  = top ? _min(y0, ring.last) : ring.last;
 
-  if (yOffset) {
-    yOffset = 8 - yOffset;
-    drawBit = ~(0xFF >> (yOffset));
+  OLEDDisplayRows rows;
+  beginRows(rows);
 
-    if (length < yOffset) {
-      drawBit &= (0xFF >> (yOffset - length));
-    }
+  for (int32_t row = first; row <= last; row++) {
+    if (ring.from[row] > ring.to[row]) continue;
 
-    switch (color) {
-      case WHITE:   *bufferPtr |=  drawBit; break;
-      case BLACK:   *bufferPtr &= ~drawBit; break;
-      case INVERSE: *bufferPtr ^=  drawBit; break;
-    }
+    int32_t dy    = row - y0;
+    int32_t xFrom = right ? ring.from[row] : -ring.to[row];
+    int32_t xTo   = right ? ring.to[row] : -ring.from[row];
 
-    if (length < yOffset) return;
+    // Clockwise of the start direction: startX * dy - startY * x >= 0
+    if (startY > 0)      xTo   = _min(xTo, floorDiv(startX * dy, startY));
+    else if (startY < 0) xFrom = _max(xFrom, -floorDiv(-startX * dy, startY));
+    else if (startX * dy < 0) continue;
 
-    length -= yOffset;
-    bufferPtr += this->width();
+    // Anticlockwise of the end direction: endX * dy - endY * x < 0
+    if (endY > 0)        xFrom = _max(xFrom, floorDiv(endX * dy, endY) + 1);
+    else if (endY < 0)   xTo   = _min(xTo, -floorDiv(-endX * dy, endY) - 1);
+    else if (endX * dy >= 0) continue;
+
+    addRowSpan(rows, row, x0 + xFrom, x0 + xTo);
   }
 
-  if (length >= 8) {
-    switch (color) {
-      case WHITE:
-      case BLACK:
-        drawBit = (color == WHITE) ? 0xFF : 0x00;
-        do {
-          *bufferPtr = drawBit;
-          bufferPtr += this->width();
-          length -= 8;
-        } while (length >= 8);
-        break;
-      case INVERSE:
-        do {
-          *bufferPtr = ~(*bufferPtr);
-          bufferPtr += this->width();
-          length -= 8;
-        } while (length >= 8);
-        break;
+  fillRows(rows);
+}
+
+void OLEDDisplay::fillRows(const OLEDDisplayRows &rows) {
+  if (rows.first > rows.last) return;
+
+  uint16_t width = this->width();
+  for (uint8_t page = rows.first >> 3; page <= rows.last >> 3; page++) {
+    uint8_t firstRow = _max(page * 8, rows.first);
+    uint8_t lastRow  = _min(page * 8 + 7, rows.last);
+
+    // Columns all rows of the page cover, and all the rows cover
+    int16_t coreFrom = INT16_MIN, coreTo = INT16_MAX;
+    int16_t pageFrom = INT16_MAX, pageTo = INT16_MIN;
+    uint8_t mask = 0;
+    for (uint8_t row = firstRow; row <= lastRow; row++) {
+      if (rows.from[row] > rows.to[row]) continue;
+      mask |= 1 << (row & 7);
+      coreFrom = _max(coreFrom, rows.from[row]);
+      coreTo   = _min(coreTo, rows.to[row]);
+      pageFrom = _min(pageFrom, rows.from[row]);
+      pageTo   = _max(pageTo, rows.to[row]);
     }
-  }
+    if (!mask) continue;
+
+    // The core is one masked fill, the rows only add what sticks out of it
+    uint8_t *bufferPtr = buffer + page * width;
+    bool     core = coreFrom <= coreTo;
+    if (core) fillSpan(bufferPtr + coreFrom, coreTo - coreFrom + 1, mask);
 
-  if (length > 0) {
-    drawBit = (1 << (length & 7)) - 1;
-    switch (color) {
-      case WHITE:   *bufferPtr |=  drawBit; break;
-      case BLACK:   *bufferPtr &= ~drawBit; break;
-      case INVERSE: *bufferPtr ^=  drawBit; break;
+    for (uint8_t row = firstRow; row <= lastRow; row++) {
+      int16_t from = rows.from[row], to = rows.to[row];
+      uint8_t bit  = 1 << (row & 7);
+      if (from > to) continue;
+
+      if (!core) {
+        fillSpan(bufferPtr + from, to - from + 1, bit);
+      } else {
+        if (from < coreFrom) fillSpan(bufferPtr + from, coreFrom - from, bit);
+        if (to > coreTo)     fillSpan(bufferPtr + coreTo + 1, to - coreTo, bit);
+      }
     }
+    markPages(pageFrom, pageTo, page, page);
   }
 }
 
+void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length) {
+  drawHorizontalLineIn(this->width(), this->height(), x, y, length);
+}
+
+void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length) {
+  fillRect(x, y, 1, length);
+}
+
+
 void OLEDDisplay::drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress) {
   uint16_t radius = height / 2;
   uint16_t xRadius = x + radius;
@@ -361,9 +562,24 @@ void OLEDDisplay::drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16
 
   uint16_t maxProgressWidth = (width - doubleRadius + 1) * progress / 100;
 
-  fillCircle(xRadius, yRadius, innerRadius);
-  fillRect(xRadius + 1, y + 2, maxProgressWidth, height - 3);
-  fillCircle(xRadius + maxProgressWidth, yRadius, innerRadius);
+  if (radius < 3) {
+    fillCircle(xRadius, yRadius, innerRadius);
+    fillRect(xRadius + 1, y + 2, maxProgressWidth, height - 3);
+    fillCircle(xRadius + maxProgressWidth, yRadius, innerRadius);
+    return;
+  }
+
+  // Both end caps and the bar between them, every row is one span
+  OLEDDisplayRows rows;
+  beginRows(rows);
+  addCircleRows(rows, xRadius, yRadius, innerRadius);
+  addCircleRows(rows, xRadius + maxProgressWidth, yRadius, innerRadius);
+  if (maxProgressWidth > 0) {
+    for (int32_t row = y + 2; row <= y + height - 2; row++) {
+      addRowSpan(rows, row, xRadius + 1, xRadius + maxProgressWidth);
+    }
+  }
+  fillRows(rows);
 }
 
 void OLEDDisplay::drawFastImage(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *image) {
@@ -389,10 +605,137 @@ void OLEDDisplay::drawXbm(int16_t xMove, int16_t yMove, int16_t width, int16_t h
   }
 }
 
-void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, char* text, uint16_t textLength, uint16_t textWidth) {
+void OLEDDisplay::loadFontMetrics() {
+  #ifdef OLEDDISPLAY_FONT_CACHE
+  if (this->glyphFont == this->fontData) return;
+
+  uint8_t  charNum         = pgm_read_byte(fontData + CHAR_NUM_POS);
+  uint16_t sizeOfJumpTable = charNum * JUMPTABLE_BYTES;
+
+  // Sketches switching fonts every frame reuse the table of the largest
+  // one instead of freeing and allocating it on each switch
+  if (charNum > this->glyphCapacity) {
+    if (this->glyphs) free(this->glyphs);
+    this->glyphs        = (OLEDDisplayGlyph*) malloc(charNum * sizeof(OLEDDisplayGlyph));
+    this->glyphCapacity = this->glyphs ? charNum : 0;
+  }
+  this->glyphFont = this->fontData;
+  this->glyphFirstChar = pgm_read_byte(fontData + FIRST_CHAR_POS);
+  this->glyphCount     = charNum;
+
+  if (!this->glyphs) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][loadFontMetrics] Not enough memory for the font cache, reading from flash\n");
+    return;
+  }
+
+  if (pgm_read_byte(fontData + WIDTH_POS) & FONT_PACKED) {
+    // Glyph data follows in table order, its offsets are the running sum of the sizes
+    const uint8_t *table    = fontData + JUMPTABLE_START;
+    uint16_t       position = JUMPTABLE_START + charNum * PACKED_TABLE_BYTES;
+    for (uint16_t i = 0; i < charNum; i++, table += PACKED_TABLE_BYTES) {
+      glyphs[i].size         = pgm_read_byte(table + PACKED_TABLE_SIZE);
+      glyphs[i].width        = pgm_read_byte(table);
+      glyphs[i].dataPosition = glyphs[i].size ? position : 0;
+      position += glyphs[i].size;
+    }
+    return;
+  }
+
+  const uint8_t *jumpTable = fontData + JUMPTABLE_START;
+  for (uint16_t i = 0; i < charNum; i++, jumpTable += JUMPTABLE_BYTES) {
+    byte msbJumpToChar = pgm_read_byte(jumpTable);
+    byte lsbJumpToChar = pgm_read_byte(jumpTable + JUMPTABLE_LSB);
+
+    // 0xFFFF marks a char without data
+    glyphs[i].dataPosition = (msbJumpToChar == 255 && lsbJumpToChar == 255) ? 0 : JUMPTABLE_START + sizeOfJumpTable + ((msbJumpToChar << 8) + lsbJumpToChar);
+    glyphs[i].size         = pgm_read_byte(jumpTable + JUMPTABLE_SIZE);
+    glyphs[i].width        = pgm_read_byte(jumpTable + JUMPTABLE_WIDTH);
+  }
+  #endif
+}
+
+bool inline OLEDDisplay::getGlyph(uint8_t code, OLEDDisplayGlyph &glyph) {
+  #ifdef OLEDDISPLAY_FONT_CACHE
+  if (this->glyphs && this->glyphFont == this->fontData) {
+    // Chars below glyphFirstChar wrap around past glyphCount
+    uint8_t charCode = code - this->glyphFirstChar;
+    if (charCode >= this->glyphCount) return false;
+    glyph = this->glyphs[charCode];
+    return true;
+  }
+  #endif
+
+  uint8_t firstChar = pgm_read_byte(fontData + FIRST_CHAR_POS);
+  uint8_t charNum   = pgm_read_byte(fontData + CHAR_NUM_POS);
+  if (code < firstChar || code - firstChar >= charNum) return false;
+  uint8_t charCode = code - firstChar;
+
+  if (pgm_read_byte(fontData + WIDTH_POS) & FONT_PACKED) {
+    const uint8_t *table    = fontData + JUMPTABLE_START;
+    uint16_t       position = JUMPTABLE_START + charNum * PACKED_TABLE_BYTES;
+    for (uint8_t i = 0; i < charCode; i++, table += PACKED_TABLE_BYTES) {
+      position += pgm_read_byte(table + PACKED_TABLE_SIZE);
+    }
+    glyph.size         = pgm_read_byte(table + PACKED_TABLE_SIZE);
+    glyph.width        = pgm_read_byte(table);
+    glyph.dataPosition = glyph.size ? position : 0;
+    return true;
+  }
+
+  // 4 Bytes per char code
+  const uint8_t *jumpTable = fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES;
+  byte msbJumpToChar = pgm_read_byte(jumpTable);                  // MSB  \ JumpAddress
+  byte lsbJumpToChar = pgm_read_byte(jumpTable + JUMPTABLE_LSB);  // LSB /
+
+  glyph.dataPosition = (msbJumpToChar == 255 && lsbJumpToChar == 255) ? 0 : JUMPTABLE_START + charNum * JUMPTABLE_BYTES + ((msbJumpToChar << 8) + lsbJumpToChar);
+  glyph.size         = pgm_read_byte(jumpTable + JUMPTABLE_SIZE);
+  glyph.width        = pgm_read_byte(jumpTable + JUMPTABLE_WIDTH);
+  return true;
+}
+
+uint8_t inline OLEDDisplay::getCharWidth(uint8_t code) {
+  OLEDDisplayGlyph glyph;
+  return getGlyph(code, glyph) ? glyph.width : 0;
+}
+
+// Byte `i` of `text`, read from flash for TEXT_SOURCE_FLASH
+static inline uint8_t textByte(const char* text, uint16_t i, OLEDDISPLAY_TEXT_SOURCE source) {
+  return source == TEXT_SOURCE_FLASH ? pgm_read_byte(text + i) : (uint8_t) text[i];
+}
+
+uint8_t inline OLEDDisplay::readChar(const char* text, uint16_t &i, uint16_t length, OLEDDISPLAY_TEXT_SOURCE source) {
+  if (source == TEXT_SOURCE_FONT_TABLE) return text[i++];
+
+  // convert UTF-8 character to font table index. The lookup function keeps
+  // the last byte it was fed, so all bytes of the char go in at once, lead
+  // byte first, and the index of the last one counts: passes over other
+  // text in between, like the ones drawStringMaxWidth() runs for every
+  // line, can't change it.
+  uint8_t lead = textByte(text, i++, source);
+  uint8_t code = (this->fontTableLookupFunction)(lead);
+  uint8_t continuations = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+  for (; continuations > 0 && i < length; continuations--, i++) {
+    uint8_t ch = textByte(text, i, source);
+    if ((ch & 0xC0) != 0x80) break;
+    code = (this->fontTableLookupFunction)(ch);
+  }
+  return code;
+}
+
+#ifdef OLEDDISPLAY_FONT_CACHE
+// FNV-1a, only used to recognise strings in the layout cache
+static uint32_t hashText(const char *text, uint16_t length, OLEDDISPLAY_TEXT_SOURCE source) {
+  uint32_t hash = 2166136261UL;
+  for (uint16_t i = 0; i < length; i++) {
+    hash ^= textByte(text, i, source);
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+#endif
+
+void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, const char* text, uint16_t textLength, uint16_t textWidth, OLEDDISPLAY_TEXT_SOURCE source) {
   uint8_t textHeight       = pgm_read_byte(fontData + HEIGHT_POS);
-  uint8_t firstChar        = pgm_read_byte(fontData + FIRST_CHAR_POS);
-  uint16_t sizeOfJumpTable = pgm_read_byte(fontData + CHAR_NUM_POS)  * JUMPTABLE_BYTES;
 
   uint8_t cursorX         = 0;
   uint8_t cursorY         = 0;
@@ -415,38 +758,35 @@ void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, char* text, u
   if (xMove + textWidth  < 0 || xMove > this->width() ) {return;}
   if (yMove + textHeight < 0 || yMove > this->width() ) {return;}
 
-  for (uint16_t j = 0; j < textLength; j++) {
-    int16_t xPos = xMove + cursorX;
-    int16_t yPos = yMove + cursorY;
-
-    byte code = text[j];
-    if (code >= firstChar) {
-      byte charCode = code - firstChar;
-
-      // 4 Bytes per char code
-      byte msbJumpToChar    = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES );                  // MSB  \ JumpAddress
-      byte lsbJumpToChar    = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_LSB);   // LSB /
-      byte charByteSize     = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_SIZE);  // Size
-      byte currentCharWidth = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_WIDTH); // Width
-
-      // Test if the char is drawable
-      if (!(msbJumpToChar == 255 && lsbJumpToChar == 255)) {
-        // Get the position of the char data
-        uint16_t charDataPosition = JUMPTABLE_START + sizeOfJumpTable + ((msbJumpToChar << 8) + lsbJumpToChar);
-        drawInternal(xPos, yPos, currentCharWidth, textHeight, fontData, charDataPosition, charByteSize);
-      }
+  loadFontMetrics();
 
-      cursorX += currentCharWidth;
-    }
+  bool packed = pgm_read_byte(fontData + WIDTH_POS) & FONT_PACKED;
+
+  for (uint16_t j = 0; j < textLength;) {
+    uint8_t code = readChar(text, j, textLength, source);
+    if (code == 0) continue;
+
+    cursorX += drawGlyph(xMove + cursorX, yMove + cursorY, code, textHeight, packed);
   }
 }
 
+uint8_t inline OLEDDisplay::drawGlyph(int16_t xMove, int16_t yMove, uint8_t code, uint8_t textHeight, bool packed) {
+  OLEDDisplayGlyph glyph;
+  if (!getGlyph(code, glyph)) return 0;
 
-void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, String strUser) {
-  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+  // Test if the char is drawable
+  if (glyph.dataPosition) {
+    if (packed) {
+      drawPackedGlyph(xMove, yMove, fontData + glyph.dataPosition);
+    } else {
+      drawInternal(xMove, yMove, glyph.width, textHeight, fontData, glyph.dataPosition, glyph.size);
+    }
+  }
+  return glyph.width;
+}
 
-  // char* text must be freed!
-  char* text = utf8ascii(strUser);
+void OLEDDisplay::drawStringLinesInternal(int16_t xMove, int16_t yMove, const char* text, uint16_t length, OLEDDISPLAY_TEXT_SOURCE source) {
+  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
 
   uint16_t yOffset = 0;
   // If the string should be centered vertically too
@@ -454,53 +794,119 @@ void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, String strUser) {
   if (textAlignment == TEXT_ALIGN_CENTER_BOTH) {
     uint16_t lb = 0;
     // Find number of linebreaks in text
-    for (uint16_t i=0;text[i] != 0; i++) {
-      lb += (text[i] == 10);
+    for (uint16_t i = 0; i < length; i++) {
+      lb += (textByte(text, i, source) == 10);
     }
     // Calculate center
     yOffset = (lb * lineHeight) / 2;
   }
 
+  // Draw every non-empty line, empty ones don't advance the cursor
   uint16_t line = 0;
-  char* textPart = strtok(text,"\n");
-  while (textPart != NULL) {
-    uint16_t length = strlen(textPart);
-    drawStringInternal(xMove, yMove - yOffset + (line++) * lineHeight, textPart, length, getStringWidth(textPart, length));
-    textPart = strtok(NULL, "\n");
+  uint16_t lineStart = 0;
+  for (uint16_t i = 0; i <= length; i++) {
+    if (i < length && textByte(text, i, source) != 10) continue;
+    if (i > lineStart) {
+      uint16_t lineLength = i - lineStart;
+      drawStringInternal(xMove, yMove - yOffset + (line++) * lineHeight, text + lineStart, lineLength, getStringWidthInternal(text + lineStart, lineLength, source), source);
+    }
+    lineStart = i + 1;
   }
-  free(text);
 }
 
-void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, String strUser) {
-  uint16_t firstChar  = pgm_read_byte(fontData + FIRST_CHAR_POS);
-  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const char* text, uint16_t length) {
+  drawStringLinesInternal(xMove, yMove, text, length, TEXT_SOURCE_RAM);
+}
+
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const char* text) {
+  drawStringLinesInternal(xMove, yMove, text, strlen(text), TEXT_SOURCE_RAM);
+}
+
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const __FlashStringHelper* text) {
+  drawStringLinesInternal(xMove, yMove, (const char*) text, strlen_P((PGM_P) text), TEXT_SOURCE_FLASH);
+}
+
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const String &text) {
+  drawStringLinesInternal(xMove, yMove, text.c_str(), text.length(), TEXT_SOURCE_RAM);
+}
 
-  char* text = utf8ascii(strUser);
+void OLEDDisplay::drawStringMaxWidthInternal(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const char* text, uint16_t length, OLEDDISPLAY_TEXT_SOURCE source) {
+  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
 
-  uint16_t length = strlen(text);
   uint16_t lastDrawnPos = 0;
   uint16_t lineNumber = 0;
   uint16_t strWidth = 0;
 
   uint16_t preferredBreakpoint = 0;
+  uint16_t endOfBreakpoint = 0;
   uint16_t widthAtBreakpoint = 0;
 
-  for (uint16_t i = 0; i < length; i++) {
-    strWidth += pgm_read_byte(fontData + JUMPTABLE_START + (text[i] - firstChar) * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
+  loadFontMetrics();
+
+  #ifdef OLEDDISPLAY_FONT_CACHE
+  // Reuse the line breaks if this string was wrapped recently
+  uint32_t hash = hashText(text, length, source);
+  OLEDDisplayTextLayout *layout = NULL;
+  for (uint8_t i = 0; i < OLEDDISPLAY_LAYOUT_CACHE_SIZE; i++) {
+    OLEDDisplayTextLayout *cached = &this->layouts[i];
+    if (cached->fontData == fontData && cached->hash == hash && cached->length == length && cached->maxLineWidth == maxLineWidth) {
+      for (uint8_t line = 0; line < cached->lines; line++) {
+        drawStringInternal(xMove, yMove + line * lineHeight, text + cached->lineStart[line], cached->lineLength[line], cached->lineWidth[line], source);
+      }
+      return;
+    }
+  }
+
+  // Otherwise remember them in the oldest slot
+  layout = &this->layouts[this->nextLayout];
+  this->nextLayout = (this->nextLayout + 1) % OLEDDISPLAY_LAYOUT_CACHE_SIZE;
+  layout->fontData     = NULL;
+  layout->hash         = hash;
+  layout->length       = length;
+  layout->maxLineWidth = maxLineWidth;
+  layout->lines        = 0;
+  #endif
+
+  // Positions are byte offsets into the UTF-8 text, lines only break
+  // between chars. The next line starts at endOfBreakpoint, past the
+  // space or dash at preferredBreakpoint.
+  for (uint16_t i = 0; i < length;) {
+    uint16_t charStart = i;
+    uint8_t code = readChar(text, i, length, source);
+    if (code == 0) continue;
+
+    uint8_t charWidth = getCharWidth(code);
+    strWidth += charWidth;
 
     // Always try to break on a space or dash
-    if (text[i] == ' ' || text[i]== '-') {
-      preferredBreakpoint = i;
+    if (code == ' ' || code == '-') {
+      preferredBreakpoint = charStart;
+      endOfBreakpoint = i;
       widthAtBreakpoint = strWidth;
     }
 
     if (strWidth >= maxLineWidth) {
       if (preferredBreakpoint == 0) {
-        preferredBreakpoint = i;
-        widthAtBreakpoint = strWidth;
+        // The char that doesn't fit starts the next line, unless it is
+        // the only one on this line
+        if (charStart > lastDrawnPos) {
+          preferredBreakpoint = charStart;
+          widthAtBreakpoint = strWidth - charWidth;
+        } else {
+          preferredBreakpoint = i;
+          widthAtBreakpoint = strWidth;
+        }
+        endOfBreakpoint = preferredBreakpoint;
+      }
+      #ifdef OLEDDISPLAY_FONT_CACHE
+      if (lineNumber < OLEDDISPLAY_LAYOUT_MAX_LINES) {
+        layout->lineStart[lineNumber]  = lastDrawnPos;
+        layout->lineLength[lineNumber] = preferredBreakpoint - lastDrawnPos;
+        layout->lineWidth[lineNumber]  = widthAtBreakpoint;
       }
-      drawStringInternal(xMove, yMove + (lineNumber++) * lineHeight , &text[lastDrawnPos], preferredBreakpoint - lastDrawnPos, widthAtBreakpoint);
-      lastDrawnPos = preferredBreakpoint + 1;
+      #endif
+      drawStringInternal(xMove, yMove + (lineNumber++) * lineHeight , text + lastDrawnPos, preferredBreakpoint - lastDrawnPos, widthAtBreakpoint, source);
+      lastDrawnPos = endOfBreakpoint;
       // It is possible that we did not draw all letters to i so we need
       // to account for the width of the chars from `i - preferredBreakpoint`
       // by calculating the width we did not draw yet.
@@ -511,35 +917,75 @@ void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxL
 
   // Draw last part if needed
   if (lastDrawnPos < length) {
-    drawStringInternal(xMove, yMove + lineNumber * lineHeight , &text[lastDrawnPos], length - lastDrawnPos, getStringWidth(&text[lastDrawnPos], length - lastDrawnPos));
+    uint16_t lastWidth = getStringWidthInternal(text + lastDrawnPos, length - lastDrawnPos, source);
+    #ifdef OLEDDISPLAY_FONT_CACHE
+    if (lineNumber < OLEDDISPLAY_LAYOUT_MAX_LINES) {
+      layout->lineStart[lineNumber]  = lastDrawnPos;
+      layout->lineLength[lineNumber] = length - lastDrawnPos;
+      layout->lineWidth[lineNumber]  = lastWidth;
+    }
+    #endif
+    drawStringInternal(xMove, yMove + (lineNumber++) * lineHeight , text + lastDrawnPos, length - lastDrawnPos, lastWidth, source);
+  }
+
+  #ifdef OLEDDISPLAY_FONT_CACHE
+  // Strings with more lines than a slot holds are not cached
+  if (lineNumber <= OLEDDISPLAY_LAYOUT_MAX_LINES) {
+    layout->fontData = fontData;
+    layout->lines    = lineNumber;
   }
+  #endif
+}
 
-  free(text);
+void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const char* text, uint16_t length) {
+  drawStringMaxWidthInternal(xMove, yMove, maxLineWidth, text, length, TEXT_SOURCE_RAM);
 }
 
-uint16_t OLEDDisplay::getStringWidth(const char* text, uint16_t length) {
-  uint16_t firstChar        = pgm_read_byte(fontData + FIRST_CHAR_POS);
+void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const char* text) {
+  drawStringMaxWidthInternal(xMove, yMove, maxLineWidth, text, strlen(text), TEXT_SOURCE_RAM);
+}
 
+void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const __FlashStringHelper* text) {
+  drawStringMaxWidthInternal(xMove, yMove, maxLineWidth, (const char*) text, strlen_P((PGM_P) text), TEXT_SOURCE_FLASH);
+}
+
+void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const String &text) {
+  drawStringMaxWidthInternal(xMove, yMove, maxLineWidth, text.c_str(), text.length(), TEXT_SOURCE_RAM);
+}
+
+uint16_t OLEDDisplay::getStringWidthInternal(const char* text, uint16_t length, OLEDDISPLAY_TEXT_SOURCE source) {
   uint16_t stringWidth = 0;
   uint16_t maxWidth = 0;
 
-  while (length--) {
-    stringWidth += pgm_read_byte(fontData + JUMPTABLE_START + (text[length] - firstChar) * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
-    if (text[length] == 10) {
+  loadFontMetrics();
+
+  for (uint16_t i = 0; i < length;) {
+    uint8_t code = readChar(text, i, length, source);
+    if (code == 10) {
       maxWidth = max(maxWidth, stringWidth);
       stringWidth = 0;
+    } else if (code != 0) {
+      stringWidth += getCharWidth(code);
     }
   }
 
   return max(maxWidth, stringWidth);
 }
 
-uint16_t OLEDDisplay::getStringWidth(String strUser) {
-  char* text = utf8ascii(strUser);
-  uint16_t length = strlen(text);
-  uint16_t width = getStringWidth(text, length);
-  free(text);
-  return width;
+uint16_t OLEDDisplay::getStringWidth(const char* text, uint16_t length) {
+  return getStringWidthInternal(text, length, TEXT_SOURCE_RAM);
+}
+
+uint16_t OLEDDisplay::getStringWidth(const char* text) {
+  return getStringWidthInternal(text, strlen(text), TEXT_SOURCE_RAM);
+}
+
+uint16_t OLEDDisplay::getStringWidth(const __FlashStringHelper* text) {
+  return getStringWidthInternal((const char*) text, strlen_P((PGM_P) text), TEXT_SOURCE_FLASH);
+}
+
+uint16_t OLEDDisplay::getStringWidth(const String &text) {
+  return getStringWidthInternal(text.c_str(), text.length(), TEXT_SOURCE_RAM);
 }
 
 void OLEDDisplay::setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment) {
@@ -548,6 +994,7 @@ void OLEDDisplay::setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment) {
 
 void OLEDDisplay::setFont(const uint8_t *fontData) {
   this->fontData = fontData;
+  loadFontMetrics();
 }
 
 void OLEDDisplay::displayOn(void) {
@@ -567,15 +1014,15 @@ void OLEDDisplay::normalDisplay(void) {
 }
 
 void OLEDDisplay::setContrast(uint8_t contrast, uint8_t precharge, uint8_t comdetect) {
-  sendCommand(SETPRECHARGE); //0xD9
-  sendCommand(precharge); //0xF1 default, to lower the contrast, put 1-1F
-  sendCommand(SETCONTRAST);
-  sendCommand(contrast); // 0-255
-  sendCommand(SETVCOMDETECT); //0xDB, (additionally needed to lower the contrast)
-  sendCommand(comdetect);	//0x40 default, to lower the contrast, put 0
-  sendCommand(DISPLAYALLON_RESUME);
-  sendCommand(NORMALDISPLAY);
-  sendCommand(DISPLAYON);
+  const uint8_t commands[] = {
+    SETPRECHARGE, precharge,      //0xD9, 0xF1 default, to lower the contrast, put 1-1F
+    SETCONTRAST, contrast,        // 0-255
+    SETVCOMDETECT, comdetect,     //0xDB, 0x40 default, to lower the contrast, put 0
+    DISPLAYALLON_RESUME,
+    NORMALDISPLAY,
+    DISPLAYON
+  };
+  sendCommands(commands, sizeof(commands));
 }
 
 void OLEDDisplay::setBrightness(uint8_t brightness) {
@@ -597,53 +1044,323 @@ void OLEDDisplay::setBrightness(uint8_t brightness) {
 }
 
 void OLEDDisplay::resetOrientation() {
-  sendCommand(SEGREMAP);
-  sendCommand(COMSCANINC);           //Reset screen rotation or mirroring
+  const uint8_t commands[] = { SEGREMAP, COMSCANINC };         //Reset screen rotation or mirroring
+  sendCommands(commands, sizeof(commands));
 }
 
 void OLEDDisplay::flipScreenVertically() {
-  sendCommand(SEGREMAP | 0x01);
-  sendCommand(COMSCANDEC);           //Rotate screen 180 Deg
+  const uint8_t commands[] = { SEGREMAP | 0x01, COMSCANDEC };  //Rotate screen 180 Deg
+  sendCommands(commands, sizeof(commands));
 }
 
 void OLEDDisplay::mirrorScreen() {
-  sendCommand(SEGREMAP);
-  sendCommand(COMSCANDEC);           //Mirror screen
+  const uint8_t commands[] = { SEGREMAP, COMSCANDEC };         //Mirror screen
+  sendCommands(commands, sizeof(commands));
+}
+
+bool OLEDDisplay::setStartLine(uint8_t line) {
+  if (this->height() != 64) return false;
+  sendCommand(SETSTARTLINE | (line & 63));
+  return true;
 }
 
 void OLEDDisplay::clear(void) {
   memset(buffer, 0, displayBufferSize);
+
+  #ifdef OLEDDISPLAY_PARTIAL_UPDATE
+  // Only what was drawn since the last clear() can have turned black
+  for (uint8_t page = 0; page < this->height() / 8; page++) {
+    if (inked[page].from > inked[page].to) continue;
+    dirty[page].from = _min(dirty[page].from, inked[page].from);
+    dirty[page].to   = _max(dirty[page].to, inked[page].to);
+    inked[page].from = UINT8_MAX;
+    inked[page].to   = 0;
+  }
+  #endif
+}
+
+void OLEDDisplay::markDirty(int16_t x, int16_t y, int16_t width, int16_t height) {
+  int32_t x0 = x, y0 = y;
+  int32_t x1 = x0 + width, y1 = y0 + height;
+
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 > this->width())  x1 = this->width();
+  if (y1 > this->height()) y1 = this->height();
+
+  if (x0 >= x1 || y0 >= y1) return;
+
+  markPages(x0, x1 - 1, y0 >> 3, (y1 - 1) >> 3);
+}
+
+void OLEDDisplay::markDirty(void) {
+  markPages(0, this->width() - 1, 0, this->height() / 8 - 1);
+}
+
+
+#ifdef OLEDDISPLAY_PARTIAL_UPDATE
+bool OLEDDisplay::updateBackBuffer(OLEDDisplaySpan *changed) {
+  bool anyChanged = false;
+
+  // buffer_back holds the pages an incremental flush still has to send
+  while (!flushStep(UINT32_MAX));
+
+  // Pages and columns nobody drew to or cleared can't differ from buffer_back.
+  // Anything drawn since the last display() is inside the inked spans.
+  for (uint8_t y = 0; y < this->height() / 8; y++) {
+    uint8_t first = dirty[y].from;
+    uint8_t last  = dirty[y].to;
+    if (inkedSinceDisplay) {
+      first = _min(first, inked[y].from);
+      last  = _max(last, inked[y].to);
+    }
+
+    changed[y].from = UINT8_MAX;
+    changed[y].to   = 0;
+    dirty[y].from   = UINT8_MAX;
+    dirty[y].to     = 0;
+    if (first > last) continue;
+
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    uint16_t pos = y * this->width();
+
+    // Narrow the span down to the bytes that really changed
+    while (first <= last && buffer[pos + first] == buffer_back[pos + first]) first++;
+    if (first <= last) {
+      while (buffer[pos + last] == buffer_back[pos + last]) last--;
+
+      changed[y].from = first;
+      changed[y].to   = last;
+      anyChanged = true;
+
+      memcpy(buffer_back + pos + first, buffer + pos + first, last - first + 1);
+    }
+    #else
+    anyChanged |= updateChecksums(y, first, last, changed[y]);
+    #endif
+    yield();
+  }
+  inkedSinceDisplay = false;
+  #ifdef OLEDDISPLAY_CHECKSUM_BUFFER
+  checksumsValid = true;
+  #endif
+
+  return anyChanged;
+}
+#endif
+
+#ifdef OLEDDISPLAY_CHECKSUM_BUFFER
+// CRC-16/CCITT, four bits at a time
+static const uint16_t crcNibbles[16] PROGMEM = {
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+static uint16_t crc16(const uint8_t *data, uint8_t length) {
+  uint16_t crc = 0xFFFF;
+  while (length--) {
+    crc = (crc << 4) ^ pgm_read_word(crcNibbles + ((crc >> 12) ^ (*data >> 4)));
+    crc = (crc << 4) ^ pgm_read_word(crcNibbles + ((crc >> 12) ^ (*data & 0x0F)));
+    data++;
+  }
+  return crc;
+}
+
+bool OLEDDisplay::updateChecksums(uint8_t page, uint8_t x0, uint8_t x1, OLEDDisplaySpan &changed) {
+  bool anyChanged = false;
+  for (uint8_t block = x0 / OLEDDISPLAY_CHECKSUM_BLOCK; block <= x1 / OLEDDISPLAY_CHECKSUM_BLOCK; block++) {
+    uint8_t from = block * OLEDDISPLAY_CHECKSUM_BLOCK;
+    uint8_t to   = _min(from + OLEDDISPLAY_CHECKSUM_BLOCK, this->width()) - 1;
+
+    uint16_t crc = crc16(buffer + page * this->width() + from, to - from + 1);
+    if (crc == checksums[page][block] && checksumsValid) continue;
+    checksums[page][block] = crc;
+
+    changed.from = _min(changed.from, from);
+    changed.to   = _max(changed.to, to);
+    anyChanged = true;
+  }
+  return anyChanged;
+}
+#endif
+
+uint8_t OLEDDisplay::planFlush(const OLEDDisplaySpan *changed, uint8_t pages, uint16_t windowCost, uint16_t pageCost, OLEDDisplayWindow *windows) {
+  // cost[j] is the cheapest way to send the changes on pages 0..j-1. The
+  // last window used for it starts at page start[j], start[j] == j means
+  // page j-1 had no changes. Pages without changes may sit inside a window.
+  uint32_t cost[OLEDDISPLAY_MAX_PAGES + 1];
+  uint8_t  start[OLEDDISPLAY_MAX_PAGES + 1];
+
+  cost[0] = 0;
+  for (uint8_t j = 1; j <= pages; j++) {
+    cost[j]  = cost[j - 1];
+    start[j] = j;
+    if (changed[j - 1].from > changed[j - 1].to) continue;
+
+    cost[j] = UINT32_MAX;
+    uint8_t fromX = UINT8_MAX, toX = 0;
+    for (int8_t i = j - 1; i >= 0; i--) {
+      if (changed[i].from > changed[i].to) continue;
+      fromX = _min(fromX, changed[i].from);
+      toX   = _max(toX, changed[i].to);
+
+      uint32_t windowPages = j - i;
+      uint32_t c = cost[i] + windowCost + windowPages * (pageCost + toX - fromX + 1);
+      if (c < cost[j]) {
+        cost[j]  = c;
+        start[j] = i;
+      }
+    }
+  }
+
+  // Walk back from the last page, then put the windows in top to bottom order
+  uint8_t count = 0;
+  for (uint8_t j = pages; j > 0; ) {
+    uint8_t i = start[j];
+    if (i == j) { j--; continue; }
+
+    OLEDDisplayWindow &window = windows[count++];
+    window.fromX    = UINT8_MAX;
+    window.toX      = 0;
+    window.fromPage = i;
+    window.toPage   = j - 1;
+    for (uint8_t page = i; page < j; page++) {
+      if (changed[page].from > changed[page].to) continue;
+      window.fromX = _min(window.fromX, changed[page].from);
+      window.toX   = _max(window.toX, changed[page].to);
+    }
+    j = i;
+  }
+  for (uint8_t w = 0; w < count / 2; w++) {
+    OLEDDisplayWindow swap = windows[w];
+    windows[w] = windows[count - 1 - w];
+    windows[count - 1 - w] = swap;
+  }
+  return count;
+}
+
+uint8_t OLEDDisplay::planWindows(const OLEDDisplaySpan *changed, OLEDDisplayWindow *windows) {
+  return planFlush(changed, this->height() / 8, 24, 0, windows);
+}
+
+bool OLEDDisplay::beginFlush(FlushCallback callback) {
+  #ifdef OLEDDISPLAY_PARTIAL_UPDATE
+  if (canFlushIncrementally()) {
+    if (flushWindowCount > 0) return false;
+
+    OLEDDisplaySpan changed[OLEDDISPLAY_MAX_PAGES];
+    if (updateBackBuffer(changed)) {
+      // From here on buffer_back is the frame in transit, checksums
+      // are updated as the pages go out
+      flushWindowCount = planWindows(changed, flushWindows);
+      flushWindow      = 0;
+      flushPage        = flushWindows[0].fromPage;
+      flushCallback    = callback;
+      return true;
+    }
+    if (callback) callback(this);
+    return true;
+  }
+  #endif
+  display();
+  if (callback) callback(this);
+  return true;
+}
+
+bool OLEDDisplay::flushStep(uint32_t budgetMicros) {
+  #ifdef OLEDDISPLAY_PARTIAL_UPDATE
+  if (flushWindowCount == 0) return true;
+
+  uint32_t start = micros();
+  uint32_t used  = 0;
+  bool     sent  = false;
+  while (flushWindow < flushWindowCount) {
+    // Leave the next page for later if it likely doesn't fit the budget
+    if (sent && used + flushPageMicros >= budgetMicros) return false;
+
+    const OLEDDisplayWindow &window = flushWindows[flushWindow];
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    sendWindowPage(window, flushPage, buffer_back + flushPage * this->width() + window.fromX);
+    #else
+    // Without a copy the page goes out as it is now, which may be newer
+    // than what beginFlush() summed up
+    OLEDDisplaySpan sentSpan = { UINT8_MAX, 0 };
+    sendWindowPage(window, flushPage, buffer + flushPage * this->width() + window.fromX);
+    updateChecksums(flushPage, window.fromX, window.toX, sentSpan);
+    #endif
+    sent = true;
+
+    if (flushPage < window.toPage) {
+      flushPage++;
+    } else if (++flushWindow < flushWindowCount) {
+      flushPage = flushWindows[flushWindow].fromPage;
+    }
+
+    uint32_t elapsed = micros() - start;
+    uint32_t page    = elapsed - used;
+    used = elapsed;
+    flushPageMicros = flushPageMicros ? (flushPageMicros * 3 + page) / 4 : page;
+  }
+
+  flushWindowCount = 0;
+  FlushCallback callback = flushCallback;
+  flushCallback = NULL;
+  if (callback) callback(this);
+  #else
+  (void) budgetMicros;
+  #endif
+  return true;
+}
+
+bool OLEDDisplay::isFlushing(void) {
+  #ifdef OLEDDISPLAY_PARTIAL_UPDATE
+  return flushWindowCount > 0;
+  #else
+  return false;
+  #endif
 }
 
 void OLEDDisplay::drawLogBuffer(uint16_t xMove, uint16_t yMove) {
-  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+  if (this->logBufferSize == 0) return;
+
+  uint8_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+  bool    packed     = pgm_read_byte(fontData + WIDTH_POS) & FONT_PACKED;
+  uint8_t cellWidth  = pgm_read_byte(fontData + WIDTH_POS) & ~FONT_PACKED;
   // Always align left
   setTextAlignment(TEXT_ALIGN_LEFT);
-
-  // State values
-  uint16_t length   = 0;
-  uint16_t line     = 0;
-  uint16_t lastPos  = 0;
-
-  for (uint16_t i=0;i<this->logBufferFilled;i++){
-    // Everytime we have a \n print
-    if (this->logBuffer[i] == 10) {
-      length++;
-      // Draw string on line `line` from lastPos to length
-      // Passing 0 as the lenght because we are in TEXT_ALIGN_LEFT
-      drawStringInternal(xMove, yMove + (line++) * lineHeight, &this->logBuffer[lastPos], length, 0);
-      // Remember last pos
-      lastPos = i;
-      // Reset length
-      length = 0;
+  loadFontMetrics();
+
+  uint16_t lineSlots = this->logBufferMode == LOG_CELLS ? this->logBufferMaxLines : this->logBufferMaxLines + 1;
+  uint16_t slot      = this->logBufferFirstLine;
+  uint16_t position  = this->logBufferStart;
+
+  // Only the lines up to the bottom of the screen
+  for (uint16_t line = 0; line <= this->logBufferLine; line++) {
+    int16_t  y      = yMove + line * lineHeight;
+    uint16_t length = this->logLineLength[slot];
+    if (y >= this->height()) break;
+
+    if (this->logBufferMode == LOG_CELLS) {
+      const char *cells = this->logBuffer + slot * this->logBufferChars;
+      for (uint16_t column = 0; column < length; column++) {
+        int16_t x = xMove + column * cellWidth;
+        if (x >= this->width()) break;
+        drawGlyph(x, y, cells[column], lineHeight, packed);
+      }
     } else {
-      // Count chars until next linebreak
-      length++;
+      // The ring may wrap in the middle of a line
+      uint16_t head = _min(length, this->logBufferSize - position);
+      drawStringInternal(xMove, y, this->logBuffer + position, head, 0, TEXT_SOURCE_FONT_TABLE);
+      if (head < length) {
+        uint16_t headWidth = getStringWidthInternal(this->logBuffer + position, head, TEXT_SOURCE_FONT_TABLE);
+        drawStringInternal(xMove + headWidth, y, this->logBuffer, length - head, 0, TEXT_SOURCE_FONT_TABLE);
+      }
+      // Skip the line and its \n
+      position += length + 1;
+      if (position >= this->logBufferSize) position -= this->logBufferSize;
     }
-  }
-  // Draw the remaining string
-  if (length > 0) {
-    drawStringInternal(xMove, yMove + line * lineHeight, &this->logBuffer[lastPos], length, 0);
+
+    if (++slot == lineSlots) slot = 0;
   }
 }
 
@@ -655,70 +1372,109 @@ uint16_t OLEDDisplay::getHeight(void) {
   return displayHeight;
 }
 
-bool OLEDDisplay::setLogBuffer(uint16_t lines, uint16_t chars){
+bool OLEDDisplay::setLogBuffer(uint16_t lines, uint16_t chars, OLEDDISPLAY_LOG_MODE mode){
   if (logBuffer != NULL) free(logBuffer);
+  this->logBuffer     = NULL;
+  this->logBufferSize = 0;
   uint16_t size = lines * chars;
   if (size > 0) {
-    this->logBufferLine     = 0;      // Lines printed
-    this->logBufferFilled   = 0;      // Nothing stored yet
-    this->logBufferMaxLines = lines;  // Lines max printable
-    this->logBufferSize     = size;   // Total number of characters the buffer can hold
-    this->logBuffer         = (char *) malloc(size * sizeof(uint8_t));
+    // LOG_LINES has one more line, empty, once `lines` are complete
+    uint16_t lineSlots = mode == LOG_CELLS ? lines : lines + 1;
+    uint16_t textBytes = (size + 1) & ~1; // keeps logLineLength aligned
+
+    this->logBuffer         = (char *) malloc(textBytes + lineSlots * sizeof(uint16_t));
     if(!this->logBuffer) {
       DEBUG_OLEDDISPLAY("[OLEDDISPLAY][setLogBuffer] Not enough memory to create log buffer\n");
       return false;
     }
+    this->logLineLength      = (uint16_t *) (this->logBuffer + textBytes);
+    this->logLineLength[0]   = 0;
+    this->logBufferMode      = mode;
+    this->logBufferLine      = 0;      // Lines printed
+    this->logBufferFirstLine = 0;      // Slot of the oldest line
+    this->logBufferStart     = 0;      // Ring index of its first char
+    this->logBufferFilled    = 0;      // Nothing stored yet
+    this->logBufferNewline   = false;
+    this->logBufferMaxLines  = lines;  // Lines max printable
+    this->logBufferChars     = chars;
+    this->logBufferSize      = size;   // Total number of characters the buffer can hold
   }
   return true;
 }
 
+void OLEDDisplay::logNewLine(void) {
+  uint16_t lineSlots = this->logBufferMode == LOG_CELLS ? this->logBufferMaxLines : this->logBufferMaxLines + 1;
+  if (this->logBufferLine + 1 < lineSlots) {
+    this->logBufferLine++;
+  } else if (++this->logBufferFirstLine == lineSlots) {
+    this->logBufferFirstLine = 0;
+  }
+  uint16_t slot = this->logBufferFirstLine + this->logBufferLine;
+  this->logLineLength[slot >= lineSlots ? slot - lineSlots : slot] = 0;
+}
+
 size_t OLEDDisplay::write(uint8_t c) {
   if (this->logBufferSize > 0) {
     // Don't waste space on \r\n line endings, dropping \r
     if (c == 13) return 1;
 
-    // convert UTF-8 character to font table index
+    // convert UTF-8 character to font table index. Text drawn since the
+    // byte before may have fed the lookup function other bytes, so unless
+    // this one is ASCII it gets the byte before fed again first.
+    uint8_t lastByte = this->logBufferLastByte;
+    this->logBufferLastByte = c;
+    if (c >= 0x80) (this->fontTableLookupFunction)(lastByte);
     c = (this->fontTableLookupFunction)(c);
     // drop unknown character
     if (c == 0) return 1;
 
+    uint16_t slot = this->logBufferFirstLine + this->logBufferLine;
+
+    if (this->logBufferMode == LOG_CELLS) {
+      // A \n only ends the line, the next char starts a new one
+      if (slot >= this->logBufferMaxLines) slot -= this->logBufferMaxLines;
+      if (this->logBufferNewline || (c != 10 && this->logLineLength[slot] == this->logBufferChars)) {
+        logNewLine();
+        slot = this->logBufferFirstLine + this->logBufferLine;
+        if (slot >= this->logBufferMaxLines) slot -= this->logBufferMaxLines;
+      }
+      this->logBufferNewline = c == 10;
+      if (c != 10) {
+        this->logBuffer[slot * this->logBufferChars + this->logLineLength[slot]++] = c;
+      }
+      return 1;
+    }
+
     bool maxLineNotReached = this->logBufferLine < this->logBufferMaxLines;
     bool bufferNotFull = this->logBufferFilled < this->logBufferSize;
 
-    // Can we write to the buffer?
-    if (bufferNotFull && maxLineNotReached) {
-      this->logBuffer[logBufferFilled] = c;
-      this->logBufferFilled++;
-      // Keep track of lines written
-      if (c == 10) this->logBufferLine++;
-    } else {
-      // Max line number is reached
-      if (!maxLineNotReached) this->logBufferLine--;
-
-      // Find the end of the first line
-      uint16_t firstLineEnd = 0;
-      for (uint16_t i=0;i<this->logBufferFilled;i++) {
-        if (this->logBuffer[i] == 10){
-          // Include last char too
-          firstLineEnd = i + 1;
-          break;
-        }
-      }
-      // If there was a line ending
-      if (firstLineEnd > 0) {
-        // Calculate the new logBufferFilled value
-        this->logBufferFilled = logBufferFilled - firstLineEnd;
-        // Now we move the lines infront of the buffer
-        memcpy(this->logBuffer, &this->logBuffer[firstLineEnd], logBufferFilled);
+    if (!(bufferNotFull && maxLineNotReached)) {
+      uint16_t dropped = this->logBufferFilled;
+      if (this->logBufferLine > 0) {
+        // Drop the first line and its \n
+        dropped = this->logLineLength[this->logBufferFirstLine] + 1;
+        if (++this->logBufferFirstLine == this->logBufferMaxLines + 1) this->logBufferFirstLine = 0;
+        this->logBufferLine--;
       } else {
         // Let's reuse the buffer if it was full
-        if (!bufferNotFull) {
-          this->logBufferFilled = 0;
-        }// else {
-        //  Nothing to do here
-        //}
+        this->logLineLength[this->logBufferFirstLine] = 0;
       }
-      write(c);
+      this->logBufferFilled -= dropped;
+      this->logBufferStart  += dropped;
+      if (this->logBufferStart >= this->logBufferSize) this->logBufferStart -= this->logBufferSize;
+      slot = this->logBufferFirstLine + this->logBufferLine;
+    }
+
+    uint16_t position = this->logBufferStart + this->logBufferFilled;
+    if (position >= this->logBufferSize) position -= this->logBufferSize;
+    this->logBuffer[position] = c;
+    this->logBufferFilled++;
+
+    if (c == 10) {
+      // Keep track of lines written
+      logNewLine();
+    } else {
+      this->logLineLength[slot > this->logBufferMaxLines ? slot - this->logBufferMaxLines - 1 : slot]++;
     }
   }
   // We are always writing all uint8_t to the buffer
@@ -743,148 +1499,334 @@ void OLEDDisplay::setGeometry(OLEDDISPLAY_GEOMETRY g) {
   } else if (g == GEOMETRY_128_32) {
     this->displayWidth                     = 128;
     this->displayHeight                    = 32;
+  } else if (g == GEOMETRY_64_48) {
+    this->displayWidth                     = 64;
+    this->displayHeight                    = 48;
+  } else if (g == GEOMETRY_96_16) {
+    this->displayWidth                     = 96;
+    this->displayHeight                    = 16;
   }
   this->displayBufferSize                = displayWidth*displayHeight/8;
 }
 
+void OLEDDisplay::sendCommands(const uint8_t *commands, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    sendCommand(commands[i]);
+  }
+}
+
 void OLEDDisplay::sendInitCommands(void) {
-  sendCommand(DISPLAYOFF);
-  sendCommand(SETDISPLAYCLOCKDIV);
-  sendCommand(0xF0); // Increase speed of the display max ~96Hz
-  sendCommand(SETMULTIPLEX);
-  sendCommand(this->height() - 1);
-  sendCommand(SETDISPLAYOFFSET);
-  sendCommand(0x00);
-  sendCommand(SETSTARTLINE);
-  sendCommand(CHARGEPUMP);
-  sendCommand(0x14);
-  sendCommand(MEMORYMODE);
-  sendCommand(0x00);
-  sendCommand(SEGREMAP);
-  sendCommand(COMSCANINC);
-  sendCommand(SETCOMPINS);
-
-  if (geometry == GEOMETRY_128_64) {
-    sendCommand(0x12);
-  } else if (geometry == GEOMETRY_128_32) {
-    sendCommand(0x02);
-  }
-
-  sendCommand(SETCONTRAST);
-
-  if (geometry == GEOMETRY_128_64) {
-    sendCommand(0xCF);
-  } else if (geometry == GEOMETRY_128_32) {
-    sendCommand(0x8F);
-  }
-
-  sendCommand(SETPRECHARGE);
-  sendCommand(0xF1);
-  sendCommand(SETVCOMDETECT); //0xDB, (additionally needed to lower the contrast)
-  sendCommand(0x40);	        //0x40 default, to lower the contrast, put 0
-  sendCommand(DISPLAYALLON_RESUME);
-  sendCommand(NORMALDISPLAY);
-  sendCommand(0x2e);            // stop scroll
-  sendCommand(DISPLAYON);
+  uint8_t comPins  = 0x12;
+  uint8_t contrast = 0xCF;
+  if (geometry == GEOMETRY_128_32) {
+    comPins  = 0x02;
+    contrast = 0x8F;
+  } else if (geometry == GEOMETRY_96_16) {
+    comPins  = 0x02;
+    contrast = 0xAF;
+  }
+
+  const uint8_t commands[] = {
+    DISPLAYOFF,
+    SETDISPLAYCLOCKDIV, 0xF0,     // Increase speed of the display max ~96Hz
+    SETMULTIPLEX, (uint8_t) (this->height() - 1),
+    SETDISPLAYOFFSET, 0x00,
+    SETSTARTLINE,
+    CHARGEPUMP, 0x14,
+    MEMORYMODE, 0x00,
+    SEGREMAP,
+    COMSCANINC,
+    SETCOMPINS, comPins,
+    SETCONTRAST, contrast,
+    SETPRECHARGE, 0xF1,
+    SETVCOMDETECT, 0x40,          //0xDB, 0x40 default, to lower the contrast, put 0
+    DISPLAYALLON_RESUME,
+    NORMALDISPLAY,
+    0x2e,                         // stop scroll
+    DISPLAYON
+  };
+  sendCommands(commands, sizeof(commands));
+}
+
+template<OLEDDISPLAY_COLOR color>
+static inline void blitPageByte(uint8_t *bufferPtr, uint8_t data) __attribute__((always_inline));
+
+template<> inline void blitPageByte<WHITE>(uint8_t *bufferPtr, uint8_t data)   { *bufferPtr |= data; }
+template<> inline void blitPageByte<BLACK>(uint8_t *bufferPtr, uint8_t data)   { *bufferPtr &= ~data; }
+template<> inline void blitPageByte<INVERSE>(uint8_t *bufferPtr, uint8_t data) { *bufferPtr ^= data; }
+
+// Inner loop of drawInternal, everything passed in is already clipped.
+// Each destination page gets the bits of source byte `r` shifted down by
+// yOffset combined with the carry of source byte `r - 1`, so every buffer
+// byte is touched exactly once.
+template<OLEDDISPLAY_COLOR color>
+static void blitColumns(uint8_t *bufferPtr, uint16_t bufferWidth, const uint8_t *data, uint16_t bytesInData,
+                        uint8_t rasterHeight, uint16_t firstColumn, uint16_t lastColumn,
+                        int16_t firstPage, int16_t fromPage, int16_t toPage, uint8_t yOffset) {
+  const uint8_t *columnData = data + firstColumn * rasterHeight;
+  uint16_t       remaining  = bytesInData - firstColumn * rasterHeight;
+
+  for (uint16_t column = firstColumn; column <= lastColumn; column++) {
+    uint8_t  columnBytes = remaining < rasterHeight ? remaining : rasterHeight;
+    int16_t  r           = fromPage - firstPage;
+    int16_t  lastPage    = firstPage + columnBytes - (yOffset ? 0 : 1);
+    uint8_t *pagePtr     = bufferPtr;
+    uint8_t  carry       = 0;
+
+    if (lastPage > toPage) lastPage = toPage;
+    if (r > 0 && r <= columnBytes) carry = pgm_read_byte(columnData + r - 1) >> (8 - yOffset);
+
+    for (int16_t page = fromPage; page <= lastPage; page++, r++) {
+      uint8_t currentByte = r < columnBytes ? pgm_read_byte(columnData + r) : 0;
+      blitPageByte<color>(pagePtr, (uint8_t) (currentByte << yOffset) | carry);
+      carry = currentByte >> (8 - yOffset);
+      pagePtr += bufferWidth;
+    }
+
+    columnData += rasterHeight;
+    remaining  -= columnBytes;
+    bufferPtr++;
+  }
 }
 
 void inline OLEDDisplay::drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *data, uint16_t offset, uint16_t bytesInData) {
-  if (width < 0 || height < 0) return;
+  if (width < 0 || height <= 0) return;
   if (yMove + height < 0 || yMove > this->height())  return;
   if (xMove + width  < 0 || xMove > this->width())   return;
 
   uint8_t  rasterHeight = 1 + ((height - 1) >> 3); // fast ceil(height / 8.0)
-  int8_t   yOffset      = yMove & 7;
+  uint8_t  yOffset      = yMove & 7;
+  int16_t  firstPage    = yMove >> 3;              // floors for negative yMove
 
   bytesInData = bytesInData == 0 ? width * rasterHeight : bytesInData;
 
-  int16_t initYMove   = yMove;
-  int8_t  initYOffset = yOffset;
+  // Clip the columns and pages once, the inner loop never checks bounds
+  int16_t columns     = (bytesInData + rasterHeight - 1) / rasterHeight;
+  int16_t firstColumn = xMove < 0 ? -xMove : 0;
+  int16_t lastColumn  = _min(columns, this->width() - xMove) - 1;
+  int16_t fromPage    = _max(firstPage, 0);
+  int16_t toPage      = this->height() / 8 - 1;
+
+  // The last page a glyph reaches, no column goes further
+  toPage = _min(toPage, firstPage + rasterHeight - (yOffset ? 0 : 1));
+
+  if (firstColumn > lastColumn || fromPage > toPage) return;
 
+  markPages(xMove + firstColumn, xMove + lastColumn, fromPage, toPage);
 
-  for (uint16_t i = 0; i < bytesInData; i++) {
+  uint8_t *bufferPtr = buffer + fromPage * this->width() + xMove + firstColumn;
+  data += offset;
+
+  switch (this->color) {
+    case WHITE:
+      blitColumns<WHITE>(bufferPtr, this->width(), data, bytesInData, rasterHeight, firstColumn, lastColumn, firstPage, fromPage, toPage, yOffset);
+      break;
+    case BLACK:
+      blitColumns<BLACK>(bufferPtr, this->width(), data, bytesInData, rasterHeight, firstColumn, lastColumn, firstPage, fromPage, toPage, yOffset);
+      break;
+    case INVERSE:
+      blitColumns<INVERSE>(bufferPtr, this->width(), data, bytesInData, rasterHeight, firstColumn, lastColumn, firstPage, fromPage, toPage, yOffset);
+      break;
+  }
+}
 
-    // Reset if next horizontal drawing phase is started.
-    if ( i % rasterHeight == 0) {
-      yMove   = initYMove;
-      yOffset = initYOffset;
+// Inner loop of drawPackedGlyph, the same walk as blitColumns over
+// columns that are read `rows` bits at a time from a continuous bit
+// stream. Clipped pages are still decoded to keep the stream in step.
+template<OLEDDISPLAY_COLOR color>
+static void blitPackedColumns(uint8_t *bufferPtr, uint16_t bufferWidth, const uint8_t *data, uint8_t rows,
+                              uint16_t firstColumn, uint16_t lastColumn,
+                              int16_t firstPage, int16_t fromPage, int16_t toPage, uint8_t yOffset) {
+  uint32_t bitPosition = (uint32_t) firstColumn * rows;
+  data += bitPosition >> 3;
+  uint32_t bits  = pgm_read_byte(data++) >> (bitPosition & 7);
+  uint8_t  count = 8 - (bitPosition & 7);
+
+  for (uint16_t column = firstColumn; column <= lastColumn; column++) {
+    uint8_t *pagePtr  = bufferPtr;
+    uint8_t  carry    = 0;
+    uint8_t  rowsLeft = rows;
+    int16_t  page     = firstPage;
+
+    for (; rowsLeft; page++) {
+      uint8_t n = rowsLeft < 8 ? rowsLeft : 8;
+      if (count < n) {
+        bits  |= (uint32_t) pgm_read_byte(data++) << count;
+        count += 8;
+      }
+      uint8_t currentByte = bits & (0xFF >> (8 - n));
+      bits     >>= n;
+      count     -= n;
+      rowsLeft  -= n;
+
+      if (page >= fromPage) {
+        if (page <= toPage) blitPageByte<color>(pagePtr, (uint8_t) (currentByte << yOffset) | carry);
+        pagePtr += bufferWidth;
+      }
+      carry = currentByte >> (8 - yOffset);
     }
+    if (carry && page >= fromPage && page <= toPage) blitPageByte<color>(pagePtr, carry);
 
-    byte currentByte = pgm_read_byte(data + offset + i);
+    bufferPtr++;
+  }
+}
 
-    int16_t xPos = xMove + (i / rasterHeight);
-    int16_t yPos = ((yMove >> 3) + (i % rasterHeight)) * this->width();
+void inline OLEDDisplay::drawPackedGlyph(int16_t xMove, int16_t yMove, const uint8_t *glyph) {
+  uint8_t topLeft = pgm_read_byte(glyph);
+  uint8_t rows    = pgm_read_byte(glyph + PACKED_GLYPH_ROWS);
+  int16_t columns = pgm_read_byte(glyph + PACKED_GLYPH_COLUMNS);
 
-//    int16_t yScreenPos = yMove + yOffset;
-    int16_t dataPos    = xPos  + yPos;
+  // Only the inked box is stored
+  xMove += topLeft >> 6;
+  yMove += topLeft & 0x3F;
 
-    if (dataPos >=  0  && dataPos < displayBufferSize &&
-        xPos    >=  0  && xPos    < this->width() ) {
+  if (rows == 0) return;
+  if (yMove + rows < 0 || yMove >= this->height())  return;
+  if (xMove + columns < 0 || xMove >= this->width()) return;
 
-      if (yOffset >= 0) {
-        switch (this->color) {
-          case WHITE:   buffer[dataPos] |= currentByte << yOffset; break;
-          case BLACK:   buffer[dataPos] &= ~(currentByte << yOffset); break;
-          case INVERSE: buffer[dataPos] ^= currentByte << yOffset; break;
-        }
+  uint8_t  yOffset   = yMove & 7;
+  int16_t  firstPage = yMove >> 3;
 
-        if (dataPos < (displayBufferSize - this->width())) {
-          switch (this->color) {
-            case WHITE:   buffer[dataPos + this->width()] |= currentByte >> (8 - yOffset); break;
-            case BLACK:   buffer[dataPos + this->width()] &= ~(currentByte >> (8 - yOffset)); break;
-            case INVERSE: buffer[dataPos + this->width()] ^= currentByte >> (8 - yOffset); break;
-          }
-        }
-      } else {
-        // Make new offset position
-        yOffset = -yOffset;
+  int16_t firstColumn = xMove < 0 ? -xMove : 0;
+  int16_t lastColumn  = _min(columns, this->width() - xMove) - 1;
+  int16_t fromPage    = _max(firstPage, 0);
+  int16_t toPage      = _min(this->height() / 8 - 1, (yMove + rows - 1) >> 3);
 
-        switch (this->color) {
-          case WHITE:   buffer[dataPos] |= currentByte >> yOffset; break;
-          case BLACK:   buffer[dataPos] &= ~(currentByte >> yOffset); break;
-          case INVERSE: buffer[dataPos] ^= currentByte >> yOffset; break;
-        }
+  if (firstColumn > lastColumn || fromPage > toPage) return;
 
-        // Prepare for next iteration by moving one block up
-        yMove -= 8;
+  markPages(xMove + firstColumn, xMove + lastColumn, fromPage, toPage);
 
-        // and setting the new yOffset
-        yOffset = 8 - yOffset;
-      }
+  uint8_t *bufferPtr = buffer + fromPage * this->width() + xMove + firstColumn;
+  glyph += PACKED_GLYPH_START;
 
-      yield();
-    }
+  switch (this->color) {
+    case WHITE:
+      blitPackedColumns<WHITE>(bufferPtr, this->width(), glyph, rows, firstColumn, lastColumn, firstPage, fromPage, toPage, yOffset);
+      break;
+    case BLACK:
+      blitPackedColumns<BLACK>(bufferPtr, this->width(), glyph, rows, firstColumn, lastColumn, firstPage, fromPage, toPage, yOffset);
+      break;
+    case INVERSE:
+      blitPackedColumns<INVERSE>(bufferPtr, this->width(), glyph, rows, firstColumn, lastColumn, firstPage, fromPage, toPage, yOffset);
+      break;
   }
 }
 
-// You need to free the char!
-char* OLEDDisplay::utf8ascii(String str) {
-  uint16_t k = 0;
-  uint16_t length = str.length() + 1;
+// Masked and opaque sprite bytes, `image` has no bits outside `mask`
+template<OLEDDISPLAY_COLOR color>
+static inline void blitMaskedByte(uint8_t *bufferPtr, uint8_t image, uint8_t mask) __attribute__((always_inline));
 
-  // Copy the string into a char array
-  char* s = (char*) malloc(length * sizeof(char));
-  if(!s) {
-    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][utf8ascii] Can't allocate another char array. Drop support for UTF-8.\n");
-    return (char*) str.c_str();
-  }
-  str.toCharArray(s, length);
+template<> inline void blitMaskedByte<WHITE>(uint8_t *bufferPtr, uint8_t image, uint8_t mask)   { *bufferPtr = (*bufferPtr & ~mask) | image; }
+template<> inline void blitMaskedByte<BLACK>(uint8_t *bufferPtr, uint8_t image, uint8_t mask)   { *bufferPtr = (*bufferPtr | mask) ^ image; }
+template<> inline void blitMaskedByte<INVERSE>(uint8_t *bufferPtr, uint8_t image, uint8_t mask) { (void) mask; *bufferPtr ^= image; }
 
-  length--;
+// Mask of the rows of sprite page `page` inside a sprite `height` rows tall
+static inline uint8_t spritePageMask(int16_t page, uint8_t height) {
+  if (page < 0 || page >= (height + 7) >> 3) return 0;
+  return page == height >> 3 ? 0xFF >> (8 - (height & 7)) : 0xFF;
+}
+
+// Inner loop of drawSprite, everything passed in is already clipped. A
+// destination page takes sprite page `source` shifted down by yOffset and
+// the bits page `source - 1` shifts past its bottom, a page aligned sprite
+// maps every page onto one destination page byte for byte.
+template<OLEDDISPLAY_COLOR color, uint8_t flags>
+static void blitSpriteRows(uint8_t *bufferPtr, uint16_t bufferWidth, const uint8_t *data, uint16_t rowBytes,
+                           uint16_t count, uint8_t height, int16_t firstPage, int16_t fromPage, int16_t toPage, uint8_t yOffset) {
+  const uint8_t step  = flags & SPRITE_MASKED ? 2 : 1;
+  uint8_t       pages = (height + 7) >> 3;
+
+  for (int16_t page = fromPage; page <= toPage; page++, bufferPtr += bufferWidth) {
+    int16_t        source = page - firstPage;
+    const uint8_t *upper  = source < pages ? data + source * rowBytes : NULL;
+    const uint8_t *lower  = yOffset && source > 0 ? data + (source - 1) * rowBytes : NULL;
+    uint8_t       *dst    = bufferPtr;
+
+    // Opaque sprites cover the same rows in every column
+    uint8_t boxMask = (uint8_t) (spritePageMask(source, height) << yOffset);
+    if (yOffset) boxMask |= spritePageMask(source - 1, height) >> (8 - yOffset);
+
+    if ((flags & SPRITE_OPAQUE) && color == WHITE && boxMask == 0xFF && !lower) {
+      memcpy_P(dst, upper, count);
+      continue;
+    }
 
-  for (uint16_t i=0; i < length; i++) {
-    char c = (this->fontTableLookupFunction)(s[i]);
-    if (c!=0) {
-      s[k++]=c;
+    for (uint16_t i = 0; i < count; i++, dst++) {
+      uint8_t image = 0, mask = flags & SPRITE_MASKED ? 0 : boxMask;
+      if (upper) {
+        image = pgm_read_byte(upper) << yOffset;
+        if (flags & SPRITE_MASKED) mask = pgm_read_byte(upper + 1) << yOffset;
+        upper += step;
+      }
+      if (lower) {
+        image |= pgm_read_byte(lower) >> (8 - yOffset);
+        if (flags & SPRITE_MASKED) mask |= pgm_read_byte(lower + 1) >> (8 - yOffset);
+        lower += step;
+      }
+      if (flags & (SPRITE_MASKED | SPRITE_OPAQUE)) {
+        blitMaskedByte<color>(dst, image, mask);
+      } else {
+        blitPageByte<color>(dst, image);
+      }
     }
   }
+}
+
+template<OLEDDISPLAY_COLOR color>
+static void blitSprite(uint8_t flags, uint8_t *bufferPtr, uint16_t bufferWidth, const uint8_t *data, uint16_t rowBytes,
+                       uint16_t count, uint8_t height, int16_t firstPage, int16_t fromPage, int16_t toPage, uint8_t yOffset) {
+  if (flags & SPRITE_MASKED) {
+    blitSpriteRows<color, SPRITE_MASKED>(bufferPtr, bufferWidth, data, rowBytes, count, height, firstPage, fromPage, toPage, yOffset);
+  } else if (flags & SPRITE_OPAQUE) {
+    blitSpriteRows<color, SPRITE_OPAQUE>(bufferPtr, bufferWidth, data, rowBytes, count, height, firstPage, fromPage, toPage, yOffset);
+  } else {
+    blitSpriteRows<color, 0>(bufferPtr, bufferWidth, data, rowBytes, count, height, firstPage, fromPage, toPage, yOffset);
+  }
+}
+
+void OLEDDisplay::drawSprite(int16_t xMove, int16_t yMove, const uint8_t *sprite) {
+  int16_t width  = pgm_read_byte(sprite + SPRITE_WIDTH_POS);
+  uint8_t height = pgm_read_byte(sprite + SPRITE_HEIGHT_POS);
+  uint8_t flags  = pgm_read_byte(sprite + SPRITE_FLAGS_POS);
+
+  if (width == 0 || height == 0) return;
+  if (yMove + height <= 0 || yMove >= this->height()) return;
+  if (xMove + width  <= 0 || xMove >= this->width())  return;
 
-  s[k]=0;
+  uint8_t  yOffset   = yMove & 7;
+  int16_t  firstPage = yMove >> 3;
+  uint16_t rowBytes  = width * (flags & SPRITE_MASKED ? 2 : 1);
 
-  // This will leak 's' be sure to free it in the calling function.
-  return s;
+  int16_t firstColumn = xMove < 0 ? -xMove : 0;
+  int16_t lastColumn  = _min(width, this->width() - xMove) - 1;
+  int16_t fromPage    = _max(firstPage, 0);
+  int16_t toPage      = _min(this->height() / 8 - 1, (yMove + height - 1) >> 3);
+
+  markPages(xMove + firstColumn, xMove + lastColumn, fromPage, toPage);
+
+  uint8_t       *bufferPtr = buffer + fromPage * this->width() + xMove + firstColumn;
+  const uint8_t *data      = sprite + SPRITE_DATA_START + firstColumn * (rowBytes / width);
+  uint16_t       count     = lastColumn - firstColumn + 1;
+
+  switch (this->color) {
+    case WHITE:
+      blitSprite<WHITE>(flags, bufferPtr, this->width(), data, rowBytes, count, height, firstPage, fromPage, toPage, yOffset);
+      break;
+    case BLACK:
+      blitSprite<BLACK>(flags, bufferPtr, this->width(), data, rowBytes, count, height, firstPage, fromPage, toPage, yOffset);
+      break;
+    case INVERSE:
+      blitSprite<INVERSE>(flags, bufferPtr, this->width(), data, rowBytes, count, height, firstPage, fromPage, toPage, yOffset);
+      break;
+  }
 }
 
+// You need to free the char!
 void OLEDDisplay::setFontTableLookupFunction(FontTableLookupFunction function) {
+  if (this->fontTableLookupFunction == function) return;
   this->fontTableLookupFunction = function;
+  #ifdef OLEDDISPLAY_FONT_CACHE
+  // Cached line breaks were measured with the glyphs the old function picked
+  for (uint8_t i = 0; i < OLEDDISPLAY_LAYOUT_CACHE_SIZE; i++) this->layouts[i].fontData = NULL;
+  #endif
 }
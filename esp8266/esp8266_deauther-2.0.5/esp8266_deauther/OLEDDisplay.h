@@ -40,11 +40,42 @@
 #define DEBUG_OLEDDISPLAY(...)
 #endif
 
-// Use DOUBLE BUFFERING by default
-#ifndef OLEDDISPLAY_REDUCE_MEMORY
+// Use DOUBLE BUFFERING by default. OLEDDISPLAY_CHECKSUM_BUFFER keeps a
+// checksum of every block of columns instead of the 1 KB back buffer.
+#if !defined(OLEDDISPLAY_REDUCE_MEMORY) && !defined(OLEDDISPLAY_CHECKSUM_BUFFER)
 #define OLEDDISPLAY_DOUBLE_BUFFER
 #endif
 
+// Both let display() send only what changed
+#if defined(OLEDDISPLAY_DOUBLE_BUFFER) || defined(OLEDDISPLAY_CHECKSUM_BUFFER)
+#define OLEDDISPLAY_PARTIAL_UPDATE
+#endif
+
+// Columns covered by one checksum, 16 takes 128 bytes for 128x64
+#ifndef OLEDDISPLAY_CHECKSUM_BLOCK
+#define OLEDDISPLAY_CHECKSUM_BLOCK 16
+#endif
+
+// Pages of the tallest geometry, sizes the dirty tracking of each page
+#define OLEDDISPLAY_MAX_PAGES 8
+
+// Keep the metrics of the current font and the layout of recently
+// wrapped strings in RAM by default
+#ifndef OLEDDISPLAY_REDUCE_MEMORY
+#define OLEDDISPLAY_FONT_CACHE
+#endif
+
+// Wrapped strings are recognised by font, width, length and a 32-bit hash
+// of the text, which is not kept. Two different strings of the same length
+// with the same hash share their line breaks.
+#ifndef OLEDDISPLAY_LAYOUT_CACHE_SIZE
+#define OLEDDISPLAY_LAYOUT_CACHE_SIZE 4
+#endif
+
+#ifndef OLEDDISPLAY_LAYOUT_MAX_LINES
+#define OLEDDISPLAY_LAYOUT_MAX_LINES 6
+#endif
+
 // Header Values
 #define JUMPTABLE_BYTES 4
 
@@ -58,6 +89,32 @@
 #define FIRST_CHAR_POS 2
 #define CHAR_NUM_POS 3
 
+// Packed fonts (extras/host/fontconvert) set FONT_PACKED in the width byte.
+// The header is followed by 2 bytes per char, the advance and the bytes of
+// glyph data (0 if the char isn't drawable), then the glyph data: top row
+// and left margin (top | left << 6), rows and columns of the inked box,
+// followed by its columns, `rows` bits each, LSB first and without padding.
+#define FONT_PACKED 0x80
+
+#define PACKED_TABLE_BYTES   2
+#define PACKED_TABLE_SIZE    1
+#define PACKED_GLYPH_ROWS    1
+#define PACKED_GLYPH_COLUMNS 2
+#define PACKED_GLYPH_START   3
+
+// Sprites (extras/host/spriteconvert) are stored in the page layout of the
+// buffer: width, height and flags, then `width` bytes for every page of the
+// sprite, top page first. SPRITE_MASKED sprites have a mask byte after
+// every image byte and only draw the pixels set in it, SPRITE_OPAQUE ones
+// draw every pixel of their box. Image bits outside the mask are 0.
+#define SPRITE_WIDTH_POS  0
+#define SPRITE_HEIGHT_POS 1
+#define SPRITE_FLAGS_POS  2
+#define SPRITE_DATA_START 3
+
+#define SPRITE_MASKED 0x01
+#define SPRITE_OPAQUE 0x02
+
 
 // Display commands
 #define CHARGEPUMP 0x8D
@@ -107,11 +164,78 @@ enum OLEDDISPLAY_TEXT_ALIGNMENT {
 
 enum OLEDDISPLAY_GEOMETRY {
   GEOMETRY_128_64   = 0,
-  GEOMETRY_128_32   = 1
+  GEOMETRY_128_32   = 1,
+  GEOMETRY_64_48    = 2,
+  GEOMETRY_96_16    = 3
+};
+
+// Where the text functions read their characters from
+enum OLEDDISPLAY_TEXT_SOURCE {
+  TEXT_SOURCE_RAM = 0,         // UTF-8 in RAM
+  TEXT_SOURCE_FLASH = 1,       // UTF-8 in flash (PROGMEM)
+  TEXT_SOURCE_FONT_TABLE = 2   // Font table indexes in RAM, like the log buffer
+};
+
+enum OLEDDISPLAY_LOG_MODE {
+  LOG_LINES = 0,   // Lines share lines * chars bytes, long ones run off the screen
+  LOG_CELLS = 1    // lines rows of chars cells as wide as the widest glyph, long lines wrap
+};
+
+enum OLEDDISPLAY_CONTROLLER {
+  CONTROLLER_SSD1306 = 0,   // Windows set by COLUMNADDR and PAGEADDR
+  CONTROLLER_SH1106  = 1    // 132 columns, every page addressed on its own
 };
 
 typedef byte (*FontTableLookupFunction)(const byte ch);
 
+class OLEDDisplay;
+class OLEDDisplayGroup;
+
+// Called once an incremental flush has sent its last page
+typedef void (*FlushCallback)(OLEDDisplay *display);
+
+// Columns [from, to] of one page, empty if from > to
+struct OLEDDisplaySpan {
+  uint8_t from;
+  uint8_t to;
+};
+
+// Columns fromX..toX of pages fromPage..toPage, sent to the display in one go
+struct OLEDDisplayWindow {
+  uint8_t fromX;
+  uint8_t toX;
+  uint8_t fromPage;
+  uint8_t toPage;
+};
+
+// Span of every screen row a shape fill covers, rows first..last are set
+// and empty where from > to
+struct OLEDDisplayRows {
+  int16_t from[OLEDDISPLAY_MAX_PAGES * 8];
+  int16_t to[OLEDDISPLAY_MAX_PAGES * 8];
+  uint8_t first;
+  uint8_t last;
+};
+
+// Jump table entry of one character, decoded to RAM by the font cache
+struct OLEDDisplayGlyph {
+  uint16_t dataPosition;   // Offset of the glyph data in the font, 0 if the char isn't drawable
+  uint8_t  size;           // Bytes of glyph data
+  uint8_t  width;          // Advance in pixels
+};
+
+// Line breaks drawStringMaxWidth computed for one string
+struct OLEDDisplayTextLayout {
+  const uint8_t *fontData;
+  uint32_t       hash;
+  uint16_t       length;
+  uint16_t       maxLineWidth;
+  uint8_t        lines;
+  uint16_t       lineStart[OLEDDISPLAY_LAYOUT_MAX_LINES];
+  uint16_t       lineLength[OLEDDISPLAY_LAYOUT_MAX_LINES];
+  uint16_t       lineWidth[OLEDDISPLAY_LAYOUT_MAX_LINES];
+};
+
 
 class OLEDDisplay : public Print {
 
@@ -158,6 +282,14 @@ class OLEDDisplay : public Print {
     // Fill circle
     void fillCircle(int16_t x, int16_t y, int16_t radius);
 
+    // Fill a rectangle with its corners rounded to radius
+    void fillRoundRect(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius);
+
+    // Fill the ring between innerRadius and radius from startAngle clockwise
+    // to endAngle, in degrees clockwise from 12 o'clock. An innerRadius of 0
+    // fills a pie slice. Made for gauges, the angles can be negative.
+    void fillArc(int16_t x, int16_t y, int16_t radius, int16_t innerRadius, int16_t startAngle, int16_t endAngle);
+
     // Draw a line horizontally
     void drawHorizontalLine(int16_t x, int16_t y, int16_t length);
 
@@ -174,22 +306,37 @@ class OLEDDisplay : public Print {
     // Draw a XBM
     void drawXbm(int16_t x, int16_t y, int16_t width, int16_t height, const uint8_t *xbm);
 
+    // Draw a sprite made by extras/host/spriteconvert. Without a mask the
+    // set pixels are drawn in the current color, masked and opaque sprites
+    // replace the pixels they cover: with the image for WHITE, the inverted
+    // image for BLACK. INVERSE flips the set pixels in every case.
+    void drawSprite(int16_t x, int16_t y, const uint8_t *sprite);
+
     /* Text functions */
 
-    // Draws a string at the given location
-    void drawString(int16_t x, int16_t y, String text);
+    // Draws a string at the given location. The text is UTF-8 and is
+    // converted to the font table while drawing, without copying it
+    void drawString(int16_t x, int16_t y, const char* text);
+    void drawString(int16_t x, int16_t y, const char* text, uint16_t length);
+    void drawString(int16_t x, int16_t y, const __FlashStringHelper* text);
+    void drawString(int16_t x, int16_t y, const String &text);
 
     // Draws a String with a maximum width at the given location.
     // If the given String is wider than the specified width
     // The text will be wrapped to the next line at a space or dash
-    void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, String text);
+    void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const char* text);
+    void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const char* text, uint16_t length);
+    void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const __FlashStringHelper* text);
+    void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const String &text);
 
     // Returns the width of the const char* with the current
     // font settings
     uint16_t getStringWidth(const char* text, uint16_t length);
 
-    // Convencience method for the const char version
-    uint16_t getStringWidth(String text);
+    // Convencience methods for the const char version
+    uint16_t getStringWidth(const char* text);
+    uint16_t getStringWidth(const __FlashStringHelper* text);
+    uint16_t getStringWidth(const String &text);
 
     // Specifies relative to which anchor point
     // the text is rendered. Available constants:
@@ -234,6 +381,11 @@ class OLEDDisplay : public Print {
     // Mirror the display (to be used in a mirror or as a projector)
     void mirrorScreen();
 
+    // Show controller RAM row `line` at the top of the screen, which moves
+    // the whole picture up by `line` rows and wraps it around. Only for
+    // screens as tall as the 64 rows of RAM, returns false on the others.
+    bool setStartLine(uint8_t line);
+
     // Write the buffer to the display memory
     virtual void display(void) = 0;
 
@@ -244,12 +396,35 @@ class OLEDDisplay : public Print {
 
     // This will define the lines and characters you can
     // print to the screen. When you exeed the buffer size (lines * chars)
-    // the output may be truncated due to the size constraint.
-    bool setLogBuffer(uint16_t lines, uint16_t chars);
+    // the output may be truncated due to the size constraint. Printing
+    // takes constant time per char however many lines scroll away.
+    // LOG_CELLS draws the chars on a fixed grid, like a terminal.
+    bool setLogBuffer(uint16_t lines, uint16_t chars, OLEDDISPLAY_LOG_MODE mode = LOG_LINES);
 
     // Draw the log buffer at position (x, y)
     void drawLogBuffer(uint16_t x, uint16_t y);
 
+    // Tell display() what changed after writing to `buffer` directly,
+    // the whole frame if no area is given
+    void markDirty(int16_t x, int16_t y, int16_t width, int16_t height);
+    void markDirty(void);
+
+    // Cover the `changed` column spans of `pages` pages with the windows that
+    // are cheapest to send, given what opening a window and addressing each
+    // of its pages costs in data bytes. Returns the number of `windows`.
+    static uint8_t planFlush(const OLEDDisplaySpan *changed, uint8_t pages, uint16_t windowCost, uint16_t pageCost, OLEDDisplayWindow *windows);
+
+    // Incremental flush, for loops that can't wait for display(). beginFlush()
+    // takes the changes since the last flush and returns false if one is
+    // still running. flushStep() sends as many pages as fit in budgetMicros,
+    // at least one, and returns true once all are sent, calling `callback`.
+    // Drawing during a flush doesn't touch the pages in transit, it is sent
+    // by the next one (with OLEDDISPLAY_CHECKSUM_BUFFER pages go out as they
+    // are when their turn comes). display() completes a running flush first.
+    bool beginFlush(FlushCallback callback = NULL);
+    bool flushStep(uint32_t budgetMicros);
+    bool isFlushing(void);
+
     // Get screen geometry
     uint16_t getWidth(void);
     uint16_t getHeight(void);
@@ -265,6 +440,7 @@ class OLEDDisplay : public Print {
     #endif
 
   protected:
+    friend class OLEDDisplayGroup;
 
     OLEDDISPLAY_GEOMETRY geometry              = GEOMETRY_128_64;
 
@@ -272,36 +448,163 @@ class OLEDDisplay : public Print {
     uint16_t  displayHeight                    = 64;
     uint16_t  displayBufferSize                = 1024;
 
+    // False while an OLEDDisplayGroup provides buffer and buffer_back
+    bool      ownsBuffers                      = true;
+
     // Set the correct height, width and buffer for the geometry
     void setGeometry(OLEDDISPLAY_GEOMETRY g);
 
+    #ifdef OLEDDISPLAY_PARTIAL_UPDATE
+    // Columns of every page drawn to since the last clear(), and the ones
+    // clear() erased that display() hasn't compared yet
+    OLEDDisplaySpan  inked[OLEDDISPLAY_MAX_PAGES] = {};
+    OLEDDisplaySpan  dirty[OLEDDISPLAY_MAX_PAGES] = {};
+    bool             inkedSinceDisplay = false;
+
+    #ifdef OLEDDISPLAY_CHECKSUM_BUFFER
+    // CRC of every OLEDDISPLAY_CHECKSUM_BLOCK columns of a page as last sent,
+    // meaningless until the first display() after resetDisplay()
+    uint16_t         checksums[OLEDDISPLAY_MAX_PAGES][(128 + OLEDDISPLAY_CHECKSUM_BLOCK - 1) / OLEDDISPLAY_CHECKSUM_BLOCK];
+    bool             checksumsValid = false;
+
+    // Sum up the blocks covering columns x0..x1 of `page` again, true if
+    // any of them changed
+    bool updateChecksums(uint8_t page, uint8_t x0, uint8_t x1, OLEDDisplaySpan &changed);
+    #endif
+
+    // Compare the dirty parts of buffer with what was sent last, remember
+    // them as sent and get the columns that changed on every page, false if
+    // nothing did. With double buffering they are copied to buffer_back.
+    bool updateBackBuffer(OLEDDisplaySpan *changed);
+
+    // Windows of the running incremental flush and the next page to send
+    OLEDDisplayWindow  flushWindows[OLEDDISPLAY_MAX_PAGES];
+    uint8_t            flushWindowCount = 0;
+    uint8_t            flushWindow      = 0;
+    uint8_t            flushPage        = 0;
+
+    // Average time sending a page took, to stop before a step overruns
+    uint32_t           flushPageMicros  = 0;
+    FlushCallback      flushCallback    = NULL;
+    #endif
+
+    // Pick the windows display() sends for the `changed` spans, drivers
+    // override it with the costs of their bus, see planFlush()
+    virtual uint8_t planWindows(const OLEDDisplaySpan *changed, OLEDDisplayWindow *windows);
+
+    // Send page `page` of `window`, its bytes starting at `row`, addressing
+    // the window first if needed. Drivers that implement it return true from
+    // canFlushIncrementally(), for the others beginFlush() calls display().
+    virtual void sendWindowPage(const OLEDDisplayWindow &window, uint8_t page, const uint8_t *row) {(void)window; (void)page; (void)row;};
+    virtual bool canFlushIncrementally(void) { return false; };
+
+    // Record a write to columns x0..x1 of pages firstPage..lastPage, all on screen
+    void inline markPages(uint8_t x0, uint8_t x1, uint8_t firstPage, uint8_t lastPage) __attribute__((always_inline));
+
+    // Bodies of the primitives that depend on the geometry. They are always
+    // inlined, so the constant width and height of OLEDDisplayT fold in.
+    void inline setPixelIn(uint16_t bufferWidth, uint16_t bufferHeight, int16_t x, int16_t y) __attribute__((always_inline));
+    void inline fillRectIn(uint16_t bufferWidth, uint16_t bufferHeight, int16_t xMove, int16_t yMove, int16_t width, int16_t height) __attribute__((always_inline));
+    void inline drawHorizontalLineIn(uint16_t bufferWidth, uint16_t bufferHeight, int16_t x, int16_t y, int16_t length) __attribute__((always_inline));
+
+    // Shape fills collect the span of every row they cover with addRowSpan(),
+    // merged with the span the row has, so overlapping parts are drawn once.
+    // fillRows() writes them, rows of a page with the same span in one go.
+    void inline beginRows(OLEDDisplayRows &rows) { rows.first = UINT8_MAX; rows.last = 0; };
+    void inline addRowSpan(OLEDDisplayRows &rows, int32_t row, int32_t from, int32_t to);
+    void fillRows(const OLEDDisplayRows &rows);
+
+    // Spans of fillCircle()
+    void addCircleRows(OLEDDisplayRows &rows, int16_t x, int16_t y, int16_t radius);
+
+    // One quadrant of fillArc(), startAngle < endAngle in the same quadrant.
+    // `ring` holds the columns right of x the ring covers on every row.
+    void fillArcQuadrant(int16_t x, int16_t y, const OLEDDisplayRows &ring, int16_t startAngle, int16_t endAngle);
+
     OLEDDISPLAY_TEXT_ALIGNMENT   textAlignment = TEXT_ALIGN_LEFT;
     OLEDDISPLAY_COLOR            color         = WHITE;
 
     const uint8_t          *fontData     = ArialMT_Plain_10;
 
-    // State values for logBuffer
+    #ifdef OLEDDISPLAY_FONT_CACHE
+    // Decoded jump table of glyphFont, rebuilt when the font changes in
+    // an allocation that only grows, glyphCapacity entries long
+    const uint8_t          *glyphFont    = NULL;
+    OLEDDisplayGlyph       *glyphs       = NULL;
+    uint8_t                 glyphFirstChar = 0;
+    uint8_t                 glyphCount   = 0;
+    uint8_t                 glyphCapacity = 0;
+
+    OLEDDisplayTextLayout   layouts[OLEDDISPLAY_LAYOUT_CACHE_SIZE] = {};
+    uint8_t                 nextLayout   = 0;
+    #endif
+
+    // State values for logBuffer. LOG_LINES keeps a ring of logBufferSize
+    // chars holding logBufferLine + 1 lines from logBufferStart on, each
+    // but the last one followed by its \n. LOG_CELLS keeps a ring of
+    // logBufferMaxLines rows of logBufferChars cells. logLineLength holds
+    // the chars of every line, from logBufferFirstLine on. logBufferLastByte
+    // is the byte write() fed the font table lookup function last.
+    OLEDDISPLAY_LOG_MODE logBufferMode         = LOG_LINES;
     uint16_t   logBufferSize                   = 0;
+    uint16_t   logBufferChars                  = 0;
     uint16_t   logBufferFilled                 = 0;
+    uint16_t   logBufferStart                  = 0;
     uint16_t   logBufferLine                   = 0;
+    uint16_t   logBufferFirstLine              = 0;
     uint16_t   logBufferMaxLines               = 0;
+    bool       logBufferNewline                = false;
+    uint8_t    logBufferLastByte               = 0;
+    uint16_t  *logLineLength                   = NULL;
     char      *logBuffer                       = NULL;
 
     // Send a command to the display (low level function)
     virtual void sendCommand(uint8_t com) {(void)com;};
 
+    // Send several commands, drivers that can batch them override this
+    virtual void sendCommands(const uint8_t *commands, uint8_t count);
+
     // Connect to the display
     virtual bool connect() { return false; };
 
     // Send all the init commands
     void sendInitCommands();
 
-    // converts utf8 characters to extended ascii
-    char* utf8ascii(String s);
+    // Copy the jump table of the current font to RAM if it isn't there yet
+    void loadFontMetrics();
+
+    // Metrics of the font table entry `code`, false if the font can't draw it
+    bool inline getGlyph(uint8_t code, OLEDDisplayGlyph &glyph) __attribute__((always_inline));
+
+    // Advance of the font table entry `code`, 0 if the font doesn't have it
+    uint8_t inline getCharWidth(uint8_t code) __attribute__((always_inline));
+
+    // Apply the current color to `length` buffer bytes using the bits in `mask`
+    void inline fillSpan(uint8_t *bufferPtr, uint16_t length, uint8_t mask) __attribute__((always_inline));
 
     void inline drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *data, uint16_t offset, uint16_t bytesInData) __attribute__((always_inline));
 
-    void drawStringInternal(int16_t xMove, int16_t yMove, char* text, uint16_t textLength, uint16_t textWidth);
+    // Draw the glyph data of a packed font at the position of its cell
+    void inline drawPackedGlyph(int16_t xMove, int16_t yMove, const uint8_t *glyph) __attribute__((always_inline));
+
+    // Font table index of the char starting at byte `i` of `text`, 0 if it
+    // has to be skipped. Moves `i` past all bytes of the char.
+    uint8_t inline readChar(const char* text, uint16_t &i, uint16_t length, OLEDDISPLAY_TEXT_SOURCE source) __attribute__((always_inline));
+
+    // Draw the glyph of font table entry `code` in a cell at (xMove, yMove),
+    // returns its advance
+    uint8_t inline drawGlyph(int16_t xMove, int16_t yMove, uint8_t code, uint8_t textHeight, bool packed) __attribute__((always_inline));
+
+    void drawStringInternal(int16_t xMove, int16_t yMove, const char* text, uint16_t textLength, uint16_t textWidth, OLEDDISPLAY_TEXT_SOURCE source);
+
+    // Start a new line in the log buffer, dropping the oldest if it's full
+    void logNewLine(void);
+
+    void drawStringLinesInternal(int16_t xMove, int16_t yMove, const char* text, uint16_t length, OLEDDISPLAY_TEXT_SOURCE source);
+
+    void drawStringMaxWidthInternal(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const char* text, uint16_t length, OLEDDISPLAY_TEXT_SOURCE source);
+
+    uint16_t getStringWidthInternal(const char* text, uint16_t length, OLEDDISPLAY_TEXT_SOURCE source);
 
     // UTF-8 to font table index converter
     // Code form http://playground.arduino.cc/Main/Utf8ascii
@@ -326,4 +629,133 @@ class OLEDDisplay : public Print {
     };
 };
 
+void inline OLEDDisplay::markPages(uint8_t x0, uint8_t x1, uint8_t firstPage, uint8_t lastPage) {
+  #ifdef OLEDDISPLAY_PARTIAL_UPDATE
+  for (uint8_t page = firstPage; page <= lastPage; page++) {
+    if (x0 < inked[page].from) inked[page].from = x0;
+    if (x1 > inked[page].to)   inked[page].to   = x1;
+  }
+  inkedSinceDisplay = true;
+  #endif
+}
+
+void inline OLEDDisplay::fillSpan(uint8_t *bufferPtr, uint16_t length, uint8_t mask) {
+  switch (color) {
+    case WHITE:
+      if (mask == 0xFF) {
+        memset(bufferPtr, 0xFF, length);
+      } else {
+        while (length--) *bufferPtr++ |= mask;
+      }
+      break;
+    case BLACK:
+      if (mask == 0xFF) {
+        memset(bufferPtr, 0x00, length);
+      } else {
+        mask = ~mask;
+        while (length--) *bufferPtr++ &= mask;
+      }
+      break;
+    case INVERSE:
+      while (length--) *bufferPtr++ ^= mask;
+      break;
+  }
+}
+
+void inline OLEDDisplay::addRowSpan(OLEDDisplayRows &rows, int32_t row, int32_t from, int32_t to) {
+  if (row < 0 || row >= this->height()) return;
+  if (from < 0) from = 0;
+  if (to >= this->width()) to = this->width() - 1;
+  if (from > to) return;
+
+  if (rows.first > rows.last) {
+    rows.first = rows.last = row;
+    rows.from[row] = from;
+    rows.to[row]   = to;
+    return;
+  }
+  // Rows newly between first and last start empty
+  while (row < rows.first) {
+    rows.first--;
+    rows.from[rows.first] = 1;
+    rows.to[rows.first]   = 0;
+  }
+  while (row > rows.last) {
+    rows.last++;
+    rows.from[rows.last] = 1;
+    rows.to[rows.last]   = 0;
+  }
+  if (rows.from[row] > rows.to[row]) {
+    rows.from[row] = from;
+    rows.to[row]   = to;
+  } else {
+    if (from < rows.from[row]) rows.from[row] = from;
+    if (to > rows.to[row])     rows.to[row]   = to;
+  }
+}
+
+void inline OLEDDisplay::setPixelIn(uint16_t bufferWidth, uint16_t bufferHeight, int16_t x, int16_t y) {
+  if (x >= 0 && x < bufferWidth && y >= 0 && y < bufferHeight) {
+    markPages(x, x, y >> 3, y >> 3);
+    switch (color) {
+      case WHITE:   buffer[x + (y / 8) * bufferWidth] |=  (1 << (y & 7)); break;
+      case BLACK:   buffer[x + (y / 8) * bufferWidth] &= ~(1 << (y & 7)); break;
+      case INVERSE: buffer[x + (y / 8) * bufferWidth] ^=  (1 << (y & 7)); break;
+    }
+  }
+}
+
+void inline OLEDDisplay::fillRectIn(uint16_t bufferWidth, uint16_t bufferHeight, int16_t xMove, int16_t yMove, int16_t width, int16_t height) {
+  // Clip to the screen, in 32 bit to not overflow on huge rectangles
+  int32_t x0 = xMove, y0 = yMove;
+  int32_t x1 = x0 + width, y1 = y0 + height;
+
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 > bufferWidth)  x1 = bufferWidth;
+  if (y1 > bufferHeight) y1 = bufferHeight;
+
+  if (x0 >= x1 || y0 >= y1) return;
+
+  uint8_t  firstPage  = y0 >> 3;
+  uint8_t  lastPage   = (y1 - 1) >> 3;
+  uint8_t  topMask    = 0xFF << (y0 & 7);
+  uint8_t  bottomMask = 0xFF >> (7 - ((y1 - 1) & 7));
+  uint16_t length     = x1 - x0;
+
+  markPages(x0, x1 - 1, firstPage, lastPage);
+
+  uint8_t *bufferPtr = buffer + firstPage * bufferWidth + x0;
+
+  // Every page is one masked span over the same columns, only the first
+  // and the last page can be partial.
+  for (uint8_t page = firstPage; page <= lastPage; page++) {
+    uint8_t mask = 0xFF;
+    if (page == firstPage) mask &= topMask;
+    if (page == lastPage)  mask &= bottomMask;
+
+    fillSpan(bufferPtr, length, mask);
+    bufferPtr += bufferWidth;
+  }
+}
+
+void inline OLEDDisplay::drawHorizontalLineIn(uint16_t bufferWidth, uint16_t bufferHeight, int16_t x, int16_t y, int16_t length) {
+  if (y < 0 || y >= bufferHeight) { return; }
+
+  if (x < 0) {
+    length += x;
+    x = 0;
+  }
+
+  if ( (x + length) > bufferWidth) {
+    length = (bufferWidth - x);
+  }
+
+  if (length <= 0) { return; }
+
+  // A single row is a span in one page
+  markPages(x, x + length - 1, y >> 3, y >> 3);
+  fillSpan(buffer + (y >> 3) * bufferWidth + x, length, 1 << (y & 7));
+}
+
 #endif
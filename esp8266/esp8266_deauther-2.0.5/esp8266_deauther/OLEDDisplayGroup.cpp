@@ -0,0 +1,192 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+#include "OLEDDisplayGroup.h"
+
+OLEDDisplayGroup::OLEDDisplayGroup(bool shareBuffer) {
+  this->shareBuffer = shareBuffer;
+}
+
+OLEDDisplayGroup::~OLEDDisplayGroup() {
+  end();
+}
+
+bool OLEDDisplayGroup::add(OLEDDisplay *display) {
+  if (this->memory || this->displayCount >= OLEDDISPLAY_GROUP_MAX || display->buffer) {
+    return false;
+  }
+  this->displays[this->displayCount++] = display;
+  return true;
+}
+
+bool OLEDDisplayGroup::init() {
+  if (this->memory) return true;
+  if (this->displayCount == 0) return false;
+
+  uint16_t largest = 0;
+  uint32_t size    = 0;
+  for (uint8_t i = 0; i < this->displayCount; i++) {
+    uint16_t bufferSize = this->displays[i]->displayBufferSize;
+    largest = _max(largest, bufferSize);
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    size += bufferSize;
+    #endif
+    if (!this->shareBuffer) size += bufferSize;
+  }
+  if (this->shareBuffer) size += largest;
+
+  this->memory = (uint8_t*) malloc(size);
+  if (!this->memory) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][group] Not enough memory for the display buffers\n");
+    return false;
+  }
+  this->memorySize = size;
+
+  // The shared buffer first, then the ones of every display
+  uint8_t *next = this->memory;
+  if (this->shareBuffer) next += largest;
+  for (uint8_t i = 0; i < this->displayCount; i++) {
+    OLEDDisplay *display = this->displays[i];
+    uint16_t bufferSize = display->displayBufferSize;
+    display->ownsBuffers = false;
+    if (this->shareBuffer) {
+      display->buffer = this->memory;
+    } else {
+      display->buffer = next;
+      next += bufferSize;
+    }
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    display->buffer_back = next;
+    next += bufferSize;
+    #endif
+
+    if (!display->init()) {
+      end();
+      return false;
+    }
+  }
+
+  // Every init() left the shared buffer cleared, as the first display shows it
+  this->selected = 0;
+  this->nextStep = 0;
+  return true;
+}
+
+void OLEDDisplayGroup::end() {
+  if (!this->memory) return;
+  for (uint8_t i = 0; i < this->displayCount; i++) {
+    this->displays[i]->end();
+    this->displays[i]->ownsBuffers = true;
+  }
+  free(this->memory);
+  this->memory     = NULL;
+  this->memorySize = 0;
+}
+
+void OLEDDisplayGroup::startFlush(OLEDDisplay *display) {
+  if (!display->beginFlush()) {
+    while (!display->flushStep(UINT32_MAX));
+    display->beginFlush();
+  }
+}
+
+void OLEDDisplayGroup::select(OLEDDisplay *display) {
+  uint8_t next = 0;
+  while (next < this->displayCount && this->displays[next] != display) next++;
+  if (next == this->displayCount || next == this->selected) return;
+
+  if (this->memory && this->shareBuffer) {
+    OLEDDisplay *previous = this->displays[this->selected];
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    // The flush sends from the back buffer, the drawing buffer is free
+    // as soon as it started
+    startFlush(previous);
+    memcpy(display->buffer, display->buffer_back, display->displayBufferSize);
+    #else
+    previous->display();
+    display->clear();
+    #endif
+  }
+  this->selected = next;
+}
+
+OLEDDisplay* OLEDDisplayGroup::getSelected(void) {
+  return this->displayCount ? this->displays[this->selected] : NULL;
+}
+
+void OLEDDisplayGroup::beginFlush(void) {
+  if (!this->memory) return;
+  if (this->shareBuffer) {
+    startFlush(this->displays[this->selected]);
+    return;
+  }
+  for (uint8_t i = 0; i < this->displayCount; i++) {
+    startFlush(this->displays[i]);
+  }
+}
+
+bool OLEDDisplayGroup::flushStep(uint32_t budgetMicros) {
+  uint32_t start = micros();
+  bool     sent  = false;
+  for (;;) {
+    // The next display with pages left, taking turns
+    uint8_t i = 0;
+    while (i < this->displayCount && !this->displays[(this->nextStep + i) % this->displayCount]->isFlushing()) i++;
+    if (i == this->displayCount) return true;
+
+    OLEDDisplay *display = this->displays[(this->nextStep + i) % this->displayCount];
+    #ifdef OLEDDISPLAY_PARTIAL_UPDATE
+    if (sent && micros() - start + display->flushPageMicros >= budgetMicros) return false;
+    #else
+    (void) start; (void) budgetMicros;
+    #endif
+
+    // A budget of 0 sends one page
+    display->flushStep(0);
+    this->nextStep = (this->nextStep + i + 1) % this->displayCount;
+    sent = true;
+  }
+}
+
+bool OLEDDisplayGroup::isFlushing(void) {
+  for (uint8_t i = 0; i < this->displayCount; i++) {
+    if (this->displays[i]->isFlushing()) return true;
+  }
+  return false;
+}
+
+void OLEDDisplayGroup::display(void) {
+  beginFlush();
+  while (!flushStep(UINT32_MAX));
+}
+
+uint32_t OLEDDisplayGroup::getMemorySize(void) {
+  return this->memorySize;
+}
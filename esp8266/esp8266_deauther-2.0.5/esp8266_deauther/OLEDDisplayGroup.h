@@ -0,0 +1,118 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+#ifndef OLEDDISPLAYGROUP_h
+#define OLEDDISPLAYGROUP_h
+
+#include <Arduino.h>
+#include "OLEDDisplay.h"
+
+#ifndef OLEDDISPLAY_GROUP_MAX
+#define OLEDDISPLAY_GROUP_MAX 4
+#endif
+
+// Several displays with their buffers in one block of memory and their
+// incremental flushes sent in turns.
+//
+// By default the displays share one drawing buffer and only the selected
+// one may be drawn to. select() hands the buffer over: the flush of the
+// display that had it starts, then the next one gets its picture back
+// from its back buffer. Without OLEDDISPLAY_DOUBLE_BUFFER there is no such
+// copy, the next display starts from a cleared buffer and the flush of
+// the previous one is done before select() returns. Two 128x64 displays
+// then take 3 KB instead of 4 KB, or 1 KB instead of 2 KB.
+//
+//   OLEDDisplayGroup group;
+//   group.add(&display);
+//   group.add(&display2);
+//   group.init();
+//
+//   group.select(&display);
+//   display.drawString(0, 0, "one");
+//   group.select(&display2);
+//   display2.drawString(0, 0, "two");
+//   group.beginFlush();
+//   while (!group.flushStep(1000)) { /* other work */ }
+//
+// Displays on separate Wire pins need setI2cAutoInit(true), their pages
+// are sent in between each other.
+class OLEDDisplayGroup {
+  public:
+    // Without `shareBuffer` every display gets a drawing buffer of its own
+    OLEDDisplayGroup(bool shareBuffer = true);
+    ~OLEDDisplayGroup();
+
+    // Add a display that isn't initialized yet, false if it is or the
+    // group is full or initialized already
+    bool add(OLEDDisplay *display);
+
+    // Allocate the buffers of all displays in one block and initialize
+    // them, the first display is selected
+    bool init();
+
+    // End all displays and free the block
+    void end();
+
+    // Give the shared drawing buffer to `display`, see above. Without a
+    // shared buffer it only changes what beginFlush() sends.
+    void select(OLEDDisplay *display);
+    OLEDDisplay* getSelected(void);
+
+    // Start the incremental flush of what was drawn since the last one, on
+    // the selected display or, without a shared buffer, on all of them. A
+    // display whose flush is still running finishes it first.
+    void beginFlush(void);
+
+    // Send pages of the running flushes, one display after the other, as
+    // many as fit in budgetMicros and at least one. Returns true once
+    // none is left.
+    bool flushStep(uint32_t budgetMicros);
+    bool isFlushing(void);
+
+    // beginFlush() and send everything
+    void display(void);
+
+    // Bytes of the block holding the buffers
+    uint32_t getMemorySize(void);
+
+  private:
+    OLEDDisplay *displays[OLEDDISPLAY_GROUP_MAX];
+    uint8_t      displayCount = 0;
+    uint8_t      selected     = 0;
+    uint8_t      nextStep     = 0;
+    bool         shareBuffer;
+    uint8_t     *memory       = NULL;
+    uint32_t     memorySize   = 0;
+
+    // Start the flush of `display`, finishing a running one first
+    void startFlush(OLEDDisplay *display);
+};
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+#ifndef OLEDDisplayI2C_h
+#define OLEDDisplayI2C_h
+
+#include "OLEDDisplay.h"
+
+// Control bytes starting every I2C write to the SSD1306/SH1106. With the
+// continuation bit (0x80) set only the next byte is a command, without it
+// the rest of the write is a stream of commands or of display data.
+#define I2C_CONTROL_COMMAND   0x80
+#define I2C_CONTROL_COMMANDS  0x00
+#define I2C_CONTROL_DATA      0x40
+
+// Shared part of the I2C drivers. It batches commands into one write,
+// packs display data into writes as long as the bus library allows and
+// knows how to address a window on both controllers. The drivers only
+// implement the three bus functions below.
+class OLEDDisplayI2C : public OLEDDisplay {
+  public:
+    void display(void) {
+    #ifdef OLEDDISPLAY_PARTIAL_UPDATE
+       OLEDDisplaySpan   changed[OLEDDISPLAY_MAX_PAGES];
+       OLEDDisplayWindow windows[OLEDDISPLAY_MAX_PAGES];
+
+       // Only the parts drawn to since the last display() are compared
+       if (!updateBackBuffer(changed)) return;
+
+       uint8_t windowCount = planWindows(changed, windows);
+       for (uint8_t w = 0; w < windowCount; w++) {
+         sendWindow(windows[w]);
+       }
+     #else
+       OLEDDisplayWindow window = { 0, (uint8_t) (displayWidth - 1), 0, (uint8_t) (displayHeight / 8 - 1) };
+       sendWindow(window);
+     #endif
+    }
+
+  protected:
+    OLEDDISPLAY_CONTROLLER controller = CONTROLLER_SSD1306;
+
+    // Bytes one write can carry after its control byte
+    uint16_t i2cChunkSize = 16;
+
+    // One write to the display: i2cBegin() starts it with the control
+    // byte, i2cWrite() adds bytes and i2cEnd() sends it off
+    virtual void i2cBegin(uint8_t control) = 0;
+    virtual void i2cWrite(const uint8_t *data, uint16_t length) = 0;
+    virtual void i2cEnd(void) = 0;
+
+    void sendCommand(uint8_t com) {
+      i2cBegin(I2C_CONTROL_COMMAND);
+      i2cWrite(&com, 1);
+      i2cEnd();
+    }
+
+    void sendCommands(const uint8_t *commands, uint8_t count) {
+      while (count > 0) {
+        uint8_t length = _min(count, i2cChunkSize);
+        i2cBegin(I2C_CONTROL_COMMANDS);
+        i2cWrite(commands, length);
+        i2cEnd();
+        commands += length;
+        count    -= length;
+      }
+    }
+
+    // Every write costs about three bytes for start, address, control byte
+    // and stop. A SSD1306 window is a write of six commands plus a new data
+    // write, a SH1106 page the same with three commands.
+    uint8_t planWindows(const OLEDDisplaySpan *changed, OLEDDisplayWindow *windows) {
+      if (controller == CONTROLLER_SH1106) {
+        return planFlush(changed, displayHeight / 8, 0, 9, windows);
+      }
+      return planFlush(changed, displayHeight / 8, 12, 0, windows);
+    }
+
+    bool canFlushIncrementally(void) {
+      return true;
+    }
+
+    void sendWindowPage(const OLEDDisplayWindow &window, uint8_t page, const uint8_t *row) {
+      if (controller == CONTROLLER_SH1106) {
+        addressPage(window.fromX, page);
+      } else if (page == window.fromPage) {
+        addressWindow(window);
+      }
+      sendData(row, window.toX - window.fromX + 1, 1);
+    }
+
+    // Address a window on the controller and stream its bytes from buffer
+    void sendWindow(const OLEDDisplayWindow &window) {
+      uint16_t       columns = window.toX - window.fromX + 1;
+      const uint8_t *data    = buffer + window.fromPage * displayWidth + window.fromX;
+
+      if (controller == CONTROLLER_SH1106) {
+        for (uint8_t page = window.fromPage; page <= window.toPage; page++) {
+          addressPage(window.fromX, page);
+          sendData(data, columns, 1);
+          data += displayWidth;
+        }
+      } else {
+        addressWindow(window);
+        sendData(data, columns, window.toPage - window.fromPage + 1);
+      }
+    }
+
+    void addressWindow(const OLEDDisplayWindow &window) {
+      uint8_t x_offset = (128 - displayWidth) / 2;
+      const uint8_t commands[] = {
+        COLUMNADDR, (uint8_t) (x_offset + window.fromX), (uint8_t) (x_offset + window.toX),
+        PAGEADDR, window.fromPage, window.toPage
+      };
+      sendCommands(commands, sizeof(commands));
+    }
+
+    // The SH1106 has 132 columns, the visible ones start at 2
+    void addressPage(uint8_t fromX, uint8_t page) {
+      uint8_t column = fromX + 2;
+      const uint8_t commands[] = { (uint8_t) (0xB0 + page), (uint8_t) (column & 0x0F), (uint8_t) (0x10 | (column >> 4)) };
+      sendCommands(commands, sizeof(commands));
+    }
+
+    // Send `rows` rows of `columns` bytes, displayWidth apart in `data`, as
+    // one data stream split into writes of at most i2cChunkSize bytes
+    void sendData(const uint8_t *data, uint16_t columns, uint8_t rows) {
+      uint16_t room = 0;
+      bool     open = false;
+
+      for (uint8_t y = 0; y < rows; y++) {
+        const uint8_t *row  = data + y * displayWidth;
+        uint16_t       left = columns;
+        while (left > 0) {
+          if (room == 0) {
+            if (open) i2cEnd();
+            i2cBegin(I2C_CONTROL_DATA);
+            open = true;
+            room = i2cChunkSize;
+          }
+          uint16_t length = _min(left, room);
+          i2cWrite(row, length);
+          row  += length;
+          left -= length;
+          room -= length;
+        }
+        yield();
+      }
+      if (open) i2cEnd();
+    }
+};
+
+#endif
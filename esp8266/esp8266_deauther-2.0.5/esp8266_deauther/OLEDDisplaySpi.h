@@ -0,0 +1,196 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+#ifndef OLEDDisplaySpi_h
+#define OLEDDisplaySpi_h
+
+#include "OLEDDisplay.h"
+#include <SPI.h>
+
+// Bytes staged for one SPI.writeBytes(), the size of the ESP8266 SPI FIFO
+#ifndef OLEDDISPLAY_SPI_CHUNK
+  #define OLEDDISPLAY_SPI_CHUNK 64
+#endif
+
+// CS pin of a driver that leaves CS alone
+#define OLEDDISPLAY_SPI_NO_CS 0xFF
+
+// Shared part of the SPI drivers. A batch of commands goes out under one
+// DC and CS assertion, display data as bulk writes of whole rows, copied
+// into a word aligned staging buffer for SPI.writeBytes() first. The
+// drivers only set the pins and the controller.
+class OLEDDisplaySpi : public OLEDDisplay {
+  public:
+    void display(void) {
+    #ifdef OLEDDISPLAY_PARTIAL_UPDATE
+       OLEDDisplaySpan   changed[OLEDDISPLAY_MAX_PAGES];
+       OLEDDisplayWindow windows[OLEDDISPLAY_MAX_PAGES];
+
+       // Only the parts drawn to since the last display() are compared
+       if (!updateBackBuffer(changed)) return;
+
+       uint8_t windowCount = planWindows(changed, windows);
+       for (uint8_t w = 0; w < windowCount; w++) {
+         sendWindow(windows[w]);
+       }
+     #else
+       OLEDDisplayWindow window = { 0, (uint8_t) (displayWidth - 1), 0, (uint8_t) (displayHeight / 8 - 1) };
+       sendWindow(window);
+     #endif
+    }
+
+    // SPI clock as SPI.setClockDivider() takes it, set before init()
+    void setClockDivider(uint32_t clockDivider) {
+      this->clockDivider = clockDivider;
+    }
+
+  protected:
+    OLEDDISPLAY_CONTROLLER controller = CONTROLLER_SSD1306;
+
+    uint8_t   _rst;
+    uint8_t   _dc;
+    uint8_t   _cs = OLEDDISPLAY_SPI_NO_CS;
+    uint32_t  clockDivider = SPI_CLOCK_DIV2;
+
+    bool connect() {
+      pinMode(_dc, OUTPUT);
+      if (_cs != OLEDDISPLAY_SPI_NO_CS) pinMode(_cs, OUTPUT);
+      pinMode(_rst, OUTPUT);
+
+      SPI.begin ();
+      SPI.setClockDivider (clockDivider);
+
+      // Pulse Reset low for 10ms
+      digitalWrite(_rst, HIGH);
+      delay(1);
+      digitalWrite(_rst, LOW);
+      delay(10);
+      digitalWrite(_rst, HIGH);
+      return true;
+    }
+
+    void sendCommand(uint8_t com) {
+      spiSend(&com, 1, 1, LOW);
+    }
+
+    void sendCommands(const uint8_t *commands, uint8_t count) {
+      spiSend(commands, count, 1, LOW);
+    }
+
+    // A SSD1306 window is six command bytes and a DC toggle, a SH1106
+    // page three and a DC toggle
+    uint8_t planWindows(const OLEDDisplaySpan *changed, OLEDDisplayWindow *windows) {
+      if (controller == CONTROLLER_SH1106) {
+        return planFlush(changed, displayHeight / 8, 0, 4, windows);
+      }
+      return planFlush(changed, displayHeight / 8, 8, 0, windows);
+    }
+
+    bool canFlushIncrementally(void) {
+      return true;
+    }
+
+    void sendWindowPage(const OLEDDisplayWindow &window, uint8_t page, const uint8_t *row) {
+      if (controller == CONTROLLER_SH1106) {
+        addressPage(window.fromX, page);
+      } else if (page == window.fromPage) {
+        addressWindow(window);
+      }
+      spiSend(row, window.toX - window.fromX + 1, 1, HIGH);
+    }
+
+    // Address a window on the controller and stream its bytes from buffer
+    void sendWindow(const OLEDDisplayWindow &window) {
+      uint16_t       columns = window.toX - window.fromX + 1;
+      const uint8_t *data    = buffer + window.fromPage * displayWidth + window.fromX;
+
+      if (controller == CONTROLLER_SH1106) {
+        for (uint8_t page = window.fromPage; page <= window.toPage; page++) {
+          addressPage(window.fromX, page);
+          spiSend(data, columns, 1, HIGH);
+          data += displayWidth;
+        }
+      } else {
+        addressWindow(window);
+        spiSend(data, columns, window.toPage - window.fromPage + 1, HIGH);
+      }
+    }
+
+    void addressWindow(const OLEDDisplayWindow &window) {
+      uint8_t x_offset = (128 - displayWidth) / 2;
+      const uint8_t commands[] = {
+        COLUMNADDR, (uint8_t) (x_offset + window.fromX), (uint8_t) (x_offset + window.toX),
+        PAGEADDR, window.fromPage, window.toPage
+      };
+      sendCommands(commands, sizeof(commands));
+    }
+
+    // The SH1106 has 132 columns, the visible ones start at 2
+    void addressPage(uint8_t fromX, uint8_t page) {
+      uint8_t column = fromX + 2;
+      const uint8_t commands[] = { (uint8_t) (0xB0 + page), (uint8_t) (column & 0x0F), (uint8_t) (0x10 | (column >> 4)) };
+      sendCommands(commands, sizeof(commands));
+    }
+
+    // Send `rows` rows of `columns` bytes, displayWidth apart in `data`,
+    // with DC at `dc` and CS asserted once, OLEDDISPLAY_SPI_CHUNK bytes
+    // per SPI.writeBytes()
+    void spiSend(const uint8_t *data, uint16_t columns, uint8_t rows, uint8_t dc) {
+      uint8_t *stage = (uint8_t *) spiStage;
+      uint16_t staged = 0;
+
+      digitalWrite(_dc, dc);
+      if (_cs != OLEDDISPLAY_SPI_NO_CS) digitalWrite(_cs, LOW);
+      for (uint8_t y = 0; y < rows; y++) {
+        const uint8_t *row  = data + y * displayWidth;
+        uint16_t       left = columns;
+        while (left > 0) {
+          uint16_t length = _min(left, OLEDDISPLAY_SPI_CHUNK - staged);
+          memcpy(stage + staged, row, length);
+          staged += length;
+          row    += length;
+          left   -= length;
+          if (staged == OLEDDISPLAY_SPI_CHUNK) {
+            SPI.writeBytes(stage, staged);
+            staged = 0;
+          }
+        }
+        yield();
+      }
+      if (staged > 0) SPI.writeBytes(stage, staged);
+      if (_cs != OLEDDISPLAY_SPI_NO_CS) digitalWrite(_cs, HIGH);
+    }
+
+  private:
+    // Word aligned, ESP8266 cores before 2.5 read it a word at a time
+    uint32_t  spiStage[OLEDDISPLAY_SPI_CHUNK / 4];
+};
+
+#endif
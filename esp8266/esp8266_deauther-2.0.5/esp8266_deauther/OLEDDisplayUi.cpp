@@ -34,13 +34,19 @@ OLEDDisplayUi::OLEDDisplayUi(OLEDDisplay *display) {
   this->display = display;
 }
 
+OLEDDisplayUi::~OLEDDisplayUi() {
+  this->disableFrameCache();
+}
+
 void OLEDDisplayUi::init() {
   this->display->init();
+  this->shownHashValid = false;
 }
 
 void OLEDDisplayUi::setTargetFPS(uint8_t fps){
   float oldInterval = this->updateInterval;
   this->updateInterval = ((float) 1.0 / (float) fps) * 1000;
+  this->frameInterval = _max(this->frameInterval, this->updateInterval);
 
   // Calculate new ticksPerFrame
   float changeRatio = oldInterval / (float) this->updateInterval;
@@ -48,6 +54,10 @@ void OLEDDisplayUi::setTargetFPS(uint8_t fps){
   this->ticksPerTransition *= changeRatio;
 }
 
+void OLEDDisplayUi::setMaxLoad(uint8_t percent){
+  this->maxLoad = _max(1, _min(percent, 100));
+}
+
 // -/------ Automatic controll ------\-
 
 void OLEDDisplayUi::enableAutoTransition(){
@@ -112,6 +122,35 @@ void OLEDDisplayUi::setFrames(FrameCallback* frameFunctions, uint8_t frameCount)
   this->resetState();
 }
 
+bool OLEDDisplayUi::enableFrameCache() {
+  uint16_t width  = this->display->getWidth();
+  uint16_t height = this->display->getHeight();
+  // The sprite header has a byte for each
+  if (width > 255 || height > 255) return false;
+  if (this->frameCache != NULL) return true;
+
+  uint16_t imageSize = SPRITE_DATA_START + width * height / 8;
+  this->frameCache = (uint8_t *) malloc(2 * imageSize);
+  if (!this->frameCache) {
+    DEBUG_OLEDDISPLAYUI("[OLEDDISPLAYUI][enableFrameCache] Not enough memory for the frame cache\n");
+    return false;
+  }
+  for (uint8_t i = 0; i < 2; i++) {
+    uint8_t *image = this->frameCache + i * imageSize;
+    image[SPRITE_WIDTH_POS]  = width;
+    image[SPRITE_HEIGHT_POS] = height;
+    image[SPRITE_FLAGS_POS]  = SPRITE_OPAQUE;
+  }
+  this->cachedFrames = -1;
+  return true;
+}
+
+void OLEDDisplayUi::disableFrameCache() {
+  if (this->frameCache != NULL) free(this->frameCache);
+  this->frameCache = NULL;
+  this->cachedFrames = -1;
+}
+
 // -/----- Overlays ------\-
 void OLEDDisplayUi::setOverlays(OverlayCallback* overlayFunctions, uint8_t overlayCount){
   this->overlayFunctions = overlayFunctions;
@@ -142,6 +181,7 @@ void OLEDDisplayUi::runLoadingProcess(LoadingStage* stages, uint8_t stagesCount)
   display->clear();
   this->loadingDrawFunction(this->display, &stages[stagesCount-1], progress);
   display->display();
+  this->shownHashValid = false;
 
   delay(150);
 }
@@ -169,6 +209,7 @@ void OLEDDisplayUi::previousFrame() {
 void OLEDDisplayUi::switchToFrame(uint8_t frame) {
   if (frame >= this->frameCount) return;
   this->state.ticksSinceLastStateSwitch = 0;
+  this->shownHashValid = false;
   if (frame == this->state.currentFrame) return;
   this->state.frameState = FIXED;
   this->state.currentFrame = frame;
@@ -193,19 +234,54 @@ OLEDDisplayUiState* OLEDDisplayUi::getUiState(){
 }
 
 
-int8_t OLEDDisplayUi::update(){
-  unsigned long frameStart = millis();
-  int8_t timeBudget = this->updateInterval - (frameStart - this->state.lastUpdate);
-  if ( timeBudget <= 0) {
-    // Implement frame skipping to ensure time budget is keept
-    if (this->autoTransition && this->state.lastUpdate != 0) this->state.ticksSinceLastStateSwitch += ceil(-timeBudget / this->updateInterval);
+const OLEDDisplayUiStats* OLEDDisplayUi::getStats(){
+  this->stats.interval = this->frameInterval;
+  return &this->stats;
+}
+
+void OLEDDisplayUi::resetStats(){
+  this->stats.frames          = 0;
+  this->stats.unchangedFrames = 0;
+  this->stats.skippedTicks    = 0;
+  this->stats.maxFrameMicros  = 0;
+}
 
-    this->state.lastUpdate = frameStart;
+
+int32_t OLEDDisplayUi::update(){
+  unsigned long frameStart = millis();
+  unsigned long elapsed    = frameStart - this->state.lastUpdate;
+  if (this->state.lastUpdate == 0 || elapsed >= this->frameInterval) {
+    // Ticks keep their length when they are drawn further apart, the ones
+    // in between are skipped so frames and transitions take as long
+    unsigned long ticks   = this->state.lastUpdate == 0 ? 1 : elapsed / this->updateInterval;
+    uint16_t      skipped = _min(ticks - 1, (unsigned long) (UINT16_MAX - 1 - this->state.ticksSinceLastStateSwitch));
+    this->state.ticksSinceLastStateSwitch += skipped;
+    this->stats.skippedTicks += skipped;
+
+    this->state.lastUpdate = this->state.lastUpdate == 0 ? frameStart : frameStart - elapsed % this->updateInterval;
     this->tick();
   }
-  return this->updateInterval - (millis() - frameStart);
+  return (int32_t) this->frameInterval - (int32_t) (millis() - this->state.lastUpdate);
 }
 
+// FNV-1a a word at a time, only ever compared with the hash of the last frame
+static uint32_t frameHash(const uint8_t *buffer, uint16_t size) {
+  uint32_t hash = 2166136261UL;
+  uint16_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    uint32_t word;
+    memcpy(&word, buffer + i, 4);
+    hash = (hash ^ word) * 16777619UL;
+  }
+  for (; i < size; i++) hash = (hash ^ buffer[i]) * 16777619UL;
+  return hash;
+}
+
+// Running average over about 8 samples
+static uint32_t averageMicros(uint32_t average, uint32_t sample, bool first) {
+  if (first) return sample;
+  return (int32_t) average + ((int32_t) sample - (int32_t) average) / 8;
+}
 
 void OLEDDisplayUi::tick() {
   this->state.ticksSinceLastStateSwitch++;
@@ -234,13 +310,37 @@ void OLEDDisplayUi::tick() {
       break;
   }
 
+  uint32_t drawStart = micros();
   this->display->clear();
   this->drawFrame();
   if (shouldDrawIndicators) {
     this->drawIndicator();
   }
   this->drawOverlays();
-  this->display->display();
+
+  uint32_t flushStart = micros();
+  uint32_t hash = frameHash(this->display->buffer, this->display->getWidth() * this->display->getHeight() / 8);
+  if (this->shownHashValid && hash == this->shownHash) {
+    this->stats.unchangedFrames++;
+  } else {
+    this->display->display();
+    this->shownHash      = hash;
+    this->shownHashValid = true;
+  }
+  uint32_t flushEnd = micros();
+
+  // Leave the share of the time setMaxLoad() asks for to everything else
+  bool first = this->stats.frames++ == 0;
+  this->stats.drawMicros     = averageMicros(this->stats.drawMicros, flushStart - drawStart, first);
+  this->stats.flushMicros    = averageMicros(this->stats.flushMicros, flushEnd - flushStart, first);
+  this->stats.maxFrameMicros = _max(this->stats.maxFrameMicros, flushEnd - drawStart);
+  uint32_t busyMillis = ((this->stats.drawMicros + this->stats.flushMicros) * 100 / this->maxLoad + 999) / 1000;
+  this->frameInterval = _max((uint32_t) this->updateInterval, _min(busyMillis, (uint32_t) UINT16_MAX));
+
+  // After the rows it brings into view are sent
+  if (this->startLine != this->shownStartLine && this->display->setStartLine(this->startLine)) {
+    this->shownStartLine = this->startLine;
+  }
 }
 
 void OLEDDisplayUi::resetState() {
@@ -249,36 +349,40 @@ void OLEDDisplayUi::resetState() {
   this->state.frameState = FIXED;
   this->state.currentFrame = 0;
   this->state.isIndicatorDrawen = true;
+  this->cachedFrames = -1;
+  this->shownHashValid = false;
 }
 
 void OLEDDisplayUi::drawFrame(){
+  this->startLine = 0;
   switch (this->state.frameState){
      case IN_TRANSITION: {
-       float progress = (float) this->state.ticksSinceLastStateSwitch / (float) this->ticksPerTransition;
+       // The offsets only move by whole pixels
+       uint16_t ticks = this->state.ticksSinceLastStateSwitch;
        int16_t x = 0, y = 0, x1 = 0, y1 = 0;
        switch(this->frameAnimationDirection){
         case SLIDE_LEFT:
-          x = -this->display->width() * progress;
+          x = -(int32_t) this->display->width() * ticks / this->ticksPerTransition;
           y = 0;
           x1 = x + this->display->width();
           y1 = 0;
           break;
         case SLIDE_RIGHT:
-          x = this->display->width() * progress;
+          x = (int32_t) this->display->width() * ticks / this->ticksPerTransition;
           y = 0;
           x1 = x - this->display->width();
           y1 = 0;
           break;
         case SLIDE_UP:
           x = 0;
-          y = -this->display->height() * progress;
+          y = -(int32_t) this->display->height() * ticks / this->ticksPerTransition;
           x1 = 0;
           y1 = y + this->display->height();
           break;
         case SLIDE_DOWN:
         default:
           x = 0;
-          y = this->display->height() * progress;
+          y = (int32_t) this->display->height() * ticks / this->ticksPerTransition;
           x1 = 0;
           y1 = y - this->display->height();
           break;
@@ -290,14 +394,19 @@ void OLEDDisplayUi::drawFrame(){
 
        bool drawenCurrentFrame;
 
-
-       // Prope each frameFunction for the indicator Drawen state
-       this->enableIndicator();
-       (this->frameFunctions[this->state.currentFrame])(this->display, &this->state, x, y);
-       drawenCurrentFrame = this->state.isIndicatorDrawen;
-
-       this->enableIndicator();
-       (this->frameFunctions[this->getNextFrameNumber()])(this->display, &this->state, x1, y1);
+       if (this->frameCache != NULL) {
+         this->drawCachedFrames(x, y, x1, y1);
+         drawenCurrentFrame = this->cachedIndicators[0];
+         this->state.isIndicatorDrawen = this->cachedIndicators[1];
+       } else {
+         // Prope each frameFunction for the indicator Drawen state
+         this->enableIndicator();
+         (this->frameFunctions[this->state.currentFrame])(this->display, &this->state, x, y);
+         drawenCurrentFrame = this->state.isIndicatorDrawen;
+
+         this->enableIndicator();
+         (this->frameFunctions[this->getNextFrameNumber()])(this->display, &this->state, x1, y1);
+       }
 
        // Build up the indicatorDrawState
        if (drawenCurrentFrame && !this->state.isIndicatorDrawen) {
@@ -321,12 +430,76 @@ void OLEDDisplayUi::drawFrame(){
       // Always assume that the indicator is drawn!
       // And set indicatorDrawState to "not known yet"
       this->indicatorDrawState = 0;
+      // The next transition renders its frames again
+      this->cachedFrames = -1;
       this->enableIndicator();
       (this->frameFunctions[this->state.currentFrame])(this->display, &this->state, 0, 0);
       break;
   }
 }
 
+// Draws `frame` at 0, 0 into the sprite `image`, returns its indicator state
+bool OLEDDisplayUi::renderFrame(uint8_t frame, uint8_t *image) {
+  this->display->clear();
+  this->enableIndicator();
+  (this->frameFunctions[frame])(this->display, &this->state, 0, 0);
+  memcpy(image + SPRITE_DATA_START, this->display->buffer, this->display->getWidth() * this->display->getHeight() / 8);
+  return this->state.isIndicatorDrawen;
+}
+
+void OLEDDisplayUi::drawCachedFrames(int16_t x, int16_t y, int16_t x1, int16_t y1) {
+  uint16_t width     = this->display->getWidth();
+  uint16_t height    = this->display->getHeight();
+  uint16_t imageSize = SPRITE_DATA_START + width * height / 8;
+  uint8_t  *current  = this->frameCache;
+  uint8_t  *next     = this->frameCache + imageSize;
+
+  int16_t frames = this->state.currentFrame << 8 | this->getNextFrameNumber();
+  if (this->cachedFrames != frames) {
+    this->cachedIndicators[0] = this->renderFrame(this->state.currentFrame, current);
+    this->cachedIndicators[1] = this->renderFrame(this->getNextFrameNumber(), next);
+    this->display->clear();
+    this->cachedFrames = frames;
+
+    // Anything drawn over the frames would scroll with them
+    bool covered = this->overlayCount > 0 || (this->shouldDrawIndicators && (this->cachedIndicators[0] || this->cachedIndicators[1]));
+    bool vertical = this->frameAnimationDirection == SLIDE_UP || this->frameAnimationDirection == SLIDE_DOWN;
+    this->scrollInHardware = vertical && !covered && this->display->setStartLine(this->shownStartLine);
+  }
+
+  if (this->scrollInHardware) {
+    // Row r of the RAM shows up at row r + y of the screen. The rows of the
+    // current frame that are still in view stay where they are, the others
+    // already hold the next frame.
+    int16_t  from      = _max(0, -y);
+    int16_t  to        = _min(height, height - y);
+    uint8_t *bufferPtr = this->display->buffer;
+    current += SPRITE_DATA_START;
+    next    += SPRITE_DATA_START;
+    for (uint16_t page = 0; page < height / 8; page++) {
+      int16_t top    = page * 8;
+      uint8_t keep   = 0;
+      if (from < top + 8 && to > top) {
+        keep = 0xFF;
+        if (from > top) keep &= 0xFF << (from - top);
+        if (to < top + 8) keep &= 0xFF >> (top + 8 - to);
+      }
+      for (uint16_t i = 0; i < width; i++) {
+        *bufferPtr++ = (*current++ & keep) | (*next++ & ~keep);
+      }
+    }
+    this->display->markDirty();
+    this->startLine = (height - y) % height;
+    return;
+  }
+
+  OLEDDISPLAY_COLOR color = this->display->getColor();
+  this->display->setColor(WHITE);
+  this->display->drawSprite(x, y, current);
+  this->display->drawSprite(x1, y1, next);
+  this->display->setColor(color);
+}
+
 void OLEDDisplayUi::drawIndicator() {
 
     // Only draw if the indicator is invisible
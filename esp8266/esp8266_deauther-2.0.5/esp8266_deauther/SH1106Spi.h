@@ -31,101 +31,18 @@
 #ifndef SH1106Spi_h
 #define SH1106Spi_h
 
-#include "OLEDDisplay.h"
-#include <SPI.h>
-
-class SH1106Spi : public OLEDDisplay {
-  private:
-      uint8_t             _rst;
-      uint8_t             _dc;
+#include "OLEDDisplaySpi.h"
 
+// Leaves CS alone, it has to be tied low
+class SH1106Spi : public OLEDDisplaySpi {
   public:
     SH1106Spi(uint8_t _rst, uint8_t _dc, uint8_t _cs, OLEDDISPLAY_GEOMETRY g = GEOMETRY_128_64) {
-        setGeometry(g);
+      setGeometry(g);
 
       this->_rst = _rst;
       this->_dc  = _dc;
-    }
-
-    bool connect(){
-      pinMode(_dc, OUTPUT);
-      pinMode(_rst, OUTPUT);
-
-      SPI.begin ();
-      SPI.setClockDivider (SPI_CLOCK_DIV2);
-
-      // Pulse Reset low for 10ms
-      digitalWrite(_rst, HIGH);
-      delay(1);
-      digitalWrite(_rst, LOW);
-      delay(10);
-      digitalWrite(_rst, HIGH);
-      return true;
-    }
-
-    void display(void) {
-    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-       uint8_t minBoundY = UINT8_MAX;
-       uint8_t maxBoundY = 0;
-
-       uint8_t minBoundX = UINT8_MAX;
-       uint8_t maxBoundX = 0;
-
-       uint8_t x, y;
-
-       // Calculate the Y bounding box of changes
-       // and copy buffer[pos] to buffer_back[pos];
-       for (y = 0; y < (displayHeight / 8); y++) {
-         for (x = 0; x < displayWidth; x++) {
-          uint16_t pos = x + y * displayWidth;
-          if (buffer[pos] != buffer_back[pos]) {
-            minBoundY = _min(minBoundY, y);
-            maxBoundY = _max(maxBoundY, y);
-            minBoundX = _min(minBoundX, x);
-            maxBoundX = _max(maxBoundX, x);
-          }
-          buffer_back[pos] = buffer[pos];
-        }
-        yield();
-       }
-
-       // If the minBoundY wasn't updated
-       // we can savely assume that buffer_back[pos] == buffer[pos]
-       // holdes true for all values of pos
-       if (minBoundY == UINT8_MAX) return;
-
-       // Calculate the colum offset
-       uint8_t minBoundXp2H = (minBoundX + 2) & 0x0F;
-       uint8_t minBoundXp2L = 0x10 | ((minBoundX + 2) >> 4 );
-
-       for (y = minBoundY; y <= maxBoundY; y++) {
-         sendCommand(0xB0 + y);
-         sendCommand(minBoundXp2H);
-         sendCommand(minBoundXp2L);
-         digitalWrite(_dc, HIGH);   // data mode
-         for (x = minBoundX; x <= maxBoundX; x++) {
-           SPI.transfer(buffer[x + y * displayWidth]);
-         }
-         yield();
-       }
-     #else
-      for (uint8_t y=0; y<displayHeight/8; y++) {
-        sendCommand(0xB0 + y);
-        sendCommand(0x02);
-        sendCommand(0x10);
-        digitalWrite(_dc, HIGH);   // data mode
-        for( uint8_t x=0; x < displayWidth; x++) {
-          SPI.transfer(buffer[x + y * displayWidth]);
-        }
-        yield();
-      }
-     #endif
-    }
-
-  private:
-    inline void sendCommand(uint8_t com) __attribute__((always_inline)){
-      digitalWrite(_dc, LOW);
-      SPI.transfer(com);
+      this->controller = CONTROLLER_SH1106;
+      (void) _cs;
     }
 };
 
@@ -31,8 +31,8 @@
 #ifndef SH1106Wire_h
 #define SH1106Wire_h
 
-#include "OLEDDisplay.h"
 #include <Wire.h>
+#include "OLEDDisplayI2C.h"
 
 #define SH1106_SET_PUMP_VOLTAGE 0X30
 #define SH1106_SET_PUMP_MODE 0XAD
@@ -40,7 +40,18 @@
 #define SH1106_PUMP_OFF 0X8A
 //--------------------------------------
 
-class SH1106Wire : public OLEDDisplay {
+// Bytes Wire can buffer for one transmission, the control byte included
+#ifndef OLEDDISPLAY_WIRE_BUFFER
+  #if defined(I2C_BUFFER_LENGTH)
+    #define OLEDDISPLAY_WIRE_BUFFER I2C_BUFFER_LENGTH
+  #elif defined(BUFFER_LENGTH)
+    #define OLEDDISPLAY_WIRE_BUFFER BUFFER_LENGTH
+  #else
+    #define OLEDDISPLAY_WIRE_BUFFER 32
+  #endif
+#endif
+
+class SH1106Wire : public OLEDDisplayI2C {
   private:
       uint8_t             _address;
       uint8_t             _sda;
@@ -53,6 +64,8 @@ class SH1106Wire : public OLEDDisplay {
       this->_address = _address;
       this->_sda = _sda;
       this->_scl = _scl;
+      this->controller = CONTROLLER_SH1106;
+      this->i2cChunkSize = OLEDDISPLAY_WIRE_BUFFER - 1;
     }
 
     bool connect() {
@@ -63,95 +76,20 @@ class SH1106Wire : public OLEDDisplay {
       return true;
     }
 
-    void display(void) {
-      #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-        uint8_t minBoundY = UINT8_MAX;
-        uint8_t maxBoundY = 0;
-
-        uint8_t minBoundX = UINT8_MAX;
-        uint8_t maxBoundX = 0;
-
-        uint8_t x, y;
-
-        // Calculate the Y bounding box of changes
-        // and copy buffer[pos] to buffer_back[pos];
-        for (y = 0; y < (displayHeight / 8); y++) {
-          for (x = 0; x < displayWidth; x++) {
-           uint16_t pos = x + y * displayWidth;
-           if (buffer[pos] != buffer_back[pos]) {
-             minBoundY = _min(minBoundY, y);
-             maxBoundY = _max(maxBoundY, y);
-             minBoundX = _min(minBoundX, x);
-             maxBoundX = _max(maxBoundX, x);
-           }
-           buffer_back[pos] = buffer[pos];
-         }
-         yield();
-        }
-
-        // If the minBoundY wasn't updated
-        // we can savely assume that buffer_back[pos] == buffer[pos]
-        // holdes true for all values of pos
-        if (minBoundY == UINT8_MAX) return;
-
-        // Calculate the colum offset
-        uint8_t minBoundXp2H = (minBoundX + 2) & 0x0F;
-        uint8_t minBoundXp2L = 0x10 | ((minBoundX + 2) >> 4 );
-
-        byte k = 0;
-        for (y = minBoundY; y <= maxBoundY; y++) {
-          sendCommand(0xB0 + y);
-          sendCommand(minBoundXp2H);
-          sendCommand(minBoundXp2L);
-          for (x = minBoundX; x <= maxBoundX; x++) {
-            if (k == 0) {
-              Wire.beginTransmission(_address);
-              Wire.write(0x40);
-            }
-            Wire.write(buffer[x + y * displayWidth]);
-            k++;
-            if (k == 16)  {
-              Wire.endTransmission();
-              k = 0;
-            }
-          }
-          if (k != 0)  {
-            Wire.endTransmission();
-            k = 0;
-          }
-          yield();
-        }
+  protected:
+    void i2cBegin(uint8_t control) {
+      Wire.beginTransmission(_address);
+      Wire.write(control);
+    }
 
-        if (k != 0) {
-          Wire.endTransmission();
-        }
-      #else
-        uint8_t * p = &buffer[0];
-        for (uint8_t y=0; y<8; y++) {
-          sendCommand(0xB0+y);
-          sendCommand(0x02);
-          sendCommand(0x10);
-          for( uint8_t x=0; x<8; x++) {
-            Wire.beginTransmission(_address);
-            Wire.write(0x40);
-            for (uint8_t k = 0; k < 16; k++) {
-              Wire.write(*p++);
-            }
-            Wire.endTransmission();
-          }
-        }
-      #endif
+    void i2cWrite(const uint8_t *data, uint16_t length) {
+      Wire.write(data, length);
     }
 
-  private:
-    inline void sendCommand(uint8_t command) __attribute__((always_inline)){
-      Wire.beginTransmission(_address);
-      Wire.write(0x80);
-      Wire.write(command);
+    void i2cEnd(void) {
       Wire.endTransmission();
     }
 
-
 };
 
 #endif
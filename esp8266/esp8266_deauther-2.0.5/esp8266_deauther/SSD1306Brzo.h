@@ -31,7 +31,7 @@
 #ifndef SSD1306Brzo_h
 #define SSD1306Brzo_h
 
-#include "OLEDDisplay.h"
+#include "OLEDDisplayI2C.h"
 #include <brzo_i2c.h>
 
 #if F_CPU == 160000000L
@@ -40,11 +40,18 @@
   #define BRZO_I2C_SPEED 800
 #endif
 
-class SSD1306Brzo : public OLEDDisplay {
+// Data bytes staged for one brzo transaction
+#ifndef OLEDDISPLAY_BRZO_CHUNK
+  #define OLEDDISPLAY_BRZO_CHUNK 64
+#endif
+
+class SSD1306Brzo : public OLEDDisplayI2C {
   private:
       uint8_t             _address;
       uint8_t             _sda;
       uint8_t             _scl;
+      uint8_t             _sendBuffer[OLEDDISPLAY_BRZO_CHUNK + 1];
+      uint8_t             _sendLength = 0;
 
   public:
     SSD1306Brzo(uint8_t _address, uint8_t _sda, uint8_t _scl, OLEDDISPLAY_GEOMETRY g = GEOMETRY_128_64) {
@@ -53,6 +60,8 @@ class SSD1306Brzo : public OLEDDisplay {
       this->_address = _address;
       this->_sda = _sda;
       this->_scl = _scl;
+      this->controller = CONTROLLER_SSD1306;
+      this->i2cChunkSize = OLEDDISPLAY_BRZO_CHUNK;
     }
 
     bool connect(){
@@ -60,98 +69,20 @@ class SSD1306Brzo : public OLEDDisplay {
       return true;
     }
 
-    void display(void) {
-    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-       uint8_t minBoundY = UINT8_MAX;
-       uint8_t maxBoundY = 0;
-
-       uint8_t minBoundX = UINT8_MAX;
-       uint8_t maxBoundX = 0;
-
-       uint8_t x, y;
-
-       // Calculate the Y bounding box of changes
-       // and copy buffer[pos] to buffer_back[pos];
-       for (y = 0; y < (displayHeight / 8); y++) {
-         for (x = 0; x < displayWidth; x++) {
-          uint16_t pos = x + y * displayWidth;
-          if (buffer[pos] != buffer_back[pos]) {
-            minBoundY = _min(minBoundY, y);
-            maxBoundY = _max(maxBoundY, y);
-            minBoundX = _min(minBoundX, x);
-            maxBoundX = _max(maxBoundX, x);
-          }
-          buffer_back[pos] = buffer[pos];
-        }
-        yield();
-       }
-
-       // If the minBoundY wasn't updated
-       // we can savely assume that buffer_back[pos] == buffer[pos]
-       // holdes true for all values of pos
-       if (minBoundY == UINT8_MAX) return;
-
-       sendCommand(COLUMNADDR);
-       sendCommand(minBoundX);
-       sendCommand(maxBoundX);
-
-       sendCommand(PAGEADDR);
-       sendCommand(minBoundY);
-       sendCommand(maxBoundY);
-
-       byte k = 0;
-       uint8_t sendBuffer[17];
-       sendBuffer[0] = 0x40;
-       brzo_i2c_start_transaction(this->_address, BRZO_I2C_SPEED);
-       for (y = minBoundY; y <= maxBoundY; y++) {
-           for (x = minBoundX; x <= maxBoundX; x++) {
-               k++;
-               sendBuffer[k] = buffer[x + y * displayWidth];
-               if (k == 16)  {
-                 brzo_i2c_write(sendBuffer, 17, true);
-                 k = 0;
-               }
-           }
-           yield();
-       }
-       brzo_i2c_write(sendBuffer, k + 1, true);
-       brzo_i2c_end_transaction();
-     #else
-       // No double buffering
-       sendCommand(COLUMNADDR);
-       sendCommand(0x0);
-       sendCommand(0x7F);
-
-       sendCommand(PAGEADDR);
-       sendCommand(0x0);
-
-       if (geometry == GEOMETRY_128_64) {
-         sendCommand(0x7);
-       } else if (geometry == GEOMETRY_128_32) {
-         sendCommand(0x3);
-       }
+  protected:
+    void i2cBegin(uint8_t control) {
+      _sendBuffer[0] = control;
+      _sendLength = 1;
+    }
 
-       uint8_t sendBuffer[17];
-       sendBuffer[0] = 0x40;
-       brzo_i2c_start_transaction(this->_address, BRZO_I2C_SPEED);
-       for (uint16_t i=0; i<displayBufferSize; i++) {
-         for (uint8_t x=1; x<17; x++) {
-           sendBuffer[x] = buffer[i];
-           i++;
-         }
-         i--;
-         brzo_i2c_write(sendBuffer,  17,  true);
-         yield();
-       }
-       brzo_i2c_end_transaction();
-     #endif
+    void i2cWrite(const uint8_t *data, uint16_t length) {
+      memcpy(_sendBuffer + _sendLength, data, length);
+      _sendLength += length;
     }
 
-  private:
-    inline void sendCommand(uint8_t com) __attribute__((always_inline)){
-      uint8_t command[2] = {0x80 /* command mode */, com};
+    void i2cEnd(void) {
       brzo_i2c_start_transaction(_address, BRZO_I2C_SPEED);
-      brzo_i2c_write(command, 2, true);
+      brzo_i2c_write(_sendBuffer, _sendLength, false);
       brzo_i2c_end_transaction();
     }
 };
@@ -679,6 +679,8 @@ void SerialInterface::runCommand(String input) {
     char s[150];
     sprintf(s,str(CLI_SYSTEM_OUTPUT).c_str(), 81920 - system_get_free_heap_size(), 100 - system_get_free_heap_size() / (81920 / 100), system_get_free_heap_size(), system_get_free_heap_size() / (81920 / 100), 81920);
     prntln(String(s));
+    sprintf(s,str(CLI_SYSTEM_MENU_OUT).c_str(), displayUI.getMenuFlash(), displayUI.getMenuHeapSaved());
+    prnt(String(s));
     
     prnt(CLI_SYSTEM_CHANNEL);
     prntln(settings.getChannel());
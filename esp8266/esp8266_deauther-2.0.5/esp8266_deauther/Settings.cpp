@@ -55,6 +55,7 @@ void Settings::load() {
     copyWebFiles(true);
     version = VERSION;
     changed = true;
+    generation++;
   }
   
   prnt(S_SETTINGS_LOADED);
@@ -406,48 +407,60 @@ bool Settings::getWebSpiffs(){
   return webSpiffs;
 }
 
+uint32_t Settings::getGeneration(){
+  return generation;
+}
+
 // ===== SETTERS ===== //
 
 void Settings::setDeauthsPerTarget(uint16_t deauthsPerTarget) {
   Settings::deauthsPerTarget = deauthsPerTarget;
   changed = true;
+  generation++;
 }
 
 void Settings::setDeauthReason(uint8_t deauthReason) {
   Settings::deauthReason = deauthReason;
   changed = true;
+  generation++;
 }
 
 void Settings::setBeaconChannel(bool beaconChannel) {
   Settings::beaconChannel = beaconChannel;
   changed = true;
+  generation++;
 }
 
 void Settings::setForcePackets(uint8_t forcePackets) {
   if(forcePackets > 0){
     Settings::forcePackets = forcePackets;
     changed = true;
+    generation++;
   }
 }
 
 void Settings::setAutosave(bool autosave) {
   Settings::autosave = autosave;
   changed = true;
+  generation++;
 }
 
 void Settings::setAutosaveTime(uint32_t autosaveTime) {
   Settings::autosaveTime = autosaveTime;
   changed = true;
+  generation++;
 }
 
 void Settings::setMaxCh(uint8_t maxCh) {
   Settings::maxCh = maxCh;
   changed = true;
+  generation++;
 }
 
 void Settings::setBeaconInterval(bool beaconInterval) {
   Settings::beaconInterval = beaconInterval;
   changed = true;
+  generation++;
 }
 
 void Settings::setChannel(uint8_t channel) {
@@ -455,6 +468,7 @@ void Settings::setChannel(uint8_t channel) {
     Settings::channel = channel;
     setWifiChannel(channel);
     changed = true;
+    generation++;
     prnt(S_CHANNEL_CHANGE);
     prntln(channel);
   } else {
@@ -468,6 +482,7 @@ void Settings::setSSID(String ssid) {
     ssid = fixUtf8(ssid);
     Settings::ssid = ssid;
     changed = true;
+    generation++;
   } else {
     prntln(S_ERROR_SSID_LEN);
   }
@@ -478,6 +493,7 @@ void Settings::setPassword(String password) {
     password = fixUtf8(password);
     Settings::password = password;
     changed = true;
+    generation++;
   } else {
     prntln(S_ERROR_PASSWORD_LEN);
   }
@@ -486,21 +502,25 @@ void Settings::setPassword(String password) {
 void Settings::setSerialInterface(bool serialInterface) {
   Settings::serialInterface = serialInterface;
   changed = true;
+  generation++;
 }
 
 void Settings::setDisplayInterface(bool displayInterface) {
   Settings::displayInterface = displayInterface;
   changed = true;
+  generation++;
 }
 
 void Settings::setWebInterface(bool webInterface) {
   Settings::webInterface = webInterface;
   changed = true;
+  generation++;
 }
 
 void Settings::setChTime(uint16_t chTime) {
   Settings::chTime = chTime;
   changed = true;
+  generation++;
 }
 
 void Settings::setMacSt(String macStr) {
@@ -518,6 +538,7 @@ bool Settings::setMacSt(uint8_t* macSt){
   if(macSt[0] % 2 == 0){
     memcpy(Settings::macSt, macSt, 6);
     changed = true;
+    generation++;
     return true;
   }
   return false;
@@ -538,6 +559,7 @@ bool Settings::setMacAP(uint8_t* macAP){
   if(macAP[0] % 2 == 0){
     memcpy(Settings::macAP, macAP, 6);
     changed = true;
+    generation++;
     return true;
   }
   return false;
@@ -546,57 +568,68 @@ bool Settings::setMacAP(uint8_t* macAP){
 void Settings::setRandomTX(bool randomTX){
   Settings::randomTX = randomTX;
   changed = true;
+  generation++;
 }
 
 void Settings::setAttackTimeout(uint32_t attackTimeout){
   Settings::attackTimeout = attackTimeout;
   changed = true;
+  generation++;
 }
 
 void Settings::setLedEnabled(bool ledEnabled) {
   Settings::ledEnabled = ledEnabled;
   changed = true;
+  generation++;
 }
 
 void Settings::setProbesPerSSID(uint8_t probesPerSSID) {
   if(probesPerSSID > 0){
     Settings::probesPerSSID = probesPerSSID;
     changed = true;
+    generation++;
   }
 }
 
 void Settings::setHidden(bool hidden) {
   Settings::hidden = hidden;
   changed = true;
+  generation++;
 }
 
 void Settings::setCaptivePortal(bool captivePortal){
   Settings::captivePortal = captivePortal;
   changed = true;
+  generation++;
 }
 
 void Settings::setMinDeauths(uint16_t minDeauths){
   Settings::minDeauths = minDeauths;
   changed = true;
+  generation++;
 }
 
 void Settings::setDisplayTimeout(uint32_t displayTimeout){
   Settings::displayTimeout = displayTimeout;
   changed = true;
+  generation++;
 }
 
 void Settings::setLang(String lang){
   Settings::lang = lang;
   changed = true;
+  generation++;
 }
 
 void Settings::setSerialEcho(bool serialEcho){
   Settings::serialEcho = serialEcho;
   changed = true;
+  generation++;
 }
 
 void Settings::setWebSpiffs(bool webSpiffs){
   Settings::webSpiffs = webSpiffs;
   changed = true;
+  generation++;
 }
 
@@ -65,6 +65,7 @@ class Settings {
     String getLang();
     bool getSerialEcho();
     bool getWebSpiffs();
+    uint32_t getGeneration(); // counts changes to the settings
     
     void setDeauthsPerTarget(uint16_t deauthsPerTarget);
     void setDeauthReason(uint8_t deauthReason);
@@ -98,6 +99,7 @@ class Settings {
     void setWebSpiffs(bool webSpiffs);
   private:
     bool changed = false;
+    uint32_t generation = 0;
 
     String version = VERSION;
 
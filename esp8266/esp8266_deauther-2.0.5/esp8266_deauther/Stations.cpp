@@ -15,6 +15,7 @@ void Stations::add(uint8_t* mac, int accesspointNum) {
     *getTime(stationNum) = currentTime;
   }
   changed = true;
+  generation++;
 }
 
 int Stations::findStation(uint8_t* mac) {
@@ -30,18 +31,21 @@ void Stations::sort() {
   list->sort([](Station &a, Station &b) -> bool{
     return (*a.pkts < *b.pkts);
   });
+  generation++;
 }
 
 void Stations::sortAfterChannel() {
   list->sort([](Station &a, Station &b) -> bool{
     return (a.ch > b.ch);
   });
+  generation++;
 }
 
 void Stations::removeAll() {
   internal_removeAll();
   prntln(ST_CLEARED_LIST);
   changed = true;
+  generation++;
 }
 
 void Stations::remove(int num) {
@@ -50,6 +54,7 @@ void Stations::remove(int num) {
   prnt(ST_REMOVED_STATION);
   prntln(num);
   changed = true;
+  generation++;
 }
 
 void Stations::removeOldest() {
@@ -61,6 +66,7 @@ void Stations::removeOldest() {
   }
   internal_remove(oldest);
   changed = true;
+  generation++;
 }
 
 void Stations::printAll() {
@@ -214,6 +220,10 @@ bool Stations::getSelected(int num) {
   return list->get(num).selected;
 }
 
+uint32_t Stations::getGeneration() {
+  return generation;
+}
+
 uint8_t Stations::getCh(int num) {
   if (!check(num)) return 0;
   return list->get(num).ch;
@@ -225,6 +235,7 @@ void Stations::select(int num) {
   prnt(ST_SELECTED_STATION);
   prntln(num);
   changed = true;
+  generation++;
 }
 
 void Stations::deselect(int num) {
@@ -233,6 +244,7 @@ void Stations::deselect(int num) {
   prnt(ST_DESELECTED_STATION);
   prntln(num);
   changed = true;
+  generation++;
 }
 
 void Stations::selectAll() {
@@ -240,6 +252,7 @@ void Stations::selectAll() {
     internal_select(i);
   prntln(ST_SELECTED_ALL);
   changed = true;
+  generation++;
 }
 
 void Stations::deselectAll() {
@@ -247,6 +260,7 @@ void Stations::deselectAll() {
     internal_deselect(i);
   prntln(ST_DESELECTED_ALL);
   changed = true;
+  generation++;
 }
 
 int Stations::count() {
@@ -54,6 +54,7 @@ class Stations {
     uint8_t getCh(int num);
     int getAP(int num);
     bool getSelected(int num);
+    uint32_t getGeneration(); // counts changes to the list
     bool hasName(int num);
 
     void print(int num);
@@ -67,6 +68,7 @@ class Stations {
     bool check(int num);
     bool changed = false;
   private:
+    uint32_t generation = 0;
     struct Station{
       uint8_t ap;
       uint8_t ch;
@@ -225,6 +225,7 @@ const char CLI_SYSTEM_AP_MAC[] PROGMEM = "AP MAC address: ";
 const char CLI_SYSTEM_ST_MAC[] PROGMEM = "Station MAC address: ";
 const char CLI_SYSTEM_RAM_OUT[] PROGMEM = "SPIFFS: %u bytes used [%d%%], %u bytes free [%d%%], %u bytes in total\r\n";
 const char CLI_SYSTEM_SPIFFS_OUT[] PROGMEM = "        block size %u bytes, page size %u bytes\r\n";
+const char CLI_SYSTEM_MENU_OUT[] PROGMEM = "Display menus: %u bytes in flash, %u bytes of heap saved on the current menu\r\n";
 const char CLI_FILES[] PROGMEM = "Files: ";
 const char CLI_BYTES[] PROGMEM = " bytes";
 const char CLI_SYSTEM_FOOTER[] PROGMEM = "===============================";
@@ -0,0 +1,5 @@
+#pragma once
+class JsonVariant {};
+class JsonObject {};
+class JsonArray {};
+class DynamicJsonBuffer {};
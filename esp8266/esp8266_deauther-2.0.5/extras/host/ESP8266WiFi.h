@@ -0,0 +1,2 @@
+#pragma once
+#define ENC_TYPE_NONE 7
@@ -0,0 +1,241 @@
+// Host tests of the DisplayUI buttons: synthetic edges on the button pins
+// go through buttonInterrupt() and the edge queue, update() debounces
+// them and repeats and holds pushed buttons. Every call of a push or
+// release function is checked with the buttonTime it got.
+//
+//   buttons [name]
+//
+// Prints every failed check and exits with 1 if there was one. Only tests
+// whose name contains `name` run.
+
+// The tests wrap the push and release functions of the buttons
+#define private public
+#include "DisplayUI.h"
+#undef private
+
+#include <vector>
+
+static const char *filter = NULL;
+static int failures = 0;
+
+#define CHECK(condition) check((condition), #condition, __FILE__, __LINE__)
+
+static void check(bool passed, const char *condition, const char *file, int line) {
+  if (passed) return;
+  printf("%s:%d: failed: %s\n", file, line, condition);
+  failures++;
+}
+
+// Pins of A_config.h
+#define PIN_UP   BUTTON_UP
+#define PIN_DOWN BUTTON_DOWN
+#define PIN_A    BUTTON_A
+
+// Indexes in DisplayUI::buttons
+#define UP   0
+#define DOWN 1
+#define A    4
+
+struct Call {
+  char     what; // 'p' push, 'r' release, 'h' push that held button A
+  uint8_t  button;
+  uint32_t time; // buttonTime during the call
+
+  bool operator==(const Call &o) const { return what == o.what && button == o.button && time == o.time; }
+};
+
+static std::vector<Call> calls;
+
+static void printCalls(const char *name, const std::vector<Call> &list) {
+  printf("  %s:", name);
+  for (const Call &call : list) printf(" %c%d@%u", call.what, call.button, (unsigned) call.time);
+  printf("\n");
+}
+
+// Compares the calls since the last checkCalls() with `expected`
+#define CHECK_CALLS(...) checkCalls({ __VA_ARGS__ }, __FILE__, __LINE__)
+
+static void checkCalls(std::vector<Call> expected, const char *file, int line) {
+  if (calls != expected) {
+    printf("%s:%d: failed: calls differ\n", file, line);
+    printCalls("expected", expected);
+    printCalls("got", calls);
+    failures++;
+  }
+  calls.clear();
+}
+
+// A fresh DisplayUI with released buttons at `time`, its push and release
+// functions record their calls before doing their work
+static DisplayUI *start(uint32_t time) {
+  hostSetMillis(time);
+  currentTime = time;
+  digitalWrite(PIN_UP, HIGH);
+  digitalWrite(PIN_DOWN, HIGH);
+  digitalWrite(PIN_A, HIGH);
+
+  DisplayUI *ui = new DisplayUI();
+  ui->setup();
+  for (uint8_t i = 0; i < 6; i++) {
+    Button *button = ui->buttons[i];
+    if (!button->enabled) continue;
+    std::function<void()> push = button->push, release = button->release;
+    button->push = [ui, button, i, push]() {
+      bool hold = button->hold;
+      calls.push_back({ 'p', i, ui->buttonTime });
+      push();
+      if (!hold && button->hold) calls.push_back({ 'h', i, ui->buttonTime });
+    };
+    button->release = [ui, i, release]() {
+      calls.push_back({ 'r', i, ui->buttonTime });
+      release();
+    };
+  }
+  calls.clear();
+  return ui;
+}
+
+// Pushes or releases the button on `pin` at `time`, the pins have pull-ups
+static void edge(uint32_t time, uint8_t pin, bool pushed) {
+  hostSetMillis(time);
+  digitalWrite(pin, pushed ? LOW : HIGH);
+}
+
+// One loop() at `time`
+static void loop(DisplayUI *ui, uint32_t time) {
+  hostSetMillis(time);
+  currentTime = time;
+  ui->update();
+}
+
+static void testBouncyPress(void) {
+  DisplayUI *ui = start(10000);
+
+  edge(11000, PIN_DOWN, true);
+  edge(11002, PIN_DOWN, false);
+  edge(11003, PIN_DOWN, true);
+  loop(ui, 11010);
+  CHECK_CALLS();
+  loop(ui, 11030);
+  CHECK_CALLS({ 'p', DOWN, 11003 });
+  CHECK(ui->currentMenu->selected == 1);
+
+  edge(11100, PIN_DOWN, false);
+  edge(11101, PIN_DOWN, true);
+  edge(11102, PIN_DOWN, false);
+  loop(ui, 11110);
+  CHECK_CALLS();
+  loop(ui, 11200);
+  CHECK_CALLS({ 'r', DOWN, 11102 });
+  CHECK(!ui->buttonDown.pushed);
+
+  delete ui;
+}
+
+static void testClickWithinOneLoop(void) {
+  DisplayUI *ui = start(10000);
+
+  // Pushed and released between two loops that are 500 ms apart
+  loop(ui, 12000);
+  edge(12010, PIN_A, true);
+  edge(12110, PIN_A, false);
+  loop(ui, 12500);
+  CHECK_CALLS({ 'p', A, 12010 }, { 'r', A, 12110 });
+  CHECK(ui->currentMenu == &ui->scanMenu);
+
+  delete ui;
+}
+
+static void testHeldDown(void) {
+  DisplayUI *ui = start(10000);
+
+  // A loop every 10 ms, push repeats every BUTTON_DELAY ms from the press
+  // and once more after BUTTON_HOLD ms
+  edge(13000, PIN_DOWN, true);
+  for (uint32_t time = 13000; time < 14000; time += 10) loop(ui, time);
+  edge(14000, PIN_DOWN, false);
+  loop(ui, 14100);
+  CHECK_CALLS({ 'p', DOWN, 13000 }, { 'p', DOWN, 13280 }, { 'p', DOWN, 13560 },
+              { 'p', DOWN, 13801 }, { 'p', DOWN, 13840 }, { 'r', DOWN, 14000 });
+
+  // The push at 13801 is within BUTTON_DELAY ms of the one before, so the
+  // cursor moved 4 times and wrapped around the 4 nodes of the main menu
+  CHECK(ui->countNodes() == 4);
+  CHECK(ui->currentMenu->selected == 0);
+
+  delete ui;
+}
+
+static void testHeldA(void) {
+  DisplayUI *ui = start(10000);
+
+  edge(15000, PIN_A, true);
+  loop(ui, 15500);
+  CHECK_CALLS({ 'p', A, 15000 }, { 'p', A, 15280 });
+  CHECK(!ui->buttonA.hold);
+
+  // A late loop only gets the last repeat that is due
+  loop(ui, 15805);
+  CHECK_CALLS({ 'p', A, 15801 }, { 'h', A, 15801 });
+  CHECK(ui->buttonA.hold);
+
+  edge(15900, PIN_A, false);
+  loop(ui, 16000);
+  CHECK_CALLS({ 'p', A, 15840 }, { 'r', A, 15900 });
+  CHECK(!ui->buttonA.pushed && !ui->buttonA.hold);
+
+  // Holding doesn't click
+  CHECK(ui->currentMenu == &ui->mainMenu);
+
+  delete ui;
+}
+
+static void testQueueOverflow(void) {
+  DisplayUI *ui = start(10000);
+
+  // More bouncing edges than the queue holds, all of them too short to count
+  for (uint32_t i = 0; i < BUTTON_QUEUE_SIZE + 8; i++) {
+    edge(17000 + i, PIN_UP, i % 2 == 0);
+  }
+  CHECK(ui->buttonLost);
+  loop(ui, 17100);
+  loop(ui, 17200);
+  CHECK_CALLS();
+  CHECK(!ui->buttonLost && ui->buttonHead == ui->buttonTail);
+
+  // Edges of another button that got lost keep the press that was queued
+  edge(17300, PIN_UP, true);
+  for (uint32_t i = 0; i < BUTTON_QUEUE_SIZE + 8; i++) {
+    edge(17301 + i, PIN_DOWN, i % 2 == 0);
+  }
+  loop(ui, 17310);
+  CHECK_CALLS();
+  loop(ui, 17400);
+  CHECK_CALLS({ 'p', UP, 17300 });
+  CHECK(!ui->buttonDown.down);
+
+  edge(17500, PIN_UP, false);
+  loop(ui, 17600);
+  CHECK_CALLS({ 'r', UP, 17500 });
+
+  delete ui;
+}
+
+static void run(const char *name, void (*test)(void)) {
+  if (filter != NULL && strstr(name, filter) == NULL) return;
+  int failed = failures;
+  test();
+  printf("%-40s %s\n", name, failures == failed ? "ok" : "FAILED");
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1) filter = argv[1];
+
+  run("bouncy press", testBouncyPress);
+  run("click within one loop", testClickWithinOneLoop);
+  run("held down", testHeldDown);
+  run("held A", testHeldA);
+  run("queue overflow", testQueueOverflow);
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,130 @@
+// Host stand-ins for the parts of the deauther DisplayUI links against:
+// the globals of esp8266_deauther.ino and functions.h, and modules with
+// empty lists that are never scanning or attacking. Only meant for the
+// host tests in this folder.
+
+#include "DisplayUI.h"
+
+uint8_t  wifi_channel = 1;
+uint32_t currentTime  = 0;
+
+Settings     settings;
+Names        names;
+SSIDs        ssids;
+Accesspoints accesspoints;
+Stations     stations;
+Scan         scan;
+Attack       attack;
+
+String str(const char* ptr) { return String(ptr); }
+String b2s(bool input) { return String(input ? "true" : "false"); }
+String b2a(bool input) { return String(input ? "*" : " "); }
+String buildString(String left, String right, int maxLen) { (void)maxLen; return left + right; }
+String replaceUtf8(String str, String r) { (void)r; return str; }
+void prntln(const char* ptr) { (void)ptr; }
+
+Settings::Settings() {}
+String Settings::getVersion() { return String("host"); }
+uint32_t Settings::getAttackTimeout() { return 0; }
+uint32_t Settings::getDisplayTimeout() { return 0; }
+uint32_t Settings::getGeneration() { return 0; }
+
+Names::Names() {}
+void Names::select(int) {}
+void Names::deselect(int) {}
+void Names::remove(int) {}
+void Names::selectAll() {}
+void Names::deselectAll() {}
+void Names::removeAll() {}
+String Names::getMacStr(int) { return String(); }
+String Names::getBssidStr(int) { return String(); }
+String Names::getName(int) { return String(); }
+String Names::getVendorStr(int) { return String(); }
+String Names::getSelectedStr(int) { return String(); }
+uint8_t Names::getCh(int) { return 1; }
+bool Names::getSelected(int) { return false; }
+uint32_t Names::getGeneration() { return 0; }
+int Names::count() { return 0; }
+
+SSIDs::SSIDs() {}
+void SSIDs::save(bool) {}
+void SSIDs::add(String, bool, int, bool) {}
+void SSIDs::cloneSelected(bool) {}
+void SSIDs::remove(int) {}
+void SSIDs::enableRandom(uint32_t) {}
+void SSIDs::disableRandom() {}
+bool SSIDs::getRandom() { return false; }
+String SSIDs::getName(int) { return String(); }
+bool SSIDs::getWPA2(int) { return false; }
+String SSIDs::getEncStr(int) { return String(); }
+int SSIDs::getLen(int) { return 0; }
+void SSIDs::setWPA2(int, bool) {}
+void SSIDs::removeAll() {}
+int SSIDs::count() { return 0; }
+
+Accesspoints::Accesspoints() {}
+void Accesspoints::select(int) {}
+void Accesspoints::deselect(int) {}
+void Accesspoints::remove(int) {}
+void Accesspoints::selectAll() {}
+void Accesspoints::deselectAll() {}
+void Accesspoints::removeAll() {}
+String Accesspoints::getSSID(int) { return String(); }
+String Accesspoints::getEncStr(int) { return String(); }
+String Accesspoints::getMacStr(int) { return String(); }
+String Accesspoints::getVendorStr(int) { return String(); }
+String Accesspoints::getSelectedStr(int) { return String(); }
+uint8_t Accesspoints::getCh(int) { return 1; }
+uint8_t Accesspoints::getEnc(int) { return ENC_TYPE_NONE; }
+int Accesspoints::getRSSI(int) { return 0; }
+bool Accesspoints::getSelected(int) { return false; }
+uint32_t Accesspoints::getGeneration() { return 0; }
+int Accesspoints::find(uint8_t) { return -1; }
+int Accesspoints::count() { return 0; }
+
+Stations::Stations() {}
+void Stations::select(int) {}
+void Stations::deselect(int) {}
+void Stations::selectAll() {}
+void Stations::deselectAll() {}
+void Stations::removeAll() {}
+void Stations::remove(int) {}
+String Stations::getNameStr(int) { return String(); }
+String Stations::getAPStr(int) { return String(); }
+String Stations::getMacStr(int) { return String(); }
+String Stations::getMacVendorStr(int) { return String(); }
+String Stations::getVendorStr(int) { return String(); }
+String Stations::getTimeStr(int) { return String(); }
+String Stations::getSelectedStr(int) { return String(); }
+uint32_t* Stations::getPkts(int) { static uint32_t pkts = 0; return &pkts; }
+uint8_t Stations::getCh(int) { return 1; }
+int Stations::getAP(int) { return -1; }
+bool Stations::getSelected(int) { return false; }
+uint32_t Stations::getGeneration() { return 0; }
+bool Stations::hasName(int) { return false; }
+int Stations::count() { return 0; }
+
+Scan::Scan() {}
+void Scan::start(uint8_t, uint32_t, uint8_t, uint32_t, bool, uint8_t) {}
+void Scan::stop() {}
+uint8_t Scan::getPercentage() { return 0; }
+uint32_t Scan::getPackets(int) { return 0; }
+uint32_t Scan::countSelected() { return 0; }
+bool Scan::isScanning() { return false; }
+bool Scan::isSniffing() { return false; }
+void Scan::setChannel(uint8_t newChannel) { wifi_channel = newChannel; }
+double Scan::getScaleFactor(uint8_t) { return 1; }
+uint32_t Scan::getMaxPacket() { return 0; }
+uint32_t Scan::getPacketRate() { return 0; }
+
+Attack::Attack() {}
+void Attack::start(bool, bool, bool, bool, bool, uint32_t) {}
+void Attack::stop() {}
+bool Attack::isRunning() { return false; }
+uint32_t Attack::getDeauthPkts() { return 0; }
+uint32_t Attack::getBeaconPkts() { return 0; }
+uint32_t Attack::getProbePkts() { return 0; }
+uint32_t Attack::getDeauthMaxPkts() { return 0; }
+uint32_t Attack::getBeaconMaxPkts() { return 0; }
+uint32_t Attack::getProbeMaxPkts() { return 0; }
+uint32_t Attack::getPacketRate() { return 0; }